@@ -14,9 +14,13 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstdint>
+#include <map>
 #include <mutex>
 
 #include <ddspipe_core/communication/Bridge.hpp>
+#include <ddspipe_core/communication/dds/RouteTable.hpp>
 #include <ddspipe_core/communication/dds/Track.hpp>
 #include <ddspipe_core/configuration/RoutesConfiguration.hpp>
 #include <ddspipe_core/types/topic/dds/DistributedTopic.hpp>
@@ -27,6 +31,25 @@ namespace eprosima {
 namespace ddspipe {
 namespace core {
 
+//! Metrics of a \c DdsBridge
+struct DdsBridgeMetrics
+{
+    //! Time since the topic was discovered until the bridge was created
+    std::chrono::microseconds creation_latency{0};
+
+    //! Whether the bridge has forwarded any data yet
+    bool forwarded = false;
+
+    //! Time since the topic was discovered until the bridge forwarded its first data (0 if it has not forwarded any)
+    std::chrono::microseconds first_sample_latency{0};
+
+    //! Times the Tracks of the bridge have yielded their thread because they ran out of their transmission quantum
+    std::uint64_t yield_count = 0;
+
+    //! Depth metrics of the writer queues of each Track, indexed by the Participant id of its reader and its writer
+    std::map<types::ParticipantId, std::map<types::ParticipantId, WriterQueueMetrics>> writer_queues;
+};
+
 /**
  * Bridge object manages the communication of a \c DistributedTopic.
  * It could be seen as a channel of communication as a DDS Topic, whit several Participants that
@@ -91,6 +114,8 @@ public:
      * Build the IReaders and IWriters inside the bridge for the new participant,
      * and add them to the Tracks.
      *
+     * If the participant does not exist, no writer is created.
+     *
      * Thread safe
      *
      * @param participant_id: The id of the participant who is creating the writer.
@@ -142,6 +167,26 @@ public:
     void update_topic_filter(
             const std::string& expression);
 
+    /**
+     * Set the time when the topic of this bridge was discovered.
+     *
+     * By default it is the time when the bridge started to be created. It must be set when the creation of the
+     * bridge was requested earlier, so the metrics include the time waiting to be created.
+     *
+     * Thread safe
+     */
+    DDSPIPE_CORE_DllAPI
+    void set_discovery_time(
+            const std::chrono::steady_clock::time_point& discovery_time) noexcept;
+
+    /**
+     * Times since the topic was discovered until this bridge was created and forwarded its first data.
+     *
+     * Thread safe
+     */
+    DDSPIPE_CORE_DllAPI
+    DdsBridgeMetrics metrics() noexcept;
+
 protected:
 
     /**
@@ -173,13 +218,15 @@ protected:
      * If the Participant's IReader doesn't exist, create it.
      * If the Participant's Track doesn't exist, create it.
      *
-     * @param writers: The map of ids to writers that are required for the tracks.
+     * @param new_writers: Indexes in \c route_table_ of the writers to add.
+     * @param writers: Writers indexed by the index of their participant in \c route_table_ .
      *
      * @throw InitializationException in case \c IReaders creation fails.
      */
     DDSPIPE_CORE_DllAPI
     void add_writers_to_tracks_nts_(
-            std::map<types::ParticipantId, std::shared_ptr<IWriter>>& writers);
+            const ParticipantBitset& new_writers,
+            const std::vector<std::shared_ptr<IWriter>>& writers);
 
     /**
      * @brief Impose the Topic QoS that have been pre-configured for a participant.
@@ -197,8 +244,11 @@ protected:
     //! Topic associated to the DdsBridge.
     utils::Heritable<types::DistributedTopic> topic_;
 
-    //! Routes associated to the Topic.
-    RoutesConfiguration::RoutesMap routes_;
+    //! Routes associated to the Topic, compiled for the participants of the database.
+    const RouteTable route_table_;
+
+    //! Indexes in \c route_table_ of the participants whose writer is in the Tracks.
+    ParticipantBitset active_writers_;
 
     //! Topics that explicitally set a QoS attribute for this participant.
     std::vector<types::ManualTopic> manual_topics_;
@@ -212,6 +262,19 @@ protected:
      */
     std::map<types::ParticipantId, std::unique_ptr<Track>> tracks_;
 
+    //! Time when the topic of this bridge was discovered
+    std::chrono::steady_clock::time_point discovery_time_;
+
+    //! Time when this bridge was created
+    std::chrono::steady_clock::time_point creation_time_;
+
+    /**
+     * Time when the first data was forwarded by any Track (epoch of the steady clock if none yet)
+     *
+     * It is kept once found, so it does not change when the Track that forwarded it is removed.
+     */
+    std::chrono::steady_clock::time_point first_transmission_time_;
+
     //! Mutex to prevent simultaneous calls to enable and/or disable
     std::mutex mutex_;
 
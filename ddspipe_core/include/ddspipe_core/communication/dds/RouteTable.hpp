@@ -0,0 +1,165 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include <ddspipe_core/configuration/RoutesConfiguration.hpp>
+#include <ddspipe_core/library/library_dll.h>
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+/**
+ * Set of participants, each one represented by its index in a \c RouteTable .
+ */
+class ParticipantBitset
+{
+public:
+
+    /**
+     * ParticipantBitset constructor.
+     *
+     * @param size: Number of participants that may be in the set. All of them start unset.
+     */
+    DDSPIPE_CORE_DllAPI
+    explicit ParticipantBitset(
+            const std::size_t size = 0);
+
+    //! Add the participant with index \c index to the set
+    DDSPIPE_CORE_DllAPI
+    void set(
+            const std::size_t index) noexcept;
+
+    //! Remove the participant with index \c index from the set
+    DDSPIPE_CORE_DllAPI
+    void reset(
+            const std::size_t index) noexcept;
+
+    //! Whether the participant with index \c index is in the set
+    DDSPIPE_CORE_DllAPI
+    bool test(
+            const std::size_t index) const noexcept;
+
+    //! Whether any participant is in the set
+    DDSPIPE_CORE_DllAPI
+    bool any() const noexcept;
+
+    //! Participants in both sets. Both sets must have the same size.
+    DDSPIPE_CORE_DllAPI
+    ParticipantBitset operator &(
+            const ParticipantBitset& other) const noexcept;
+
+    //! Add the participants of \c other to this set. Both sets must have the same size.
+    DDSPIPE_CORE_DllAPI
+    ParticipantBitset& operator |=(
+            const ParticipantBitset& other) noexcept;
+
+    //! Indexes of the participants in the set, in increasing order
+    DDSPIPE_CORE_DllAPI
+    std::vector<std::size_t> indexes() const;
+
+protected:
+
+    //! Number of bits in each word
+    static constexpr const std::size_t WORD_BITS_ = 64;
+
+    //! One bit per participant
+    std::vector<std::uint64_t> words_;
+};
+
+/**
+ * Routes of a \c DdsBridge compiled into a matrix of participant indexes.
+ *
+ * Each participant gets a dense index. The row of a reader holds the writers that forward the data it receives: the
+ * ones in its route, or every other writer (and its own if it is a repeater) when it has no route.
+ * The column of a writer holds the readers whose data it forwards.
+ *
+ * The table is built once per bridge, so adding or removing a writer does not look up the routes again.
+ */
+class RouteTable
+{
+public:
+
+    /**
+     * RouteTable constructor by required values.
+     *
+     * @param routes:       Routes of the \c DdsPipe . Participants not in \c participants are ignored.
+     * @param participants: Every participant with whether it is a repeater
+     */
+    DDSPIPE_CORE_DllAPI
+    RouteTable(
+            const RoutesConfiguration::RoutesMap& routes,
+            const std::map<types::ParticipantId, bool>& participants);
+
+    //! Number of participants in the table
+    DDSPIPE_CORE_DllAPI
+    std::size_t size() const noexcept;
+
+    //! Id of the participant with index \c index
+    DDSPIPE_CORE_DllAPI
+    const types::ParticipantId& participant_id(
+            const std::size_t index) const noexcept;
+
+    /**
+     * Look for the index of a participant.
+     *
+     * @param id:    Id of the participant
+     * @param index: Index of the participant, set only if it is found
+     *
+     * @return Whether the participant is in the table.
+     */
+    DDSPIPE_CORE_DllAPI
+    bool find_index(
+            const types::ParticipantId& id,
+            std::size_t& index) const noexcept;
+
+    //! Writers that forward the data received by the reader with index \c reader
+    DDSPIPE_CORE_DllAPI
+    const ParticipantBitset& writers_of(
+            const std::size_t reader) const noexcept;
+
+    //! Readers whose data is forwarded by the writer with index \c writer
+    DDSPIPE_CORE_DllAPI
+    const ParticipantBitset& readers_of(
+            const std::size_t writer) const noexcept;
+
+    //! Writers that forward the data of any reader
+    DDSPIPE_CORE_DllAPI
+    const ParticipantBitset& routed_writers() const noexcept;
+
+protected:
+
+    //! Ids of the participants, sorted, so the index of a participant is its position
+    std::vector<types::ParticipantId> ids_;
+
+    //! Writers of each reader
+    std::vector<ParticipantBitset> rows_;
+
+    //! Readers of each writer
+    std::vector<ParticipantBitset> columns_;
+
+    //! Union of every row
+    ParticipantBitset routed_writers_;
+};
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
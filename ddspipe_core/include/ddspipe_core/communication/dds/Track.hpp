@@ -15,14 +15,22 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
 #include <mutex>
+#include <utility>
+#include <vector>
 
 #include <cpp_utils/thread_pool/pool/SlotThreadPool.hpp>
 #include <cpp_utils/memory/Heritable.hpp>
 
+#include <ddspipe_core/communication/dds/WriterQueue.hpp>
 #include <ddspipe_core/interface/IParticipant.hpp>
 #include <ddspipe_core/interface/IReader.hpp>
 #include <ddspipe_core/interface/IWriter.hpp>
+#include <ddspipe_core/monitoring/producers/TopicsMonitorProducer.hpp>
 #include <ddspipe_core/types/topic/dds/DistributedTopic.hpp>
 #include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
 
@@ -43,6 +51,15 @@ public:
      *
      * Track construction creates a new thread that manages the transmission between the reader and the writers.
      *
+     * The transmission quantum of the Track is taken from the QoS of \c topic .
+     * If the \c writer_queue_size QoS of \c topic is not 0, every writer gets a \c WriterQueue so slow writers do not
+     * delay the others.
+     * If the \c inline_transmission QoS of \c topic is set, data is transmitted in the thread that notifies it.
+     * If the \c conflation_threshold QoS of a keyed \c topic is not 0, only the latest sample of each instance is
+     * forwarded while the reader has a backlog of at least that many samples.
+     * If the \c max_forward_latency QoS of \c topic is not 0, the samples published earlier than that are dropped and
+     * counted as dropped in the monitor.
+     *
      * @param topic:    Topic that this Track manages communication
      * @param reader:   Reader that will receive the remote data
      * @param writers:  Map of Writers that will send the data received by \c source indexed by Participant id
@@ -174,6 +191,34 @@ public:
     void update_reader_content_filter(
             const std::string& expression);
 
+    /**
+     * Number of times this Track has yielded its thread because its transmission quantum ran out.
+     *
+     * Thread safe
+     */
+    DDSPIPE_CORE_DllAPI
+    std::uint64_t yield_count() const noexcept;
+
+    /**
+     * Time when this Track forwarded its first data.
+     *
+     * It is the epoch of the steady clock if this Track has not forwarded any data yet.
+     *
+     * Thread safe
+     */
+    DDSPIPE_CORE_DllAPI
+    std::chrono::steady_clock::time_point first_transmission_time() const noexcept;
+
+    /**
+     * Depth metrics of the queue of each writer, indexed by Participant id.
+     *
+     * It is empty if the writers of this Track have no queue.
+     *
+     * Thread safe
+     */
+    DDSPIPE_CORE_DllAPI
+    std::map<types::ParticipantId, WriterQueueMetrics> writer_queues_metrics() noexcept;
+
 protected:
 
     /*
@@ -204,9 +249,22 @@ protected:
      *
      * This method will add the variable \c data_available_status_ in \c new_data_arrived .
      * It will emit a task to execute transmit in a different thread if there was no previous thread before.
+     *
+     * With inline transmission, it transmits up to a batch of data in this same thread instead, and only emits the
+     * task for the data left. It falls back to emitting the task if the transmission is busy, or if this thread is
+     * already inside a Track (a reader call or another inline transmission), so it never re-enters a Track.
      */
     void data_available_() noexcept;
 
+    /**
+     * Call a method of the Reader.
+     *
+     * With inline transmission, the call is done with \c on_transmission_mutex_ taken. The Reader may be called with
+     * its internal mutex taken from \c data_available_ , so this keeps the lock order of both mutexes consistent.
+     */
+    void call_reader_(
+            const std::function<void()>& call) noexcept;
+
     /**
      * Whether this Track is enabled and should not exit.
      *
@@ -214,16 +272,90 @@ protected:
      */
     bool should_transmit_() noexcept;
 
+    //! Whether every writer has its own \c WriterQueue
+    bool use_writer_queues_() const noexcept;
+
+    /**
+     * Number of data that can be pushed to every writer queue.
+     *
+     * It is unlimited unless the queues use \c block policy. If it is 0, the transmission must stop: a queue will
+     * call \c writer_queue_room_available_ when it has room, or the transmission has already been emitted.
+     * Must be called with \c on_transmission_mutex_ taken.
+     */
+    std::size_t writer_queues_room_nts_() noexcept;
+
+    //! Emit the transmission if it stopped waiting for room in a writer queue
+    void writer_queue_room_available_() noexcept;
+
+    /**
+     * Take the backlog of the reader after a full batch, up to \c conflation_threshold_ samples in \c taken_data_ .
+     *
+     * If the backlog reaches the threshold, the Track cannot keep up with the reader: only the latest sample of each
+     * instance is kept in \c taken_data_ , and the others are notified to the monitor as dropped.
+     *
+     * @return Number of samples dropped.
+     */
+    std::size_t conflate_backlog_nts_() noexcept;
+
+    /**
+     * Remove from \c taken_data_ the samples older than \c max_forward_latency_ , and notify them to the monitor
+     * as dropped.
+     *
+     * @return Number of samples dropped.
+     */
+    std::size_t drop_stale_samples_nts_() noexcept;
+
+    //! Position of the writer of participant \c id in \c writers_ (end if it is not in the Track)
+    std::vector<std::pair<types::ParticipantId, std::shared_ptr<IWriter>>>::iterator find_writer_nts_(
+            const types::ParticipantId& id) noexcept;
+
+    //! Create the \c WriterQueue of a writer. Must be called with \c track_mutex_ taken.
+    void create_writer_queue_nts_(
+            const types::ParticipantId& id,
+            const std::shared_ptr<IWriter>& writer) noexcept;
+
+    /**
+     * Whether this Track has run out of its transmission quantum.
+     *
+     * At least one sample must have been processed for the quantum to run out, so every call to \c transmit_
+     * makes progress. Samples dropped count as processed, as discarding a backlog also holds the thread.
+     *
+     * @param processed_samples samples taken from the reader (forwarded or dropped) since \c transmit_ was called.
+     * @param max_samples samples quantum of this transmission (0 <=> no limit).
+     * @param transmission_start time when \c transmit_ was called.
+     */
+    bool quantum_exhausted_(
+            unsigned int processed_samples,
+            unsigned int max_samples,
+            const std::chrono::steady_clock::time_point& transmission_start) const noexcept;
+
     /**
      * Take data from the Reader \c source and send this data through every writer in \c targets .
      *
+     * Data is taken in batches of up to \c MAX_MESSAGES_TAKE_BATCH_ samples, and every batch is sent through
+     * each writer before taking the next one. If writers have queues, the data is pushed to every queue instead.
+     *
      * When no more data is available, set \c data_available_status_ as \c no_more_data .
      *
+     * When the transmission quantum runs out, it emits the transmit task again and returns, so the thread is
+     * released for other Tracks. \c data_available_status_ is kept over \c no_more_data , so no listener
+     * emits the task twice.
+     *
      * It could exit without having finished transmitting all the data if track should terminate or track becomes
      * disabled.
      */
     void transmit_() noexcept;
 
+    /**
+     * Transmit data as \c transmit_ does, with \c on_transmission_mutex_ already taken in \c lock .
+     *
+     * @param lock lock of \c on_transmission_mutex_ . It is released before emitting the task to continue.
+     * @param max_samples samples quantum of this transmission (0 <=> no limit).
+     */
+    void transmit_nts_(
+            std::unique_lock<std::mutex>& lock,
+            unsigned int max_samples) noexcept;
+
     //! Topic that refers to this Bridge
     const utils::Heritable<ITopic> topic_;
 
@@ -237,8 +369,12 @@ protected:
     //! Reader that will read data
     std::shared_ptr<IReader> reader_;
 
-    //! Writers that will send data forward
-    std::map<types::ParticipantId, std::shared_ptr<IWriter>> writers_;
+    /**
+     * Writers that will send data forward, with the Id of their Participant
+     *
+     * It is a dense array so the transmission iterates it without following the nodes of a map.
+     */
+    std::vector<std::pair<types::ParticipantId, std::shared_ptr<IWriter>>> writers_;
 
     //! Common shared payload pool
     std::shared_ptr<PayloadPool> payload_pool_;
@@ -286,7 +422,59 @@ protected:
 
     std::shared_ptr<utils::SlotThreadPool> thread_pool_;
 
-    static const unsigned int MAX_MESSAGES_TRANSMIT_LOOP_;
+    /**
+     * Data taken from the Reader in the current batch
+     *
+     * It is only accessed within \c transmit_ , so it is protected by \c on_transmission_mutex_ .
+     * It is kept as a member so its memory is reused between batches.
+     */
+    std::vector<std::unique_ptr<IRoutingData>> taken_data_;
+
+    //! Max samples transmitted in a single call to \c transmit_ (0 <=> no limit)
+    const unsigned int quantum_samples_;
+
+    //! Max time transmitting in a single call to \c transmit_ (0 <=> no limit)
+    const std::chrono::microseconds quantum_time_;
+
+    //! Number of times the transmission quantum has run out
+    std::atomic<std::uint64_t> yield_count_;
+
+    //! Ticks of the steady clock when the first data was forwarded (0 <=> no data forwarded yet)
+    std::atomic<std::chrono::steady_clock::rep> first_transmission_ticks_;
+
+    //! Size of the queue of each writer (0 <=> writers are called from the transmission thread)
+    const unsigned int writer_queue_size_;
+
+    //! What to do with a new data when the queue of a writer is full
+    const types::WriterQueueOverflowPolicy writer_queue_overflow_policy_;
+
+    //! Whether the transmission has stopped until a writer queue with \c block policy has room
+    std::atomic<bool> waiting_writer_queue_room_;
+
+    /**
+     * Queue of each writer, indexed by Participant id. Only used if \c writer_queue_size_ is not 0.
+     *
+     * It is modified with \c track_mutex_ and \c on_transmission_mutex_ taken.
+     */
+    std::map<types::ParticipantId, std::unique_ptr<WriterQueue>> writer_queues_;
+
+    //! Whether data is transmitted in the thread that notifies it
+    const bool inline_transmission_;
+
+    //! Backlog from which samples superseded by a newer one of their instance are dropped (0 <=> never)
+    const unsigned int conflation_threshold_;
+
+    //! Max time since a sample was published until it is forwarded (0 <=> no limit)
+    const std::chrono::milliseconds max_forward_latency_;
+
+    //! Monitor counters of the topic in the participant of the reader. Only set if the QoS may drop samples.
+    std::shared_ptr<TopicsMonitorProducer::MessageCounters> monitor_counters_;
+
+    //! Number of Track transmissions or reader calls running in this thread
+    static thread_local unsigned int calls_in_thread_;
+
+    //! Maximum number of samples taken from the Reader at once
+    static const unsigned int MAX_MESSAGES_TAKE_BATCH_;
 
     // Allow operator << to use private variables
     friend std::ostream& operator <<(
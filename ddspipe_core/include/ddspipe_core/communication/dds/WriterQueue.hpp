@@ -0,0 +1,213 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include <cpp_utils/thread_pool/pool/SlotThreadPool.hpp>
+
+#include <ddspipe_core/interface/IRoutingData.hpp>
+#include <ddspipe_core/interface/IWriter.hpp>
+#include <ddspipe_core/library/library_dll.h>
+#include <ddspipe_core/types/dds/TopicQoS.hpp>
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+//! Depth metrics of a \c WriterQueue
+struct WriterQueueMetrics
+{
+    //! Number of data currently waiting in the queue
+    std::size_t depth = 0;
+
+    //! Highest number of data that has been waiting in the queue at the same time
+    std::size_t max_depth = 0;
+
+    //! Number of data discarded because the queue was full
+    std::uint64_t dropped = 0;
+};
+
+/**
+ * WriterQueue decouples a \c Track from one of its \c IWriter .
+ *
+ * The Track pushes the data it takes from its reader, and the queue writes them in the writer from its own task in
+ * the thread pool. This way a slow writer only delays its own destination.
+ *
+ * The data is shared among every queue of the Track, so its payload is only released when every writer has sent it.
+ *
+ * The queue is bounded. When it is full, the \c WriterQueueOverflowPolicy decides what to do with the new data.
+ * With \c block policy the queue never waits, as it would hold a thread of the pool that its drain task may need:
+ * the Track checks \c room_or_notify before pushing, and it is notified once the queue has room again.
+ */
+class WriterQueue
+{
+public:
+
+    /**
+     * WriterQueue constructor by required values.
+     *
+     * The queue is created disabled.
+     *
+     * @param writer_participant_id:  Id of the Participant of the Writer
+     * @param writer:                 Writer that will send the data pushed
+     * @param capacity:               Max number of data waiting to be written
+     * @param overflow_policy:        What to do when the queue is full
+     * @param thread_pool:            Thread pool where the data is written
+     * @param on_room_available:      Called from the drain task when a data leaves the queue after
+     *                                \c room_or_notify found it full
+     */
+    DDSPIPE_CORE_DllAPI
+    WriterQueue(
+            const types::ParticipantId& writer_participant_id,
+            const std::shared_ptr<IWriter>& writer,
+            const std::size_t capacity,
+            const types::WriterQueueOverflowPolicy overflow_policy,
+            const std::shared_ptr<utils::SlotThreadPool>& thread_pool,
+            const std::function<void()>& on_room_available = nullptr) noexcept;
+
+    /**
+     * @brief Destructor
+     *
+     * It disables the queue, waiting for the data being written.
+     * A drain task already emitted that has not started yet does nothing once the queue is destroyed.
+     */
+    DDSPIPE_CORE_DllAPI
+    ~WriterQueue();
+
+    /**
+     * Enable the queue, so data pushed are written.
+     *
+     * Thread safe
+     */
+    DDSPIPE_CORE_DllAPI
+    void enable() noexcept;
+
+    /**
+     * Disable the queue.
+     *
+     * It waits for the data being written and discards the data waiting.
+     *
+     * Thread safe
+     */
+    DDSPIPE_CORE_DllAPI
+    void disable() noexcept;
+
+    /**
+     * Add a data to be written.
+     *
+     * If the queue is full, the overflow policy is applied. With \c block policy the data is discarded, as callers
+     * must not push more data than \c room_or_notify allows.
+     *
+     * @return \c true if the data has been queued, \c false if it has been discarded.
+     *
+     * Thread safe
+     */
+    DDSPIPE_CORE_DllAPI
+    bool push(
+            const std::shared_ptr<IRoutingData>& data) noexcept;
+
+    /**
+     * Number of data that can be pushed before the queue is full.
+     *
+     * If it is 0, \c on_room_available will be called as soon as a data leaves the queue.
+     * A disabled queue discards every data, so it never runs out of room.
+     *
+     * Thread safe
+     */
+    DDSPIPE_CORE_DllAPI
+    std::size_t room_or_notify() noexcept;
+
+    //! Current depth metrics of the queue
+    DDSPIPE_CORE_DllAPI
+    WriterQueueMetrics metrics() const noexcept;
+
+protected:
+
+    /**
+     * Write every data in the queue.
+     *
+     * It is executed in the thread pool, and it is emitted by \c push when the queue goes from empty to not empty.
+     */
+    void drain_() noexcept;
+
+    /**
+     * Queue run by the drain task, shared with the task so it outlives the queue.
+     *
+     * The task runs \c drain_ with \c mutex taken, and the destructor resets \c queue with it taken, so a task
+     * emitted before the destruction never runs on a destroyed queue.
+     */
+    struct DrainSlot
+    {
+        std::mutex mutex;
+        WriterQueue* queue = nullptr;
+    };
+
+    //! Id of the Participant of the Writer
+    const types::ParticipantId writer_participant_id_;
+
+    //! Writer that will send the data
+    std::shared_ptr<IWriter> writer_;
+
+    //! Max number of data waiting in \c queue_
+    const std::size_t capacity_;
+
+    //! What to do with new data when \c queue_ is full
+    const types::WriterQueueOverflowPolicy overflow_policy_;
+
+    //! Data waiting to be written
+    std::deque<std::shared_ptr<IRoutingData>> queue_;
+
+    //! Whether the queue is enabled. Protected by \c mutex_ .
+    bool enabled_;
+
+    /**
+     * Whether the drain task has been emitted and has not yet found the queue empty.
+     *
+     * Protected by \c mutex_ , so a data pushed is always written by a running or an emitted drain task.
+     */
+    bool draining_;
+
+    //! Whether \c on_room_available_ must be called when a data leaves the queue. Protected by \c mutex_ .
+    bool notify_room_;
+
+    //! Metrics of the queue. Protected by \c mutex_ .
+    std::size_t max_depth_;
+    std::uint64_t dropped_;
+
+    //! Mutex that protects \c queue_ and its status variables
+    mutable std::mutex mutex_;
+
+    //! Called when there is room in \c queue_ after \c room_or_notify found it full
+    std::function<void()> on_room_available_;
+
+    //! Mutex to guard while the queue is writing a data so it could not be disabled
+    std::mutex on_drain_mutex_;
+
+    utils::TaskId drain_task_id_;
+
+    std::shared_ptr<DrainSlot> drain_slot_;
+
+    std::shared_ptr<utils::SlotThreadPool> thread_pool_;
+};
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
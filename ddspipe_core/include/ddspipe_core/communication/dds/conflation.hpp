@@ -0,0 +1,45 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <ddspipe_core/interface/IRoutingData.hpp>
+#include <ddspipe_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+/**
+ * Keep only the latest sample of each instance in a sequence of data.
+ *
+ * Only the \c RtpsPayloadData with a defined instance handle that carry a new value (ALIVE) are conflated.
+ * Disposals, unregistrations, samples without instance and data of other kinds are always kept, and the samples kept
+ * preserve their order.
+ *
+ * @param data: Data in the order it was received. The samples conflated are destroyed.
+ *
+ * @return Number of samples removed.
+ */
+DDSPIPE_CORE_DllAPI
+std::size_t conflate_instances(
+        std::vector<std::unique_ptr<IRoutingData>>& data) noexcept;
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,50 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <ddspipe_core/interface/IRoutingData.hpp>
+#include <ddspipe_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+/**
+ * Remove the samples whose source timestamp is older than a latency budget.
+ *
+ * The source timestamp is set by the clock of the publisher, so the clocks of both hosts must be synchronized.
+ * Samples without a valid source timestamp and data other than \c RtpsPayloadData are always kept, and the samples kept
+ * preserve their order.
+ *
+ * @param data:        Data in the order it was received. The samples removed are destroyed.
+ * @param max_latency: Max time since a sample was published until it is forwarded
+ * @param now:         Current time
+ *
+ * @return Number of samples removed.
+ */
+DDSPIPE_CORE_DllAPI
+std::size_t drop_stale_samples(
+        std::vector<std::unique_ptr<IRoutingData>>& data,
+        const std::chrono::nanoseconds& max_latency,
+        const std::chrono::system_clock::time_point& now) noexcept;
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
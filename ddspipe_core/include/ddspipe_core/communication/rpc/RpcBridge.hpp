@@ -15,15 +15,20 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <map>
 #include <mutex>
 #include <set>
 #include <shared_mutex>
+#include <vector>
 
 #include <ddspipe_core/communication/Bridge.hpp>
+#include <ddspipe_core/communication/rpc/RpcDispatchPolicy.hpp>
 #include <ddspipe_core/communication/rpc/ServiceRegistry.hpp>
 #include <ddspipe_core/interface/IWriter.hpp>
 #include <ddspipe_core/interface/IReader.hpp>
+#include <ddspipe_core/types/data/RpcPayloadData.hpp>
+#include <ddspipe_core/types/participant/ParticipantHandle.hpp>
 #include <ddspipe_core/types/topic/rpc/RpcTopic.hpp>
 
 namespace eprosima {
@@ -53,6 +58,9 @@ public:
      * @param participant_database: Collection of Participants to manage communication
      * @param payload_pool: Payload Pool that handles the reservation/release of payloads throughout the DDS Router
      * @param thread_pool: Shared pool of threads in charge of data transmission.
+     * @param max_pending_requests: Max number of requests waiting for their reply in each participant
+     * @param request_timeout: Time a request waits for its reply before being discarded (0 <=> forever)
+     * @param dispatch_policy: Policy to choose the participants each request is forwarded to
      *
      * @note Always created disabled, manual enable required. First enable creates all endpoints.
      */
@@ -61,7 +69,10 @@ public:
             const types::RpcTopic& topic,
             const std::shared_ptr<ParticipantsDatabase>& participants_database,
             const std::shared_ptr<PayloadPool>& payload_pool,
-            const std::shared_ptr<utils::SlotThreadPool>& thread_pool);
+            const std::shared_ptr<utils::SlotThreadPool>& thread_pool,
+            const unsigned int max_pending_requests = ServiceRegistry::DEFAULT_CAPACITY,
+            const std::chrono::milliseconds& request_timeout = std::chrono::milliseconds(0),
+            const RpcDispatchPolicy dispatch_policy = RpcDispatchPolicy::BROADCAST);
 
     /**
      * @brief Destructor
@@ -134,9 +145,47 @@ protected:
     void create_proxy_client_nts_(
             types::ParticipantId participant_id);
 
-    //! Create slot in the thread pool for this reader
+    /**
+     * Participants the request received by \c participant_receiver must be forwarded to, following
+     * \c dispatch_policy_ .
+     *
+     * For any policy other than broadcast, only participants with (actual) servers are returned, the preferred one
+     * first and the others after it, to be used in case writing in the preferred one fails.
+     *
+     * @param participant_receiver: Participant that received the request
+     * @param targets: Set to the handles of the participants. Reused between requests, so it does not allocate.
+     */
+    void dispatch_targets_(
+            const types::ParticipantHandle participant_receiver,
+            std::vector<types::ParticipantHandle>& targets) noexcept;
+
+    /**
+     * Forward a request through the proxy clients chosen by \c dispatch_targets_ , and add an entry to the registry
+     * of each one it is sent through, so its reply can be forwarded back.
+     *
+     * For any policy other than broadcast, it is only sent through the first one that it can be written in.
+     *
+     * @param rpc_data: Request to forward
+     * @param reply_related_sample_identity: Identity of the original request, related to its reply
+     * @param targets: Buffer for the targets, reused between requests
+     */
+    void forward_request_(
+            types::RpcPayloadData& rpc_data,
+            const SampleIdentity& reply_related_sample_identity,
+            std::vector<types::ParticipantHandle>& targets) noexcept;
+
+    //! Whether there are (actual) servers available in participant \c participant_handle
+    bool has_servers_(
+            const types::ParticipantHandle participant_handle) const noexcept;
+
+    //! Same as \c has_servers_ , but it must be called with \c servers_mutex_ locked
+    bool has_servers_nts_(
+            const types::ParticipantHandle participant_handle) const noexcept;
+
+    //! Create slot in the thread pool for this reader of participant \c participant_handle
     void create_slot_(
-            std::shared_ptr<IReader> reader) noexcept;
+            std::shared_ptr<IReader> reader,
+            const types::ParticipantHandle participant_handle) noexcept;
 
     //! Callback to execute when a new cache change is added to this reader
     void data_available_(
@@ -153,7 +202,8 @@ protected:
      * topic being blocked).
      */
     void transmit_(
-            std::shared_ptr<IReader> reader) noexcept;
+            std::shared_ptr<IReader> reader,
+            const types::ParticipantHandle participant_handle) noexcept;
 
     //! Whether there are any servers in the database
     bool servers_available_() const noexcept;
@@ -161,13 +211,16 @@ protected:
     //! Flag set to true when proxy clients and servers are created, so it can only be done once
     bool init_;
 
-    //! Proxy servers endpoints
-    std::map<types::ParticipantId, std::shared_ptr<IReader>> request_readers_;
-    std::map<types::ParticipantId, std::shared_ptr<IWriter>> reply_writers_;
+    //! Proxy servers endpoints, indexed by the handle of their participant as they are used for every reply
+    std::map<types::ParticipantHandle, std::shared_ptr<IReader>> request_readers_;
+    std::map<types::ParticipantHandle, std::shared_ptr<IWriter>> reply_writers_;
 
-    //! Proxy clients endpoints
-    std::map<types::ParticipantId, std::shared_ptr<IReader>> reply_readers_;
-    std::map<types::ParticipantId, std::shared_ptr<IWriter>> request_writers_;
+    //! Proxy clients endpoints, indexed by the handle of their participant as they are used for every request
+    std::map<types::ParticipantHandle, std::shared_ptr<IReader>> reply_readers_;
+    std::map<types::ParticipantHandle, std::shared_ptr<IWriter>> request_writers_;
+
+    //! Handles of the repeater participants, where requests are also forwarded through the one that received them
+    std::set<types::ParticipantHandle> repeater_participants_;
 
     //! Map readers' GUIDs to their associated thread pool tasks, and also keep a task emission flag.
     std::map<types::Guid, std::pair<bool, utils::TaskId>> tasks_map_;
@@ -176,12 +229,15 @@ protected:
      * Registry of requests received, with all the information needed to send the future reply back to the requester.
      *
      * There is one per participant, handling the communication of each of them with the servers they are directly
-     * in contact with.
+     * in contact with. Indexed by the handle of the participant.
      */
-    std::map<types::ParticipantId, std::shared_ptr<ServiceRegistry>> service_registries_;
+    std::map<types::ParticipantHandle, std::shared_ptr<ServiceRegistry>> service_registries_;
+
+    //! Database keeping track of the (actual) servers available at each participant, indexed by its handle.
+    std::map<types::ParticipantHandle, std::set<types::GuidPrefix>> current_servers_;
 
-    //! Database keeping track of the (actual) servers available at each participant.
-    std::map<types::ParticipantId, std::set<types::GuidPrefix>> current_servers_;
+    //! Mutex guarding \c current_servers_ , as it is also read while transmitting
+    mutable std::mutex servers_mutex_;
 
     //! Mutex to prevent simultaneous calls to enable and/or disable
     std::mutex mutex_;
@@ -193,6 +249,18 @@ protected:
 
     types::RpcTopic rpc_topic_;
 
+    //! Max number of requests waiting for their reply in each \c ServiceRegistry
+    const unsigned int max_pending_requests_;
+
+    //! Time a request waits for its reply before being discarded (0 <=> forever)
+    const std::chrono::milliseconds request_timeout_;
+
+    //! Policy to choose the participants each request is forwarded to
+    const RpcDispatchPolicy dispatch_policy_;
+
+    //! Counter of requests dispatched, to choose the next participant with \c ROUND_ROBIN policy
+    std::atomic<std::size_t> next_target_;
+
     // Allow operator << to use private variables
     friend std::ostream& operator <<(
             std::ostream&,
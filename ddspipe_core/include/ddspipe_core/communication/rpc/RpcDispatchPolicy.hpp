@@ -0,0 +1,34 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cpp_utils/macros/custom_enumeration.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+//! Possible policies to choose the participants a service request is forwarded to
+ENUMERATION_BUILDER(
+    RpcDispatchPolicy,
+    BROADCAST,          //! The request is forwarded to every participant with servers.
+    FIRST_AVAILABLE,    //! The request is forwarded to the first participant with servers.
+    ROUND_ROBIN,        //! The request is forwarded to each participant with servers in turns.
+    LEAST_OUTSTANDING   //! The request is forwarded to the participant with servers with fewer pending requests.
+    );
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -15,12 +15,17 @@
 #pragma once
 
 #include <atomic>
-#include <map>
+#include <chrono>
+#include <cstdint>
+#include <memory>
 #include <mutex>
+#include <vector>
 
 #include <fastdds/rtps/common/SampleIdentity.hpp>
 
+#include <ddspipe_core/monitoring/producers/ServicesMonitorProducer.hpp>
 #include <ddspipe_core/types/dds/Guid.hpp>
+#include <ddspipe_core/types/participant/ParticipantHandle.hpp>
 #include <ddspipe_core/types/participant/ParticipantId.hpp>
 #include <ddspipe_core/types/topic/rpc/RpcTopic.hpp>
 
@@ -36,9 +41,13 @@ using SequenceNumber = eprosima::fastdds::rtps::SequenceNumber_t;
  * Class used to store the information associated to a service request, so its reply can be forwarded through the
  * appropiate proxy server with the proper write parameters.
  *
- * This information is stored in a map, whose insertions and deletions are protected with a mutex.
+ * This information is stored in a fixed-capacity hash table indexed by the sequence number of the request forwarded,
+ * so looking for the entry of a reply does not walk a tree nor allocate.
  * Insertions are performed every time a request is sent, and deletions after a reply has been received and forwarded.
  *
+ * Requests not replied within the request timeout are removed and counted as expired.
+ * If the registry is full anyway, the oldest request is removed and counted as evicted, so its reply will be dropped.
+ *
  * There exists a service registry per pipe participant.
  *
  */
@@ -51,13 +60,17 @@ public:
      *
      * @param topic: Topic (service) of which this ServiceRegistry manages communication
      * @param participant_id: Id of participant for which this registry is created
+     * @param capacity: Max number of requests waiting for their reply
+     * @param request_timeout: Time a request waits for its reply before expiring (0 <=> never expires)
      *
      * @note Always created disabled. It is first enabled when a server is discovered.
      */
     DDSPIPE_CORE_DllAPI
     ServiceRegistry(
             const types::RpcTopic& topic,
-            const types::ParticipantId& participant_id);
+            const types::ParticipantId& participant_id,
+            const unsigned int capacity = DEFAULT_CAPACITY,
+            const std::chrono::milliseconds& request_timeout = std::chrono::milliseconds(0));
 
     //! Enable registry
     DDSPIPE_CORE_DllAPI
@@ -78,28 +91,115 @@ public:
     DDSPIPE_CORE_DllAPI
     void add(
             SequenceNumber idx,
-            std::pair<types::ParticipantId, SampleIdentity> new_entry) noexcept;
+            const std::pair<types::ParticipantHandle, SampleIdentity>& new_entry) noexcept;
+
+    /**
+     * Add entry to the registry (if key not existing).
+     *
+     * It must be called with \c get_mutex() locked, so the request can be sent and added at once.
+     */
+    DDSPIPE_CORE_DllAPI
+    void add_nts(
+            SequenceNumber idx,
+            const std::pair<types::ParticipantHandle, SampleIdentity>& new_entry) noexcept;
 
-    //! Fetch entry from the registry. Returns dummy item if not present.
+    /**
+     * Fetch entry from the registry.
+     *
+     * @return The handle of the participant that received the request and the identity of the request, or
+     * \c INVALID_PARTICIPANT_HANDLE and an unknown identity if it is not present or expired.
+     */
     DDSPIPE_CORE_DllAPI
-    std::pair<types::ParticipantId, SampleIdentity> get(
-            SequenceNumber idx) const noexcept;
+    std::pair<types::ParticipantHandle, SampleIdentity> get(
+            SequenceNumber idx) noexcept;
 
-    //! Remove entry from the registry (if present)
+    //! Remove entry from the registry (if present), once its reply has been forwarded
     DDSPIPE_CORE_DllAPI
     void erase(
             SequenceNumber idx) noexcept;
 
+    /**
+     * Remove every request that has not been replied within the request timeout.
+     *
+     * It is called periodically while adding requests, so it is not required to call it.
+     *
+     * @return Number of requests removed.
+     */
+    DDSPIPE_CORE_DllAPI
+    std::size_t reap_expired() noexcept;
+
+    /**
+     * Number of requests waiting for their reply.
+     *
+     * It does not lock the registry, so it can be checked for every request forwarded.
+     */
+    DDSPIPE_CORE_DllAPI
+    std::size_t size() const noexcept;
+
+    //! Number of requests removed because they were not replied within the request timeout
+    DDSPIPE_CORE_DllAPI
+    std::uint64_t expired_requests() const noexcept;
+
+    //! Number of requests removed because the registry was full
+    DDSPIPE_CORE_DllAPI
+    std::uint64_t evicted_requests() const noexcept;
+
     //! RpcTopic getter
     DDSPIPE_CORE_DllAPI
     types::RpcTopic topic() const noexcept;
 
     //! Get \c mutex_
     DDSPIPE_CORE_DllAPI
-    std::recursive_mutex& get_mutex() noexcept;
+    std::mutex& get_mutex() noexcept;
+
+    //! Default maximum number of requests waiting for their reply
+    static constexpr const unsigned int DEFAULT_CAPACITY = 5000;
 
 protected:
 
+    //! Information of a request forwarded, in a slot of \c slots_
+    struct Slot
+    {
+        //! Whether the slot holds a request
+        bool used = false;
+
+        //! Sequence number of the request forwarded
+        SequenceNumber sequence_number{};
+
+        //! Handle of the participant that received the request, where the reply is forwarded
+        types::ParticipantHandle participant_handle{types::INVALID_PARTICIPANT_HANDLE};
+
+        //! Identity of the original request, related to the reply
+        SampleIdentity sample_identity{};
+
+        //! Time when the request was forwarded
+        std::chrono::steady_clock::time_point request_time{};
+    };
+
+    //! Slot where the request \c idx is, or where it would be inserted
+    std::size_t find_slot_nts_(
+            const SequenceNumber& idx) const noexcept;
+
+    //! Slot where the probe of \c idx starts
+    std::size_t home_slot_nts_(
+            const SequenceNumber& idx) const noexcept;
+
+    //! Whether the request of a slot has not been replied within the request timeout
+    bool is_expired_nts_(
+            const Slot& slot,
+            const std::chrono::steady_clock::time_point& now) const noexcept;
+
+    //! Empty a slot, moving back the following ones of its probe sequence so no tombstone is needed
+    void erase_slot_nts_(
+            std::size_t slot) noexcept;
+
+    //! Remove the requests expired
+    std::size_t reap_expired_nts_(
+            const std::chrono::steady_clock::time_point& now) noexcept;
+
+    //! Remove the oldest request
+    void evict_oldest_nts_() noexcept;
+
     //! RpcTopic (service) that this ServiceRegistry manages communication
     types::RpcTopic topic_;
 
@@ -109,14 +209,37 @@ protected:
     //! Whether the registry is activated
     std::atomic<bool> enabled_;
 
-    //! Database with an entry per received request, and the information required for forwarding replies
-    std::map<SequenceNumber, std::pair<types::ParticipantId, SampleIdentity>> registry_;
+    //! Max number of requests stored
+    const std::size_t capacity_;
+
+    //! Time a request waits for its reply before expiring (0 <=> never expires)
+    const std::chrono::milliseconds request_timeout_;
+
+    /**
+     * Open-addressed hash table with linear probing, with an entry per request forwarded and the information
+     * required for forwarding its reply.
+     *
+     * Its size is a power of two at least twice \c capacity_ , so probe sequences are short.
+     */
+    std::vector<Slot> slots_;
+
+    //! Number of requests stored in \c slots_ . Only modified with \c mutex_ locked, but read without it.
+    std::atomic<std::size_t> size_;
+
+    //! Time when the expired requests are removed next
+    std::chrono::steady_clock::time_point next_reap_time_;
+
+    //! Number of requests expired
+    std::atomic<std::uint64_t> expired_requests_;
+
+    //! Number of requests evicted
+    std::atomic<std::uint64_t> evicted_requests_;
 
-    //! Default maximum number of entries stored by \c registry_ map
-    static const unsigned int DEFAULT_MAX_ENTRIES_;
+    //! Counters of the requests and replies reported to the \c ServicesMonitorProducer
+    std::shared_ptr<ServicesMonitorProducer::ServiceCounters> monitor_counters_;
 
-    //! Mutex to protect concurrent access to \c registry_
-    mutable std::recursive_mutex mutex_;
+    //! Mutex to protect concurrent access to \c slots_
+    mutable std::mutex mutex_;
 };
 
 } /* namespace core */
@@ -16,10 +16,12 @@
 
 #include <map>
 #include <set>
+#include <string>
 
 #include <cpp_utils/Formatter.hpp>
 #include <cpp_utils/macros/custom_enumeration.hpp>
 
+#include <ddspipe_core/communication/rpc/RpcDispatchPolicy.hpp>
 #include <ddspipe_core/configuration/DdsPipeLogConfiguration.hpp>
 #include <ddspipe_core/configuration/IConfiguration.hpp>
 #include <ddspipe_core/configuration/RoutesConfiguration.hpp>
@@ -27,6 +29,7 @@
 #include <ddspipe_core/types/participant/ParticipantId.hpp>
 #include <ddspipe_core/types/topic/dds/DistributedTopic.hpp>
 #include <ddspipe_core/types/topic/filter/ManualTopic.hpp>
+#include <ddspipe_core/types/topic/rpc/RpcTopic.hpp>
 
 #include <ddspipe_core/library/library_dll.h>
 
@@ -94,6 +97,15 @@ struct DdsPipeConfiguration : public IConfiguration
     std::vector<core::types::ManualTopic> get_manual_topics(
             const core::ITopic& topic) const noexcept;
 
+    /**
+     * @brief Select the \c RpcDispatchPolicy for a service.
+     *
+     * @return The dispatch policy for a specific service.
+     */
+    DDSPIPE_CORE_DllAPI
+    RpcDispatchPolicy get_rpc_dispatch_policy(
+            const types::RpcTopic& service) const noexcept;
+
     /////////////////////////
     // VARIABLES
     /////////////////////////
@@ -123,6 +135,30 @@ struct DdsPipeConfiguration : public IConfiguration
     //! The type of the entity whose discovery should trigger the discovery callbacks.
     DiscoveryTrigger discovery_trigger = DiscoveryTrigger::READER;
 
+    //! Number of threads creating the bridges of the topics discovered (0 <=> created in the discovery thread).
+    unsigned int bridge_builder_threads = 0;
+
+    //! File where the topics discovered are stored to create their bridges at startup (empty <=> no cache).
+    std::string topology_cache_file{};
+
+    //! Period in milliseconds to store the topics discovered in \c topology_cache_file .
+    unsigned int topology_cache_period = 5000;
+
+    //! Seconds a cached topic is kept without being discovered, if removing unused entities (0 <=> forever).
+    unsigned int topology_cache_expiration = 3600;
+
+    //! Max number of requests of each service waiting for their reply in each participant.
+    unsigned int rpc_max_pending_requests = 5000;
+
+    //! Milliseconds a request waits for its reply before being discarded (0 <=> forever).
+    unsigned int rpc_request_timeout = 0;
+
+    //! Policy to choose the participants each service request is forwarded to.
+    RpcDispatchPolicy rpc_dispatch_policy = RpcDispatchPolicy::BROADCAST;
+
+    //! Dispatch policies of specific services, by service name, overriding \c rpc_dispatch_policy .
+    std::map<std::string, RpcDispatchPolicy> service_dispatch_policies{};
+
     // Configuration of the Log consumers.
     DdsPipeLogConfiguration log_configuration{};
 };
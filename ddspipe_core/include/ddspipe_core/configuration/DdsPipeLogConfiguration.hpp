@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include <cpp_utils/Formatter.hpp>
 #include <cpp_utils/logging/BaseLogConfiguration.hpp>
 
@@ -24,6 +26,15 @@ namespace eprosima {
 namespace ddspipe {
 namespace core {
 
+//! What the \c DdsLogConsumer does with a log entry when its publishing queue is full
+enum class LogQueueOverflowPolicy
+{
+    //! Discard the oldest entry queued to make room for the new one
+    drop_oldest,
+    //! Discard the new entry
+    drop_newest,
+};
+
 /**
  * The collection of settings related to the DDS Pipe's Log consumers.
  *
@@ -56,6 +67,24 @@ struct DdsPipeLogConfiguration : public utils::BaseLogConfiguration
     DdsPublishingConfiguration publish;
 
     bool stdout_enable = true;
+
+    //! Max number of log entries waiting to be published (0 = publish them in the thread that logs them)
+    std::size_t publish_queue_size = 4096;
+
+    //! What to do with a log entry when the publishing queue is full
+    LogQueueOverflowPolicy publish_queue_overflow_policy = LogQueueOverflowPolicy::drop_newest;
+
+    //! Number of log entries queued that wake up the publishing thread before \c publish_batch_period expires
+    unsigned int publish_batch_size = 1;
+
+    //! Max time (in milliseconds) a log entry waits in the publishing queue
+    unsigned int publish_batch_period = 100;
+
+    //! Times each throttled call site logs per \c throttle_window (0 = never throttle)
+    unsigned int throttle_max_occurrences = 10;
+
+    //! Length (in milliseconds) of the window of the throttled call sites
+    unsigned int throttle_window = 1000;
 };
 
 } /* namespace core */
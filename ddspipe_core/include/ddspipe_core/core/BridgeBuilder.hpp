@@ -0,0 +1,118 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/memory/Heritable.hpp>
+
+#include <ddspipe_core/library/library_dll.h>
+#include <ddspipe_core/types/topic/dds/DistributedTopic.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+/**
+ * BridgeBuilder creates the \c DdsBridge of the topics pushed in its own threads.
+ *
+ * Creating a bridge creates a reader and a writer in every participant, which may take several milliseconds.
+ * The builder takes this work out of the discovery thread, and creates the bridges of different topics concurrently.
+ *
+ * The builder does not know how bridges are created nor where they are stored: it calls the build function with
+ * each topic pushed. The owner must not push a topic again until its build function has been called.
+ */
+class BridgeBuilder
+{
+public:
+
+    //! Function that creates the bridge of a topic
+    using BuildFunction = std::function<void (const utils::Heritable<types::DistributedTopic>&)>;
+
+    /**
+     * BridgeBuilder constructor by required values.
+     *
+     * It starts the threads right away.
+     *
+     * @param n_threads:  Number of bridges created at the same time
+     * @param build:      Function called with each topic pushed
+     */
+    DDSPIPE_CORE_DllAPI
+    BridgeBuilder(
+            const unsigned int n_threads,
+            const BuildFunction& build);
+
+    /**
+     * @brief Destructor
+     *
+     * It stops the builder.
+     */
+    DDSPIPE_CORE_DllAPI
+    ~BridgeBuilder();
+
+    /**
+     * Add a topic whose bridge must be created.
+     *
+     * Topics are built in the order they are pushed, although several of them may be built at the same time.
+     *
+     * Thread safe
+     */
+    DDSPIPE_CORE_DllAPI
+    void push(
+            const utils::Heritable<types::DistributedTopic>& topic) noexcept;
+
+    /**
+     * Stop the builder.
+     *
+     * The topics not built yet are discarded, and it waits for the bridges being built.
+     * The build function must not wait for the caller of this method, or it would deadlock.
+     *
+     * Thread safe
+     */
+    DDSPIPE_CORE_DllAPI
+    void stop() noexcept;
+
+protected:
+
+    //! Routine of every thread: build the topics pushed until the builder stops
+    void thread_routine_() noexcept;
+
+    //! Function called with each topic pushed
+    const BuildFunction build_;
+
+    //! Topics waiting to be built
+    std::deque<utils::Heritable<types::DistributedTopic>> topics_;
+
+    //! Whether the threads must stop
+    bool exit_;
+
+    //! Mutex guarding \c topics_ and \c exit_
+    std::mutex mutex_;
+
+    //! Condition variable to awake the threads when a topic is pushed or the builder stops
+    std::condition_variable cv_;
+
+    //! Threads building the bridges
+    std::vector<std::thread> threads_;
+};
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -14,17 +14,23 @@
 
 #pragma once
 
+#include <chrono>
+#include <functional>
 #include <memory>
+#include <vector>
 
+#include <cpp_utils/event/PeriodicEventHandler.hpp>
 #include <cpp_utils/ReturnCode.hpp>
 #include <cpp_utils/thread_pool/pool/SlotThreadPool.hpp>
 
 #include <ddspipe_core/communication/dds/DdsBridge.hpp>
 #include <ddspipe_core/communication/rpc/RpcBridge.hpp>
 #include <ddspipe_core/configuration/DdsPipeConfiguration.hpp>
+#include <ddspipe_core/core/BridgeBuilder.hpp>
 #include <ddspipe_core/dynamic/AllowedTopicList.hpp>
 #include <ddspipe_core/dynamic/DiscoveryDatabase.hpp>
 #include <ddspipe_core/dynamic/ParticipantsDatabase.hpp>
+#include <ddspipe_core/dynamic/TopologyCache.hpp>
 #include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
 
 #include <ddspipe_core/library/library_dll.h>
@@ -159,6 +165,16 @@ public:
             const std::string& topic_name,
             const std::string& expression);
 
+    /**
+     * @brief Times since each topic was discovered until its bridge was created and forwarded its first data.
+     *
+     * Bridges still being created are not included.
+     *
+     * @return Metrics of every bridge indexed by its topic.
+     */
+    DDSPIPE_CORE_DllAPI
+    std::map<utils::Heritable<types::DistributedTopic>, DdsBridgeMetrics> bridges_metrics();
+
 protected:
 
     /////////////////////////
@@ -280,6 +296,23 @@ protected:
     void init_bridges_nts_(
             const std::set<utils::Heritable<types::DistributedTopic>>& builtin_topics);
 
+    /**
+     * @brief Create a disabled bridge for every allowed topic in the topology cache
+     *
+     * Topics that have expired are discarded. The cache is then stored every \c topology_cache_period .
+     */
+    void init_topology_cache_nts_();
+
+    /**
+     * @brief Store the current topology in the topology cache.
+     *
+     * Method called periodically. The topics discovered are stored with the current time, and the cached topics
+     * not discovered again keep their time until they expire.
+     * If removing unused entities, the topics that have not been discovered for \c topology_cache_expiration are
+     * removed, together with their bridge.
+     */
+    void save_topology_cache_() noexcept;
+
     /////////////////////////
     // INTERNAL AUXILIARY METHODS
     /////////////////////////
@@ -333,12 +366,53 @@ protected:
      *
      * It is created enabled if the DdsPipe is enabled.
      *
+     * If there is a \c bridge_builder_ , the bridge is created later in its threads, and it is pending until then.
+     *
      * @param [in] topic : new topic
      */
     void create_new_bridge_nts_(
             const utils::Heritable<types::DistributedTopic>& topic,
             bool enabled = false) noexcept;
 
+    /**
+     * @brief Construct the \c DdsBridge of a topic.
+     *
+     * It only reads the configuration, so it does not need \c mutex_ .
+     *
+     * @param [in] topic : topic of the bridge
+     *
+     * @return The new bridge, or \c nullptr if its creation failed.
+     */
+    std::unique_ptr<DdsBridge> new_bridge_(
+            const utils::Heritable<types::DistributedTopic>& topic) noexcept;
+
+    /**
+     * @brief Create the pending bridge of a topic.
+     *
+     * Method called from the threads of \c bridge_builder_ .
+     * The bridge is constructed without \c mutex_ , so the discovery is not blocked meanwhile. Then the operations
+     * requested while it was pending are applied in order, and it is moved to \c bridges_ .
+     *
+     * @param [in] topic : topic of the pending bridge
+     */
+    void build_bridge_(
+            const utils::Heritable<types::DistributedTopic>& topic) noexcept;
+
+    /**
+     * @brief Apply an operation to the bridge of a topic.
+     *
+     * If the bridge is pending, the operation is stored and applied when it is created, so the operations of a
+     * topic keep their order.
+     *
+     * @param [in] topic : topic of the bridge
+     * @param [in] operation : operation to apply
+     *
+     * @return Whether the bridge exists or is pending.
+     */
+    bool apply_to_bridge_nts_(
+            const utils::Heritable<types::DistributedTopic>& topic,
+            const std::function<void(DdsBridge&)>& operation);
+
     /**
      * @brief Create a new \c RpcBridge object
      *
@@ -437,6 +511,36 @@ protected:
     //! Map of RPC bridges indexed by their topic
     std::map<types::RpcTopic, std::unique_ptr<RpcBridge>> rpc_bridges_;
 
+    //! Bridge whose creation has been requested to \c bridge_builder_
+    struct PendingBridge
+    {
+        //! Time when its creation was requested
+        std::chrono::steady_clock::time_point discovery_time;
+
+        //! Operations to apply to the bridge once created, in the order they were requested
+        std::vector<std::function<void(DdsBridge&)>> operations;
+    };
+
+    //! Map of bridges being created by \c bridge_builder_ indexed by their topic
+    std::map<utils::Heritable<types::DistributedTopic>, PendingBridge> pending_bridges_;
+
+    /**
+     * @brief Threads creating the bridges of the topics discovered
+     *
+     * It is only set if \c bridge_builder_threads is configured. Otherwise bridges are created in the thread that
+     * discovers their topic.
+     */
+    std::unique_ptr<BridgeBuilder> bridge_builder_;
+
+    //! File where the topology is stored. Only set if \c topology_cache_file is configured.
+    std::unique_ptr<TopologyCache> topology_cache_;
+
+    //! Topics in the topology cache, with the last time each one was discovered
+    TopologyCache::Topology cached_topology_;
+
+    //! Event that stores the topology cache periodically
+    std::unique_ptr<utils::event::PeriodicEventHandler> topology_cache_event_;
+
     /**
      * @brief List of topics discovered
      *
@@ -19,11 +19,13 @@
 #include <mutex>
 #include <string>
 #include <set>
+#include <utility>
 
 #include <cpp_utils/memory/Heritable.hpp>
 
 #include <ddspipe_core/types/topic/Topic.hpp>
 #include <ddspipe_core/types/topic/rpc/RpcTopic.hpp>
+#include <ddspipe_core/types/topic/filter/FilterTopicIndex.hpp>
 #include <ddspipe_core/types/topic/filter/IFilterTopic.hpp>
 #include <ddspipe_core/types/topic/dds/DistributedTopic.hpp>
 
@@ -38,6 +40,10 @@ namespace core {
  *
  * In case of an empty allowlist, every topic is allowed except those in blocklist.
  * In case of both lists empty, every topic is allowed.
+ *
+ * The lists are compiled in a \c FilterTopicIndex each, so only the filters that may match a topic name are checked.
+ * The decision for each topic name and type name is memoized, as the lists do not change until they are cleared or
+ * the object is reassigned (e.g. when the configuration is reloaded).
  */
 class AllowedTopicList
 {
@@ -130,9 +136,28 @@ protected:
     //! List of topics that are allowed
     std::set<utils::Heritable<types::IFilterTopic>> allowlist_;
 
+    //! Compile the lists in their indexes and forget the memoized decisions
+    void compile_nts_() noexcept;
+
+    //! Whether \c topic is allowed by the lists, without memoizing the decision
+    bool is_topic_allowed_nts_(
+            const ITopic& topic) const noexcept;
+
+    //! Index of the topics that are not allowed
+    types::FilterTopicIndex blocklist_index_;
+
+    //! Index of the topics that are allowed
+    types::FilterTopicIndex allowlist_index_;
+
+    //! Decisions already taken, by topic name and type name
+    mutable std::map<std::pair<std::string, std::string>, bool> decisions_;
+
     //! Mutex to restrict access to the class
     mutable std::recursive_mutex mutex_;
 
+    //! Max decisions memoized. When reached, the memoized decisions are forgotten.
+    static constexpr const std::size_t MAX_DECISIONS = 100000;
+
     // Allow operator << to use private variables
     DDSPIPE_CORE_DllAPI
     friend std::ostream& operator <<(
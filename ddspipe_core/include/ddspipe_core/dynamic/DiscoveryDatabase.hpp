@@ -16,6 +16,7 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <mutex>
@@ -23,12 +24,14 @@
 #include <shared_mutex>
 #include <string>
 #include <thread>
+#include <tuple>
 
 #include <cpp_utils/queue/DBQueue.hpp>
 #include <cpp_utils/ReturnCode.hpp>
 
 #include <ddspipe_core/types/dds/Endpoint.hpp>
 #include <ddspipe_core/types/dds/Guid.hpp>
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
 #include <ddspipe_core/types/topic/dds/DistributedTopic.hpp>
 
 namespace eprosima {
@@ -50,6 +53,9 @@ class DiscoveryDatabase
 {
 public:
 
+    //! Identifier of a callback added to the database, used to remove it
+    using CallbackId = std::uint64_t;
+
     /**
      * @brief Construct a new DiscoveryDatabase object
      *
@@ -91,6 +97,8 @@ public:
     /**
      * @brief Whether a topic exists in any Endpoint in the database
      *
+     * It uses an index of the endpoints by topic, so it does not go through every endpoint.
+     *
      * @param [in] topic: topic to check if it exists
      * @return true if any endpoint has this topic, false otherwise
      */
@@ -169,39 +177,83 @@ public:
     /**
      * @brief Get the endpoints that pass the given filter
      *
+     * @note It goes through every endpoint in the database. Use \c active_endpoints_count to check how many active
+     * endpoints there are in a topic.
+     *
      * @return A map with the endpoints that pass the filter
      */
     DDSPIPE_CORE_DllAPI
     std::map<types::Guid, types::Endpoint> get_endpoints(
             std::function<bool(const types::Endpoint&)> is_valid_endpoint) const noexcept;
 
+    /**
+     * @brief Number of active endpoints of a kind in a topic, discovered by a participant
+     *
+     * It uses an index of the active endpoints, so it does not go through every endpoint.
+     *
+     * @param [in] topic: topic of the endpoints
+     * @param [in] discoverer_participant_id: participant that discovered the endpoints
+     * @param [in] kind: kind of the endpoints
+     */
+    DDSPIPE_CORE_DllAPI
+    std::size_t active_endpoints_count(
+            const types::DdsTopic& topic,
+            const types::ParticipantId& discoverer_participant_id,
+            const types::EndpointKind kind) const noexcept;
+
+    /**
+     * @brief Whether an endpoint is active in the database, in a topic and discovered by a participant
+     *
+     * It uses the same index as \c active_endpoints_count .
+     *
+     * @param [in] endpoint: endpoint whose guid, topic, kind and discoverer participant are looked up
+     */
+    DDSPIPE_CORE_DllAPI
+    bool is_endpoint_active(
+            const types::Endpoint& endpoint) const noexcept;
+
     /**
      * @brief Add callback to be called when discovering an Endpoint
      *
      * @param [in] endpoint_discovered_callback: callback to add
+     * @return id to remove the callback with \c remove_callback
      */
     DDSPIPE_CORE_DllAPI
-    void add_endpoint_discovered_callback(
+    CallbackId add_endpoint_discovered_callback(
             std::function<void(types::Endpoint)> endpoint_discovered_callback) noexcept;
 
     /**
      * @brief Add callback to be called when an Endpoint has been updated
      *
      * @param [in] endpoint_updated_callback: callback to add
+     * @return id to remove the callback with \c remove_callback
      */
     DDSPIPE_CORE_DllAPI
-    void add_endpoint_updated_callback(
+    CallbackId add_endpoint_updated_callback(
             std::function<void(types::Endpoint)> endpoint_updated_callback) noexcept;
 
     /**
      * @brief Add callback to be called when an Endpoint has been erased
      *
      * @param [in] endpoint_erased_callback: callback to add
+     * @return id to remove the callback with \c remove_callback
      */
     DDSPIPE_CORE_DllAPI
-    void add_endpoint_erased_callback(
+    CallbackId add_endpoint_erased_callback(
             std::function<void(types::Endpoint)> endpoint_erased_callback) noexcept;
 
+    /**
+     * @brief Remove a callback of any type
+     *
+     * Once this method returns, the callback is not being called and it will not be called again.
+     * It must not be called from inside a callback.
+     *
+     * @param [in] callback_id: id returned when the callback was added
+     */
+    DDSPIPE_CORE_DllAPI
+    void remove_callback(
+            CallbackId callback_id) noexcept;
+
     /**
      * @brief Remove all callbacks from all types (endpoint discovered, updated and erased)
      *
@@ -261,25 +313,49 @@ protected:
     DDSPIPE_CORE_DllAPI
     void process_queue_() noexcept;
 
+    //! Key of \c active_endpoints_index_ : unique name of the topic, discoverer participant and kind
+    using ActiveEndpointsKey = std::tuple<std::string, types::ParticipantId, types::EndpointKind>;
+
+    //! Key of \c active_endpoints_index_ for \c endpoint
+    static ActiveEndpointsKey active_endpoints_key_(
+            const types::Endpoint& endpoint) noexcept;
+
+    //! Add an endpoint stored in \c entities_ to the indexes. Must be called with \c mutex_ locked.
+    void index_endpoint_nts_(
+            const types::Endpoint& endpoint) noexcept;
+
+    //! Remove an endpoint stored in \c entities_ from the indexes. Must be called with \c mutex_ locked.
+    void unindex_endpoint_nts_(
+            const types::Endpoint& endpoint) noexcept;
+
     //! Database of endpoints indexed by guid
     std::map<types::Guid, types::Endpoint> entities_;
 
+    //! Number of endpoints in \c entities_ of each topic, by topic unique name
+    std::map<std::string, std::size_t> topics_index_;
+
+    //! Guids of the active endpoints in \c entities_ , by topic, discoverer participant and kind
+    std::map<ActiveEndpointsKey, std::set<types::Guid>> active_endpoints_index_;
+
     //! Database of filtered endpoint GUIDs
     std::set<types::Guid> entities_filter_;
 
     //! Mutex to guard queries to the database
     mutable std::shared_timed_mutex mutex_;
 
-    //! Vector of callbacks to be called when an Endpoint is added
-    std::vector<std::function<void(types::Endpoint)>> added_endpoint_callbacks_;
+    //! Callbacks to be called when an Endpoint is added, in the order they were added
+    std::map<CallbackId, std::function<void(types::Endpoint)>> added_endpoint_callbacks_;
+
+    //! Callbacks to be called when an Endpoint is updated, in the order they were added
+    std::map<CallbackId, std::function<void(types::Endpoint)>> updated_endpoint_callbacks_;
 
-    //! Vector of callbacks to be called when an Endpoint is updated
-    std::vector<std::function<void(types::Endpoint)>> updated_endpoint_callbacks_;
+    //! Callbacks to be called when an Endpoint is erased, in the order they were added
+    std::map<CallbackId, std::function<void(types::Endpoint)>> erased_endpoint_callbacks_;
 
-    //! Vector of callbacks to be called when an Endpoint is erased
-    std::vector<std::function<void(types::Endpoint)>> erased_endpoint_callbacks_;
+    //! Id of the next callback added
+    CallbackId next_callback_id_;
 
-    //! Mutex to guard callbacks vectors
+    //! Mutex to guard callbacks maps
     mutable std::mutex callbacks_mutex_;
 
     //! Queue storing database operations to be performed in a dedicated thread
@@ -0,0 +1,85 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <string>
+
+#include <ddspipe_core/library/library_dll.h>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+/**
+ * Snapshot of the topics discovered by a \c DdsPipe , stored in a local file.
+ *
+ * The \c DdsPipe stores its topology periodically, and creates the bridges of the topics stored when it starts, so
+ * it forwards data before the discovery completes.
+ *
+ * Each topic is stored with its type, its QoS, the participant that discovered it, and the last time it was
+ * discovered, so the topics that are not discovered anymore can expire.
+ * The type identifiers are not stored: they are taken from the discovery of the type, as for builtin topics.
+ */
+class TopologyCache
+{
+public:
+
+    //! Topics stored, with the last time each one was discovered
+    using Topology = std::map<types::DdsTopic, std::chrono::system_clock::time_point>;
+
+    /**
+     * TopologyCache constructor by required values.
+     *
+     * @param file_name: File where the topology is stored
+     */
+    DDSPIPE_CORE_DllAPI
+    TopologyCache(
+            const std::string& file_name);
+
+    /**
+     * Read the topology stored in the file.
+     *
+     * @return The topics stored. It is empty if the file does not exist, and it skips the entries not well-formed.
+     */
+    DDSPIPE_CORE_DllAPI
+    Topology load() const noexcept;
+
+    /**
+     * Store a topology in the file, replacing the previous one.
+     *
+     * The topology is written in a temporary file first, so a reader never finds a file half written.
+     *
+     * @return Whether the topology has been stored.
+     */
+    DDSPIPE_CORE_DllAPI
+    bool save(
+            const Topology& topology) const noexcept;
+
+    //! First line of the files written by this version
+    DDSPIPE_CORE_DllAPI
+    static const std::string FILE_HEADER;
+
+protected:
+
+    //! File where the topology is stored
+    const std::string file_name_;
+};
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
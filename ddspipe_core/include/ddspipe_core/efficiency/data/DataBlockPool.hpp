@@ -0,0 +1,137 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+#include <ddspipe_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+/**
+ * This class recycles the memory of objects of a fixed size, so creating and destroying them repeatedly does not
+ * allocate memory once enough blocks have been released.
+ *
+ * It is meant to back the class specific \c operator \c new and \c operator \c delete of the routing data, so the
+ * objects can still be owned by a \c std::unique_ptr with its default deleter.
+ *
+ * Requests of a size bigger than \c block_size (e.g. derived classes) are not recycled.
+ * The number of blocks kept to be reused is bounded by \c max_free_blocks .
+ *
+ * This class is thread safe, as objects are usually created in the reader threads and destroyed in the Track ones.
+ * Free blocks are split in shards selected by the calling thread, so threads creating and destroying objects at the
+ * same time rarely contend for the same mutex. When a shard is full, half of it is moved to a shared depot, and when
+ * it is empty it is refilled from the depot, so blocks released by a thread can be reused by others.
+ */
+class DataBlockPool
+{
+public:
+
+    /**
+     * @brief Construct a DataBlockPool
+     *
+     * @param block_size size in bytes of the blocks recycled.
+     * @param max_free_blocks max number of released blocks kept to be reused.
+     */
+    DDSPIPE_CORE_DllAPI
+    DataBlockPool(
+            std::size_t block_size,
+            std::size_t max_free_blocks = DEFAULT_MAX_FREE_BLOCKS);
+
+    //! Free every block kept to be reused
+    DDSPIPE_CORE_DllAPI
+    ~DataBlockPool();
+
+    /**
+     * @brief Get a block of at least \c size bytes.
+     *
+     * A released block is reused if there is any.
+     *
+     * @throw \c std::bad_alloc if the memory could not be allocated, as \c operator \c new does.
+     */
+    DDSPIPE_CORE_DllAPI
+    void* allocate(
+            std::size_t size);
+
+    /**
+     * @brief Release a block got from \c allocate with the same \c size .
+     *
+     * The block is kept to be reused unless there are already \c max_free_blocks .
+     */
+    DDSPIPE_CORE_DllAPI
+    void deallocate(
+            void* block,
+            std::size_t size) noexcept;
+
+    //! Number of released blocks currently kept to be reused
+    DDSPIPE_CORE_DllAPI
+    std::size_t free_blocks() const noexcept;
+
+    //! Default max number of released blocks kept to be reused
+    DDSPIPE_CORE_DllAPI
+    static constexpr const std::size_t DEFAULT_MAX_FREE_BLOCKS = 4096;
+
+    //! Number of shards the free blocks are split in
+    DDSPIPE_CORE_DllAPI
+    static constexpr const unsigned int N_SHARDS = 8;
+
+    //! Max free blocks kept in a shard before moving half of them to the depot
+    DDSPIPE_CORE_DllAPI
+    static constexpr const std::size_t SHARD_CAPACITY = 32;
+
+protected:
+
+    //! Free blocks guarded by their own mutex. In its own cache line so shards do not false share.
+    struct alignas(64) FreeList
+    {
+        std::mutex mutex;
+        std::vector<void*> blocks;
+    };
+
+    //! Free list of the shard of the calling thread
+    FreeList& shard_free_list_() noexcept;
+
+    //! Take a free block, or nullptr if there is none. Lock the shard, and the depot after it if needed.
+    void* pop_block_() noexcept;
+
+    //! Keep a free block. Return false if it must be freed instead. Lock the shard, and the depot after it if needed.
+    bool push_block_(
+            void* block) noexcept;
+
+    //! Size in bytes of the blocks recycled
+    const std::size_t block_size_;
+
+    //! Max number of released blocks kept to be reused
+    const std::size_t max_free_blocks_;
+
+    //! Free lists of every shard
+    std::array<FreeList, N_SHARDS> shards_;
+
+    //! Free list shared by every thread
+    FreeList depot_;
+
+    //! Number of blocks currently kept in the free lists
+    std::atomic<std::size_t> free_blocks_;
+};
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
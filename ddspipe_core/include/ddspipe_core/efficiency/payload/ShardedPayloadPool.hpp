@@ -0,0 +1,171 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+/**
+ * @brief PayloadPool with the behaviour of \c MapPayloadPool that does not serialize every thread in a single mutex.
+ *
+ * As \c MapPayloadPool , it stores every data that has been reserved and the number of payloads that reference it.
+ * Each get increases the counter, each release decreases it, and the data is freed when it reaches 0.
+ *
+ * The data is indexed by the hash of its pointer in \c N_SHARDS shards, each with its own mutex and open addressing
+ * table, so threads getting and releasing different payloads rarely contend for the same mutex.
+ */
+class ShardedPayloadPool : public PayloadPool
+{
+public:
+
+    //! Use parent constructor
+    using PayloadPool::PayloadPool;
+
+    //! Destroy pool and release every data that has not been released yet.
+    DDSPIPE_CORE_DllAPI
+    ~ShardedPayloadPool();
+
+    /**
+     * @brief Reserve new memory of size \c size for this payload.
+     *
+     * Add a new entry in the shard of the new data and set its counter to 1.
+     *
+     * @param size size of the new chunk of data
+     * @param payload object to store the new data
+     *
+     * @return true if everything OK
+     * @return false if something went wrong
+     */
+    DDSPIPE_CORE_DllAPI
+    bool get_payload(
+            uint32_t size,
+            eprosima::fastdds::rtps::SerializedPayload_t& payload) override;
+
+    /**
+     * @brief Set \c target_payload data to \c src_payload .
+     *
+     * In case \c data_owner is \c this , \c target_payload points to the same data as \c src_payload , saving
+     * a reserve and a copy, and increase the reference counter.
+     * Otherwise, new data is reserved and the data is copied to \c target_payload .
+     *
+     * @param [in,out] src_payload     Payload to move to target
+     * @param [in,out] target_payload  Payload to assign the payload to
+     *
+     * @return true if everything OK
+     * @return false if something went wrong
+     *
+     * @throw utils::InconsistencyException if \c data_owner is \c this but the data in \c src_payload is not from this pool.
+     */
+    DDSPIPE_CORE_DllAPI
+    bool get_payload(
+            const eprosima::fastdds::rtps::SerializedPayload_t& src_payload,
+            eprosima::fastdds::rtps::SerializedPayload_t& target_payload) override;
+
+    /**
+     * @brief Decrease reference counter for data in \c payload .
+     *
+     * If this was the last payload that was referencing the data, this is released.
+     *
+     * @param payload payload to release
+     *
+     * @return true if everything OK
+     * @return false if something went wrong
+     *
+     * @throw utils::InconsistencyException if the data in \c payload is not from this pool.
+     */
+    DDSPIPE_CORE_DllAPI
+    bool release_payload(
+            eprosima::fastdds::rtps::SerializedPayload_t& payload) override;
+
+    //! Log2 of the number of shards
+    DDSPIPE_CORE_DllAPI
+    static constexpr const unsigned int SHARD_BITS = 4;
+
+    //! Number of shards the data reserved is split in
+    DDSPIPE_CORE_DllAPI
+    static constexpr const unsigned int N_SHARDS = 1u << SHARD_BITS;
+
+    //! Number of slots of the table of each shard before it grows
+    DDSPIPE_CORE_DllAPI
+    static constexpr const std::size_t INITIAL_SHARD_SLOTS = 16;
+
+protected:
+
+    //! Slot of the table of a shard
+    struct Entry
+    {
+        //! Data reserved, or nullptr if the slot is free
+        types::PayloadUnit* data = nullptr;
+
+        //! Number of payloads that currently reference the data
+        uint32_t references = 0;
+    };
+
+    //! Data reserved whose pointer hashes to the same shard. In its own cache line so shards do not false share.
+    struct alignas(64) Shard
+    {
+        //! Guards the rest of the shard
+        std::mutex mutex;
+
+        //! Open addressing table with linear probing. Its size is a power of two, at least twice \c size .
+        std::vector<Entry> slots = std::vector<Entry>(INITIAL_SHARD_SLOTS);
+
+        //! Number of slots in use
+        std::size_t size = 0;
+    };
+
+    //! Hash of the pointer of a data. The highest \c SHARD_BITS bits select the shard, and the next ones the slot.
+    static uint64_t hash_(
+            const types::PayloadUnit* data) noexcept;
+
+    //! Shard of \c data
+    Shard& shard_(
+            const types::PayloadUnit* data) noexcept;
+
+    //! Entry of \c data in \c shard , or nullptr if it is not stored
+    static Entry* find_nts_(
+            Shard& shard,
+            const types::PayloadUnit* data) noexcept;
+
+    //! Store \c data in \c shard with a single reference. \c data must not be stored yet.
+    static void insert_nts_(
+            Shard& shard,
+            types::PayloadUnit* data);
+
+    //! Remove \c entry from \c shard , shifting back the entries of its cluster so no tombstones are needed
+    static void erase_nts_(
+            Shard& shard,
+            Entry* entry) noexcept;
+
+    //! First slot of \c shard where \c data may be
+    static std::size_t home_slot_(
+            const Shard& shard,
+            const types::PayloadUnit* data) noexcept;
+
+    //! Store every data reserved and the number of payloads that currently reference it.
+    std::array<Shard, N_SHARDS> shards_;
+};
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,178 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include <ddspipe_core/efficiency/payload/FastPayloadPool.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+/**
+ * This class implements a \c FastPayloadPool that recycles the memory of released payloads instead of freeing it.
+ *
+ * Memory is reserved in power-of-two size classes. When the last reference to a payload is released, its block is
+ * kept in a free list of its size class, and it is reused by the next payload of the same size class.
+ *
+ * Free lists are split in shards selected by the calling thread, so threads reserving and releasing payloads at the
+ * same time rarely contend for the same mutex. Blocks that do not fit in a shard go to a shared depot, that is looked
+ * up when the shard of a thread is empty.
+ *
+ * The memory kept in free lists is bounded by \c max_retained_memory . Blocks that exceed it, and payloads bigger
+ * than the biggest size class, are freed as in \c FastPayloadPool .
+ *
+ * The reference counting of payloads is the one of \c FastPayloadPool , so it has the same thread safety guarantees.
+ */
+class SlabPayloadPool : public FastPayloadPool
+{
+public:
+
+    /**
+     * @brief Construct a SlabPayloadPool
+     *
+     * @param max_retained_memory max bytes of released payloads kept to be reused.
+     */
+    DDSPIPE_CORE_DllAPI
+    SlabPayloadPool(
+            std::size_t max_retained_memory = DEFAULT_MAX_RETAINED_MEMORY);
+
+    //! Free every block kept to be reused
+    DDSPIPE_CORE_DllAPI
+    virtual ~SlabPayloadPool();
+
+    //! Bytes of released payloads currently kept to be reused
+    DDSPIPE_CORE_DllAPI
+    std::size_t retained_memory() const noexcept;
+
+    //! Default max bytes of released payloads kept to be reused (64 MiB)
+    DDSPIPE_CORE_DllAPI
+    static constexpr const std::size_t DEFAULT_MAX_RETAINED_MEMORY = 64 * 1024 * 1024;
+
+    //! Log2 of the size of the smallest size class (64 B)
+    DDSPIPE_CORE_DllAPI
+    static constexpr const unsigned int MIN_SIZE_CLASS_BITS = 6;
+
+    //! Log2 of the size of the biggest size class (1 MiB)
+    DDSPIPE_CORE_DllAPI
+    static constexpr const unsigned int MAX_SIZE_CLASS_BITS = 20;
+
+    //! Number of size classes
+    DDSPIPE_CORE_DllAPI
+    static constexpr const unsigned int N_SIZE_CLASSES = MAX_SIZE_CLASS_BITS - MIN_SIZE_CLASS_BITS + 1;
+
+    //! Number of shards the free lists are split in
+    DDSPIPE_CORE_DllAPI
+    static constexpr const unsigned int N_SHARDS = 8;
+
+    //! Max blocks of each size class kept in a shard before moving them to the depot
+    DDSPIPE_CORE_DllAPI
+    static constexpr const std::size_t SHARD_CAPACITY = 32;
+
+protected:
+
+    /**
+     * @brief Data stored at the beginning of every block, right before the payload data.
+     *
+     * The reference counter must be the last field, as \c FastPayloadPool expects it right before the data.
+     */
+    struct BlockHeader
+    {
+        //! Size class of the block, or \c N_SIZE_CLASSES if it is not recycled
+        std::uint32_t size_class;
+
+        //! Number of payloads referencing the block
+        MetaInfoType references;
+    };
+
+    //! Free blocks of a single size class
+    struct FreeList
+    {
+        std::mutex mutex;
+        std::vector<BlockHeader*> blocks;
+    };
+
+    /**
+     * @brief Reimplement parent \c reserve_ method
+     *
+     * The block is taken from the free lists of its size class, or allocated if there is none.
+     *
+     * @param size size of memory chunk to reserve
+     * @param payload object where introduce the new data pointer
+     *
+     * @return true if everything ok
+     * @return false if something went wrong
+     */
+    DDSPIPE_CORE_DllAPI
+    virtual bool reserve_(
+            uint32_t size,
+            eprosima::fastdds::rtps::SerializedPayload_t& payload) override;
+
+    /**
+     * @brief Reimplement parent \c release_ method
+     *
+     * The block is kept in the free lists of its size class, unless it would exceed \c max_retained_memory_ .
+     *
+     * @param payload object to free the data from
+     *
+     * @return true if everything ok
+     * @return false if something went wrong
+     */
+    DDSPIPE_CORE_DllAPI
+    virtual bool release_(
+            eprosima::fastdds::rtps::SerializedPayload_t& payload) override;
+
+    //! Size class of a block of \c block_size bytes, or \c N_SIZE_CLASSES if it is too big
+    static unsigned int size_class_(
+            std::size_t block_size) noexcept;
+
+    //! Size in bytes of the blocks of \c size_class
+    static std::size_t block_size_(
+            unsigned int size_class) noexcept;
+
+    //! Free list of \c size_class in the shard of the calling thread
+    FreeList& shard_free_list_(
+            unsigned int size_class) noexcept;
+
+    //! Take a free block of \c size_class , or nullptr if there is none
+    BlockHeader* pop_block_(
+            unsigned int size_class) noexcept;
+
+    //! Keep a free block of \c size_class . Return false if it must be freed instead.
+    bool push_block_(
+            unsigned int size_class,
+            BlockHeader* block) noexcept;
+
+    //! Free lists of every shard
+    std::array<std::array<FreeList, N_SIZE_CLASSES>, N_SHARDS> shards_;
+
+    //! Free lists shared by every thread
+    std::array<FreeList, N_SIZE_CLASSES> depot_;
+
+    //! Max bytes kept in free lists
+    const std::size_t max_retained_memory_;
+
+    //! Bytes currently kept in free lists
+    std::atomic<std::size_t> retained_memory_;
+};
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
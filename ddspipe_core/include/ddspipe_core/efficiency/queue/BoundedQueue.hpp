@@ -0,0 +1,114 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+/**
+ * Bounded multi-producer multi-consumer queue that does not take any lock.
+ *
+ * Each cell of a fixed ring holds a sequence number that tells producers and consumers whether it is free or
+ * full in the current lap, so they only contend on the atomic position they advance.
+ * The memory of the values is reserved at construction, and values are moved in and out of their cells.
+ *
+ * @tparam T Type of the values. It must be default constructible and move assignable.
+ */
+template <typename T>
+class BoundedQueue
+{
+public:
+
+    /**
+     * BoundedQueue constructor by capacity.
+     *
+     * @param capacity: Max number of values in the queue. It is rounded up to a power of two (at least 2).
+     */
+    explicit BoundedQueue(
+            std::size_t capacity);
+
+    BoundedQueue(
+            const BoundedQueue&) = delete;
+    BoundedQueue& operator =(
+            const BoundedQueue&) = delete;
+
+    /**
+     * Add a value at the end of the queue, if it is not full.
+     *
+     * @return \c true if the value has been added, \c false if the queue is full (\c value is not moved).
+     *
+     * Thread safe
+     */
+    bool try_push(
+            T&& value);
+
+    /**
+     * Take the value at the front of the queue, if it is not empty.
+     *
+     * @return \c true if a value has been moved to \c value , \c false if the queue is empty.
+     *
+     * Thread safe
+     */
+    bool try_pop(
+            T& value);
+
+    //! Max number of values in the queue
+    std::size_t capacity() const noexcept;
+
+    //! Number of values in the queue. It is only approximated while other threads push or pop.
+    std::size_t size() const noexcept;
+
+protected:
+
+    //! Slot of the ring
+    struct Cell
+    {
+        /**
+         * Position this cell is ready for.
+         *
+         * Equal to the enqueue position when it is free, and to the dequeue position + 1 when it holds a value.
+         */
+        std::atomic<std::size_t> sequence;
+
+        T value;
+    };
+
+    //! Smallest power of two not lower than \c capacity (and at least 2)
+    static std::size_t ring_size_(
+            std::size_t capacity) noexcept;
+
+    //! Cells of the ring
+    std::unique_ptr<Cell[]> cells_;
+
+    //! Number of cells - 1, to wrap the positions
+    const std::size_t mask_;
+
+    //! Position of the next value pushed, in its own cache line so producers do not slow down consumers
+    alignas(64) std::atomic<std::size_t> enqueue_pos_;
+
+    //! Position of the next value popped
+    alignas(64) std::atomic<std::size_t> dequeue_pos_;
+};
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
+
+#include <ddspipe_core/efficiency/queue/impl/BoundedQueue.ipp>
@@ -0,0 +1,148 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+template <typename T>
+BoundedQueue<T>::BoundedQueue(
+        std::size_t capacity)
+    : cells_(new Cell[ring_size_(capacity)])
+    , mask_(ring_size_(capacity) - 1)
+    , enqueue_pos_(0)
+    , dequeue_pos_(0)
+{
+    for (std::size_t i = 0; i <= mask_; ++i)
+    {
+        cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+template <typename T>
+bool BoundedQueue<T>::try_push(
+        T&& value)
+{
+    Cell* cell;
+    std::size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        cell = &cells_[pos & mask_];
+        const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        const std::intptr_t diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+
+        if (diff == 0)
+        {
+            // The cell is free in this lap: claim it
+            if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // The cell still holds the value of the previous lap: the queue is full
+            return false;
+        }
+        else
+        {
+            // Another producer claimed the cell
+            pos = enqueue_pos_.load(std::memory_order_relaxed);
+        }
+    }
+
+    cell->value = std::move(value);
+    cell->sequence.store(pos + 1, std::memory_order_release);
+
+    return true;
+}
+
+template <typename T>
+bool BoundedQueue<T>::try_pop(
+        T& value)
+{
+    Cell* cell;
+    std::size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        cell = &cells_[pos & mask_];
+        const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        const std::intptr_t diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos + 1);
+
+        if (diff == 0)
+        {
+            // The cell holds the value of this lap: claim it
+            if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // The cell has not been filled yet: the queue is empty
+            return false;
+        }
+        else
+        {
+            // Another consumer claimed the cell
+            pos = dequeue_pos_.load(std::memory_order_relaxed);
+        }
+    }
+
+    value = std::move(cell->value);
+
+    // Free the cell for the next lap
+    cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+
+    return true;
+}
+
+template <typename T>
+std::size_t BoundedQueue<T>::capacity() const noexcept
+{
+    return mask_ + 1;
+}
+
+template <typename T>
+std::size_t BoundedQueue<T>::size() const noexcept
+{
+    const std::size_t dequeue_pos = dequeue_pos_.load(std::memory_order_relaxed);
+    const std::size_t enqueue_pos = enqueue_pos_.load(std::memory_order_relaxed);
+
+    return enqueue_pos > dequeue_pos ? enqueue_pos - dequeue_pos : 0;
+}
+
+template <typename T>
+std::size_t BoundedQueue<T>::ring_size_(
+        std::size_t capacity) noexcept
+{
+    std::size_t size = 2;
+
+    while (size < capacity)
+    {
+        size <<= 1;
+    }
+
+    return size;
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
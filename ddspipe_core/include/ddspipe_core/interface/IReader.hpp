@@ -15,6 +15,8 @@
 #pragma once
 
 #include <functional>
+#include <memory>
+#include <vector>
 
 #include <fastdds/utils/TimedMutex.hpp>
 
@@ -110,6 +112,26 @@ public:
     virtual utils::ReturnCode take(
             std::unique_ptr<IRoutingData>& data) noexcept = 0;
 
+    /**
+     * @brief Take up to \c max_samples of the oldest received messages from the Reader
+     *
+     * This method works as \c take but moves several samples at once, so the synchronization cost of accessing
+     * the Reader is paid once per batch and not once per sample.
+     * The samples taken are appended to \c data in the same order they would have been returned by \c take .
+     *
+     * @param [out] data : vector where the samples taken are appended
+     * @param [in] max_samples : maximum number of samples to take
+     *
+     * @return \c RETCODE_OK if at least one sample has been taken correctly
+     * @return \c RETCODE_NO_DATA if there is no more data to take
+     * @return \c RETCODE_ERROR if there has been any error and no sample could be taken
+     * @return \c RETCODE_NOT_ENABLED if the reader is not enabled (this should not happen)
+     */
+    DDSPIPE_CORE_DllAPI
+    virtual utils::ReturnCode take_batch(
+            std::vector<std::unique_ptr<IRoutingData>>& data,
+            std::size_t max_samples) noexcept = 0;
+
     /////////////////////////
     // RPC REQUIRED METHODS
     /////////////////////////
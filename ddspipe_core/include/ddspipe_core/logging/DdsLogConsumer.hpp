@@ -18,6 +18,17 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <regex>
+#include <string>
+#include <thread>
+
 #include <cpp_utils/Log.hpp>
 #include <cpp_utils/logging/BaseLogConsumer.hpp>
 
@@ -27,6 +38,7 @@
 #include <fastdds/dds/topic/Topic.hpp>
 
 #include <ddspipe_core/configuration/DdsPipeLogConfiguration.hpp>
+#include <ddspipe_core/efficiency/queue/BoundedQueue.hpp>
 #include <ddspipe_core/library/library_dll.h>
 #include <ddspipe_core/types/logging/LogEntry.hpp>
 #include <ddspipe_core/types/logging/LogEntryPubSubTypes.hpp>
@@ -40,6 +52,11 @@ namespace core {
  * DDS Log Consumer with Standard (logical) behaviour.
  *
  * Registering this consumer in Fast DDS's Log publishes the log entries accepted by the BaseLogConsumer.
+ *
+ * Unless \c publish_queue_size is 0, the entries are not published in the thread that logs them: they are pushed
+ * to a bounded lock-free queue that a dedicated thread drains every \c publish_batch_period ms, or as soon as
+ * \c publish_batch_size entries are queued. The entries that do not fit in the queue are dropped following
+ * \c publish_queue_overflow_policy and counted in \c dropped_entries .
  */
 class DdsLogConsumer : public utils::BaseLogConsumer
 {
@@ -59,7 +76,7 @@ public:
      * The entry's kind must be higher or equal to the verbosity level \c verbosity_ .
      * The entry's content or category must match the \c filter_ regex.
      *
-     * This method will publish the \c entry with DDS.
+     * This method will publish the \c entry with DDS, or queue it to be published by the publishing thread.
      *
      * @param entry entry to consume
      */
@@ -67,8 +84,23 @@ public:
     void Consume(
             const utils::Log::Entry& entry) override;
 
+    //! Number of log entries accepted but not published because the publishing queue was full
+    DDSPIPE_CORE_DllAPI
+    std::uint64_t dropped_entries() const noexcept;
+
 protected:
 
+    //! Publish \c entry with DDS
+    void publish_(
+            const utils::Log::Entry& entry);
+
+    //! Queue \c entry to be published by the publishing thread, dropping an entry if the queue is full
+    void enqueue_(
+            const utils::Log::Entry& entry);
+
+    //! Routine of the publishing thread: publish the queued entries until \c stop_publishing_ is set
+    void publishing_routine_();
+
     //! Convert the \c Log::Kind to the \c LogEntry::Kind
     constexpr Kind get_log_entry_kind_(
             const utils::Log::Kind kind) const noexcept;
@@ -79,6 +111,34 @@ protected:
     fastdds::dds::Topic* topic_;
     fastdds::dds::DataWriter* writer_;
 
+    //! Pattern of the event in the content of a log message: "Event | Message"
+    const std::regex event_pattern_{R"(^([^|]+)\s\|\s)"};
+
+    //! Log entries waiting to be published (nullptr if they are published in the thread that logs them)
+    std::unique_ptr<BoundedQueue<utils::Log::Entry>> queue_;
+
+    //! What to do with a log entry when \c queue_ is full
+    const LogQueueOverflowPolicy overflow_policy_;
+
+    //! Number of log entries queued that wake up the publishing thread
+    const std::size_t batch_size_;
+
+    //! Max time a log entry waits in \c queue_
+    const std::chrono::milliseconds batch_period_;
+
+    //! Number of log entries dropped because \c queue_ was full
+    std::atomic<std::uint64_t> dropped_entries_{0};
+
+    //! Thread that publishes the log entries in \c queue_
+    std::thread publishing_thread_;
+
+    //! Mutex and condition variable to wake up the publishing thread
+    std::mutex publishing_mutex_;
+    std::condition_variable publishing_cv_;
+
+    //! Whether the publishing thread must publish the remaining entries and finish. Guarded by \c publishing_mutex_
+    bool stop_publishing_{false};
+
     //! Map relating the pattern string to its corresponding event
     std::map<std::string, long> events_{
         {"SAMPLE_LOST", SAMPLE_LOST},
@@ -0,0 +1,127 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LogThrottle.hpp
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_core/configuration/DdsPipeLogConfiguration.hpp>
+#include <ddspipe_core/library/library_dll.h>
+
+// Macro to log a warning at most throttle_max_occurrences times per throttle_window in this call site.
+#define DDSPIPE_LOG_WARNING_THROTTLED(category, msg) \
+    DDSPIPE_LOG_THROTTLED_IMPL_(EPROSIMA_LOG_WARNING, category, msg)
+
+// Macro to log an info message at most throttle_max_occurrences times per throttle_window in this call site.
+#define DDSPIPE_LOG_INFO_THROTTLED(category, msg) \
+    DDSPIPE_LOG_THROTTLED_IMPL_(EPROSIMA_LOG_INFO, category, msg)
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+/**
+ * Throttle of the log messages of a call site.
+ *
+ * The \c DDSPIPE_LOG_*_THROTTLED macros keep a \c LogThrottle for each call site (and so for each category), and
+ * only build and log the message when \c should_log allows it: the first \c throttle_max_occurrences occurrences of
+ * each \c throttle_window . The first occurrence of a window reports how many were suppressed before it, with its
+ * message or, if another thread has already used up the new window, with a summary of its own.
+ *
+ * The limits are shared by every call site and set with \c configure .
+ */
+class LogThrottle
+{
+public:
+
+    /**
+     * @brief Whether an occurrence of the call site must be logged.
+     *
+     * @param suppressed Set to the number of occurrences suppressed in the previous windows if this occurrence starts a
+     * new window, and to 0 otherwise. It must be reported even if this occurrence is not logged.
+     *
+     * Thread safe and lock free.
+     */
+    DDSPIPE_CORE_DllAPI
+    bool should_log(
+            std::uint64_t& suppressed) noexcept;
+
+    //! Set the limits of every call site from \c configuration
+    DDSPIPE_CORE_DllAPI
+    static void configure(
+            const DdsPipeLogConfiguration& configuration) noexcept;
+
+    /**
+     * @brief Set the limits of every call site.
+     *
+     * @param max_occurrences Occurrences logged per window (0 <=> never throttle).
+     * @param window Length of the window.
+     */
+    DDSPIPE_CORE_DllAPI
+    static void configure(
+            unsigned int max_occurrences,
+            const std::chrono::milliseconds& window) noexcept;
+
+protected:
+
+    //! Ticks of the steady clock when the current window started
+    std::atomic<std::int64_t> window_start_{0};
+
+    //! Occurrences in the current window
+    std::atomic<std::uint64_t> occurrences_{0};
+
+    //! Occurrences suppressed since the current window started
+    std::atomic<std::uint64_t> suppressed_{0};
+
+    //! Occurrences logged per window
+    static std::atomic<unsigned int> max_occurrences_;
+
+    //! Length of the window, in steady clock ticks
+    static std::atomic<std::int64_t> window_ticks_;
+};
+
+// The names of variables inside macros must be unique to avoid conflicts with external variables
+#define DDSPIPE_LOG_THROTTLED_IMPL_(log_macro, category, msg) \
+    do \
+    { \
+        static eprosima::ddspipe::core::LogThrottle ddspipe_log_throttle_; \
+        std::uint64_t ddspipe_log_suppressed_ = 0; \
+        if (ddspipe_log_throttle_.should_log(ddspipe_log_suppressed_)) \
+        { \
+            if (ddspipe_log_suppressed_ > 0) \
+            { \
+                log_macro(category, msg << " (" << ddspipe_log_suppressed_ << " similar messages suppressed)"); \
+            } \
+            else \
+            { \
+                log_macro(category, msg); \
+            } \
+        } \
+        else if (ddspipe_log_suppressed_ > 0) \
+        { \
+            log_macro(category, ddspipe_log_suppressed_ << " similar messages suppressed"); \
+        } \
+    } while (0)
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -66,6 +66,15 @@ public:
     DDSPIPE_CORE_DllAPI
     virtual void monitor_topics();
 
+    /**
+     * @brief Monitorize the services.
+     *
+     * The requests and replies forwarded are monitored by the \c ServicesMonitorProducer, which produces the
+     * \c MonitoringServices. They are only logged, as \c MonitoringServices is not a DDS type.
+     */
+    DDSPIPE_CORE_DllAPI
+    virtual void monitor_services();
+
 protected:
 
     /**
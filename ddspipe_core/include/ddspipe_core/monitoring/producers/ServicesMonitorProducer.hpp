@@ -0,0 +1,287 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <ddspipe_core/configuration/MonitorProducerConfiguration.hpp>
+#include <ddspipe_core/library/library_dll.h>
+#include <ddspipe_core/monitoring/consumers/IMonitorConsumer.hpp>
+#include <ddspipe_core/monitoring/producers/MonitorProducer.hpp>
+#include <ddspipe_core/types/monitoring/services/MonitoringServices.hpp>
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+
+
+// Macro to get the counters of the requests of a service forwarded through a participant.
+#define monitor_service_counters(service_name, participant_id) \
+    MONITOR_SERVICE_COUNTERS_IMPL_(service_name, participant_id)
+
+// Macro to notify that a request has been forwarded in the counters got with monitor_service_counters.
+#define monitor_service_request(counters) MONITOR_SERVICE_REQUEST_IMPL_(counters)
+
+// Macro to notify that a reply has been forwarded latency after its request in the counters got with
+// monitor_service_counters.
+#define monitor_service_reply(counters, latency) MONITOR_SERVICE_REPLY_IMPL_(counters, latency)
+
+// Macro to notify that n requests have expired in the counters got with monitor_service_counters.
+#define monitor_service_requests_expired(counters, n) MONITOR_SERVICE_REQUESTS_EXPIRED_IMPL_(counters, n)
+
+// Macro to notify that a request has been evicted in the counters got with monitor_service_counters.
+#define monitor_service_request_evicted(counters) MONITOR_SERVICE_REQUEST_EVICTED_IMPL_(counters)
+
+// Macro to notify that a reply has been discarded in the counters got with monitor_service_counters.
+#define monitor_service_reply_discarded(counters) MONITOR_SERVICE_REPLY_DISCARDED_IMPL_(counters)
+
+// Macro to set the number of requests waiting for their reply in the counters got with monitor_service_counters.
+#define monitor_service_requests_pending(counters, n) MONITOR_SERVICE_REQUESTS_PENDING_IMPL_(counters, n)
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+const std::string SERVICES_MONITOR_PRODUCER_ID = "services";
+
+/**
+ * @brief Producer of the \c MonitoringServices.
+ *
+ * The \c ServicesMonitorProducer produces the \c MonitoringServices by gathering the \c ServiceCounters of each
+ * service and participant, got once with \c monitor_service_counters and notified with the rest of its macros.
+ * These only update atomic counters, and the counters are gathered in \c produce .
+ *
+ * The \c ServicesMonitorProducer consumes the \c MonitoringServices by using its consumers.
+ *
+ * @note It is a singleton class so its macros can be called from anywhere in the code.
+ */
+class ServicesMonitorProducer : public MonitorProducer
+{
+public:
+
+    /**
+     * @brief Requests and replies of a service forwarded through a participant since the last time they were gathered.
+     *
+     * They are updated with relaxed atomics, so notifying a request or a reply does not take the producer mutex.
+     */
+    struct ServiceCounters
+    {
+        /**
+         * @brief Count a reply forwarded \c latency after its request.
+         *
+         * Method called by the \c monitor_service_reply macro.
+         */
+        DDSPIPE_CORE_DllAPI
+        void reply(
+                const std::chrono::nanoseconds& latency) noexcept;
+
+        std::atomic<std::uint64_t> requests{0};
+        std::atomic<std::uint64_t> replies{0};
+        std::atomic<std::uint64_t> requests_expired{0};
+        std::atomic<std::uint64_t> requests_evicted{0};
+        std::atomic<std::uint64_t> replies_discarded{0};
+
+        // Gauge: it is not reset when gathered.
+        std::atomic<std::uint64_t> requests_pending{0};
+
+        std::atomic<std::uint64_t> latency_sum_us{0};
+        std::atomic<std::uint64_t> latency_max_us{0};
+        std::array<std::atomic<std::uint64_t>, SERVICE_LATENCY_BUCKETS_MS.size() + 1> latency_histogram{};
+    };
+
+    /**
+     * @brief Destroy the \c ServicesMonitorProducer.
+     */
+    virtual ~ServicesMonitorProducer() = default;
+
+    /**
+     * @brief Initialize the instance of the \c ServicesMonitorProducer.
+     *
+     * Applications can initialize the instance of the \c ServicesMonitorProducer with derived classes.
+     *
+     * @param instance Instance of the \c ServicesMonitorProducer.
+     */
+    DDSPIPE_CORE_DllAPI
+    static void init_instance(
+            std::unique_ptr<ServicesMonitorProducer> instance);
+
+    /**
+     * @brief Get the instance of the \c ServicesMonitorProducer.
+     *
+     * If the instance has not been initialized, it will be initialized with the default configuration.
+     *
+     * @return Instance of the \c ServicesMonitorProducer.
+     */
+    DDSPIPE_CORE_DllAPI
+    static ServicesMonitorProducer* get_instance();
+
+    /**
+     * @brief Enable the \c ServicesMonitorProducer.
+     */
+    DDSPIPE_CORE_DllAPI
+    void enable() override;
+
+    /**
+     * @brief Disable the \c ServicesMonitorProducer.
+     */
+    DDSPIPE_CORE_DllAPI
+    void disable() override;
+
+    /**
+     * @brief Register a consumer.
+     *
+     * The consumer can be any class that implements the \c IMonitorConsumer interface as long as it is a template class
+     * that accepts the \c MonitoringServices as a template parameter.
+     *
+     * @param consumer Consumer to be registered.
+     */
+    DDSPIPE_CORE_DllAPI
+    void register_consumer(
+            std::unique_ptr<IMonitorConsumer<MonitoringServices>> consumer);
+
+    /**
+     * @brief Remove all consumers.
+     */
+    DDSPIPE_CORE_DllAPI
+    void clear_consumers() override;
+
+    /**
+     * @brief Produce and consume the \c MonitoringServices.
+     *
+     * Produces a \c MonitoringServices with the data gathered and consumes it.
+     */
+    DDSPIPE_CORE_DllAPI
+    void produce_and_consume() override;
+
+    /**
+     * @brief Produce the \c MonitoringServices.
+     *
+     * Generates a \c MonitoringServices with the data gathered.
+     */
+    DDSPIPE_CORE_DllAPI
+    void produce() override;
+
+    /**
+     * @brief Consume the \c MonitoringServices.
+     *
+     * Calls the consume method of its consumers.
+     */
+    DDSPIPE_CORE_DllAPI
+    void consume() override;
+
+    ///////////////////
+    // Data methods ///
+    ///////////////////
+
+    /**
+     * @brief Clear the data gathered.
+     */
+    DDSPIPE_CORE_DllAPI
+    void clear_data() override;
+
+    /**
+     * @brief Get the counters of the requests of a service forwarded through a participant.
+     *
+     * Method called by the \c monitor_service_counters macro.
+     * Every call with the same service and participant returns the same counters.
+     *
+     * @param service_name Name of the service.
+     * @param participant_id Participant that forwards the requests to the servers.
+     */
+    DDSPIPE_CORE_DllAPI
+    std::shared_ptr<ServiceCounters> counters(
+            const std::string& service_name,
+            const types::ParticipantId& participant_id);
+
+protected:
+
+    // Produce data_.
+    void produce_nts_();
+
+    // Consume data_.
+    void consume_nts_();
+
+    // Discard the counts in counters_.
+    void discard_counters_nts_();
+
+    // Instance of the ServicesMonitorProducer.
+    static std::unique_ptr<ServicesMonitorProducer> instance_;
+
+    // Mutex to protect the ServicesMonitorProducer.
+    static std::mutex mutex_;
+
+    // The produced data.
+    MonitoringServices data_;
+
+    // Counters of the requests of each Service through each Participant.
+    std::map<std::string, std::map<types::ParticipantId, std::shared_ptr<ServiceCounters>>> counters_;
+
+    // Participants of each Service that have already forwarded a request, so they are reported in every period.
+    std::map<std::string, std::set<types::ParticipantId>> registered_;
+
+    // Vector of consumers of the MonitoringServices.
+    std::vector<std::unique_ptr<IMonitorConsumer<MonitoringServices>>> consumers_;
+};
+
+
+// The names of variables inside macros must be unique to avoid conflicts with external variables
+#define MONITOR_SERVICE_COUNTERS_IMPL_(service_name, participant_id) \
+    eprosima::ddspipe::core::ServicesMonitorProducer::get_instance()->counters(service_name, participant_id)
+
+#define MONITOR_SERVICE_REQUEST_IMPL_(counters) \
+    (counters)->requests.fetch_add(1, std::memory_order_relaxed)
+
+#define MONITOR_SERVICE_REPLY_IMPL_(counters, latency) \
+    (counters)->reply(latency)
+
+#define MONITOR_SERVICE_REQUESTS_EXPIRED_IMPL_(counters, n) \
+    (counters)->requests_expired.fetch_add(n, std::memory_order_relaxed)
+
+#define MONITOR_SERVICE_REQUEST_EVICTED_IMPL_(counters) \
+    (counters)->requests_evicted.fetch_add(1, std::memory_order_relaxed)
+
+#define MONITOR_SERVICE_REPLY_DISCARDED_IMPL_(counters) \
+    (counters)->replies_discarded.fetch_add(1, std::memory_order_relaxed)
+
+#define MONITOR_SERVICE_REQUESTS_PENDING_IMPL_(counters, n) \
+    (counters)->requests_pending.store(n, std::memory_order_relaxed)
+
+} // namespace core
+} // namespace ddspipe
+} // namespace eprosima
+
+namespace std {
+
+std::ostream& operator <<(
+        std::ostream& os,
+        const eprosima::ddspipe::core::DdsServiceData& data);
+
+std::ostream& operator <<(
+        std::ostream& os,
+        const eprosima::ddspipe::core::DdsService& service);
+
+std::ostream& operator <<(
+        std::ostream& os,
+        const eprosima::ddspipe::core::MonitoringServices& data);
+
+} // namespace std
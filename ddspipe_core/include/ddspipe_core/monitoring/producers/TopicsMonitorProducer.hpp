@@ -15,7 +15,10 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -43,6 +46,24 @@
 // Macro to notify that n messages have been lost in a topic by a participant.
 #define monitor_msgs_lost(topic, participant_id, n) MONITOR_MSGS_LOST_IMPL_(topic, participant_id, n)
 
+// Macro to get the counters of the messages of a topic in a participant.
+#define monitor_counters(topic, participant_id) MONITOR_COUNTERS_IMPL_(topic, participant_id)
+
+// Macro to notify that a message has been received in the counters got with monitor_counters.
+#define monitor_counters_msg_rx(counters) MONITOR_COUNTERS_MSGS_RX_IMPL_(counters, 1)
+
+// Macro to notify that n messages have been received in the counters got with monitor_counters.
+#define monitor_counters_msgs_rx(counters, n) MONITOR_COUNTERS_MSGS_RX_IMPL_(counters, n)
+
+// Macro to notify that a message has been lost in the counters got with monitor_counters.
+#define monitor_counters_msg_lost(counters) MONITOR_COUNTERS_MSGS_LOST_IMPL_(counters, 1)
+
+// Macro to notify that n messages have been lost in the counters got with monitor_counters.
+#define monitor_counters_msgs_lost(counters, n) MONITOR_COUNTERS_MSGS_LOST_IMPL_(counters, n)
+
+// Macro to notify that n messages have been dropped on purpose in the counters got with monitor_counters.
+#define monitor_counters_msgs_dropped(counters, n) MONITOR_COUNTERS_MSGS_DROPPED_IMPL_(counters, n)
+
 // Macro to notify that a type has been discovered.
 #define monitor_type_discovered(type_name) MONITOR_TYPE_DISCOVERED_IMPL_(type_name)
 
@@ -70,12 +91,31 @@ const std::string TOPICS_MONITOR_PRODUCER_ID = "topics";
  *
  * The \c TopicsMonitorProducer consumes the \c MonitoringTopics by using its consumers.
  *
+ * Entities that notify messages very often (e.g. readers) should get the \c MessageCounters of their topic and
+ * participant once with \c monitor_counters , and notify them with \c monitor_counters_msg_rx ,
+ * \c monitor_counters_msg_lost and \c monitor_counters_msgs_dropped . These only increase an atomic counter, and the
+ * counters are gathered in \c produce .
+ *
  * @note It is a singleton class so its macros can be called from anywhere in the code.
  */
 class TopicsMonitorProducer : public MonitorProducer
 {
 public:
 
+    /**
+     * @brief Messages received, lost and dropped in a topic by a participant since the last time they were gathered.
+     *
+     * Messages lost are the ones the participant never received, while messages dropped are the ones received that
+     * the DDS Pipe discarded on purpose (e.g. stale or superseded samples).
+     * They are updated with relaxed atomics, so notifying a message does not take the producer mutex.
+     */
+    struct MessageCounters
+    {
+        std::atomic<std::uint64_t> msgs_received{0};
+        std::atomic<std::uint64_t> msgs_lost{0};
+        std::atomic<std::uint64_t> msgs_dropped{0};
+    };
+
     /**
      * @brief Destroy the \c TopicsMonitorProducer.
      */
@@ -166,6 +206,20 @@ public:
     DDSPIPE_CORE_DllAPI
     void clear_data() override;
 
+    /**
+     * @brief Get the counters of the messages of a \c topic in a participant.
+     *
+     * Method called by the \c monitor_counters macro.
+     * Every call with the same topic and participant returns the same counters.
+     *
+     * @param topic Topic of the messages.
+     * @param participant_id Participant that receives the messages.
+     */
+    DDSPIPE_CORE_DllAPI
+    std::shared_ptr<MessageCounters> counters(
+            const types::DdsTopic& topic,
+            const types::ParticipantId& participant_id);
+
     /**
      * @brief Increase the number of messages received in a \c topic by a participant.
      *
@@ -238,6 +292,17 @@ protected:
     // Generate the MonitoringTopics to be consumed.
     void reset_data_();
 
+    // Get the counters of a topic in a participant, creating them if they do not exist.
+    std::shared_ptr<MessageCounters> counters_nts_(
+            const types::DdsTopic& topic,
+            const types::ParticipantId& participant_id);
+
+    // Move the counts in counters_ to participant_data_.
+    void gather_counters_nts_();
+
+    // Discard the counts in counters_.
+    void discard_counters_nts_();
+
     // Instance of the TopicsMonitorProducer.
     static std::unique_ptr<TopicsMonitorProducer> instance_;
 
@@ -253,6 +318,9 @@ protected:
     // Data specific to a Participant.
     std::map<types::DdsTopic, std::map<types::ParticipantId, DdsTopicData>> participant_data_;
 
+    // Counters of the messages of each Participant in each Topic, not gathered yet in participant_data_.
+    std::map<types::DdsTopic, std::map<types::ParticipantId, std::shared_ptr<MessageCounters>>> counters_;
+
     // The types that have been discovered.
     std::map<std::string, bool> types_discovered_;
 
@@ -268,6 +336,18 @@ protected:
 #define MONITOR_MSGS_RX_IMPL_(topic, participant_id, n) \
     eprosima::ddspipe::core::TopicsMonitorProducer::get_instance()->msgs_received(topic, participant_id, n)
 
+#define MONITOR_COUNTERS_IMPL_(topic, participant_id) \
+    eprosima::ddspipe::core::TopicsMonitorProducer::get_instance()->counters(topic, participant_id)
+
+#define MONITOR_COUNTERS_MSGS_RX_IMPL_(counters, n) \
+    (counters)->msgs_received.fetch_add(n, std::memory_order_relaxed)
+
+#define MONITOR_COUNTERS_MSGS_LOST_IMPL_(counters, n) \
+    (counters)->msgs_lost.fetch_add(n, std::memory_order_relaxed)
+
+#define MONITOR_COUNTERS_MSGS_DROPPED_IMPL_(counters, n) \
+    (counters)->msgs_dropped.fetch_add(n, std::memory_order_relaxed)
+
 #define MONITOR_MSG_LOST_IMPL_(topic, participant_id) \
     eprosima::ddspipe::core::TopicsMonitorProducer::get_instance()->msgs_lost(topic, participant_id)
 
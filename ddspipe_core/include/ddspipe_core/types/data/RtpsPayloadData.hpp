@@ -15,17 +15,20 @@
 
 #pragma once
 
+#include <memory>
+
 #include <fastdds/rtps/common/SerializedPayload.hpp>
 #include <fastdds/rtps/common/SequenceNumber.hpp>
 #include <fastdds/rtps/common/OriginalWriterInfo.hpp>
 
 #include <ddspipe_core/library/library_dll.h>
 #include <ddspipe_core/types/dds/Payload.hpp>
+#include <ddspipe_core/efficiency/data/DataBlockPool.hpp>
 #include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
 #include <ddspipe_core/interface/IRoutingData.hpp>
 #include <ddspipe_core/types/dds/Guid.hpp>
 #include <ddspipe_core/types/dds/SpecificEndpointQoS.hpp>
-#include <ddspipe_core/types/participant/ParticipantId.hpp>
+#include <ddspipe_core/types/participant/ParticipantHandle.hpp>
 #include <ddspipe_core/types/topic/TopicInternalTypeDiscriminator.hpp>
 
 namespace eprosima {
@@ -59,6 +62,30 @@ struct RtpsPayloadData : public core::IRoutingData
     DDSPIPE_CORE_DllAPI
     virtual types::TopicInternalTypeDiscriminator internal_type_discriminator() const noexcept override;
 
+    /**
+     * @brief Take the memory of the object from \c block_pool , so it is recycled once the data is destroyed.
+     *
+     * Data is created and destroyed for every sample forwarded, so this avoids a heap allocation per sample while
+     * keeping the data owned by a \c std::unique_ptr with its default deleter.
+     */
+    DDSPIPE_CORE_DllAPI
+    static void* operator new(
+            std::size_t size);
+
+    //! Return the memory of the object to \c block_pool
+    DDSPIPE_CORE_DllAPI
+    static void operator delete(
+            void* ptr,
+            std::size_t size) noexcept;
+
+    //! Pool that recycles the memory of the data objects
+    DDSPIPE_CORE_DllAPI
+    static DataBlockPool& block_pool() noexcept;
+
+    //! Specific Writer QoS of the Data, or the default one if \c writer_qos is not set
+    DDSPIPE_CORE_DllAPI
+    const core::types::SpecificEndpointQoS& writer_specific_qos() const noexcept;
+
     //! Payload of the data received. The data in this payload must belong to the PayloadPool.
     core::types::Payload payload{};
 
@@ -69,8 +96,13 @@ struct RtpsPayloadData : public core::IRoutingData
      */
     core::PayloadPool* payload_owner{nullptr};
 
-    //! Specific Writer QoS of the Data
-    core::types::SpecificEndpointQoS writer_qos{};
+    /**
+     * @brief Specific Writer QoS of the Data.
+     *
+     * It is shared with the cache of the reader, so setting it per sample does not copy the QoS.
+     * If nullptr, the Data has the default QoS.
+     */
+    std::shared_ptr<const core::types::SpecificEndpointQoS> writer_qos{};
 
     //! Instance of the message (default no instance)
     core::types::InstanceHandle instanceHandle{};
@@ -84,8 +116,8 @@ struct RtpsPayloadData : public core::IRoutingData
     //! Guid of the source entity that has transmit the data
     core::types::Guid source_guid{};
 
-    //! Id of the participant from which the Reader has received the data.
-    core::types::ParticipantId participant_receiver{};
+    //! Handle of the participant from which the Reader has received the data.
+    core::types::ParticipantHandle participant_receiver{DEFAULT_PARTICIPANT_HANDLE};
 
     //! Guid of the original entity that transmitted the data for the first time
     eprosima::fastdds::rtps::OriginalWriterInfo original_writer_info{};
@@ -14,6 +14,9 @@
 
 #pragma once
 
+#include <cstddef>
+#include <functional>
+
 #include <fastdds/dds/core/policy/QosPolicies.hpp>
 
 #include <ddspipe_core/library/library_dll.h>
@@ -59,6 +62,14 @@ SpecificEndpointQoS
     bool operator == (
             const SpecificEndpointQoS& other) const noexcept;
 
+    /////////////////////////
+    // AUXILIARY METHODS
+    /////////////////////////
+
+    //! Hash of the partition names and the ownership strength, coherent with the equality operator
+    DDSPIPE_CORE_DllAPI
+    std::size_t hash() const noexcept;
+
     /////////////////////////
     // VARIABLES
     /////////////////////////
@@ -98,3 +109,19 @@ std::ostream& operator <<(
 } /* namespace core */
 } /* namespace ddspipe */
 } /* namespace eprosima */
+
+namespace std {
+
+//! Hash of \c SpecificEndpointQoS so it can be used as key of unordered containers
+template<>
+struct hash<eprosima::ddspipe::core::types::SpecificEndpointQoS>
+{
+    std::size_t operator ()(
+            const eprosima::ddspipe::core::types::SpecificEndpointQoS& qos) const noexcept
+    {
+        return qos.hash();
+    }
+
+};
+
+} /* namespace std */
@@ -38,6 +38,14 @@ using OwnershipQosPolicyKind = eprosima::fastdds::dds::OwnershipQosPolicyKind;
 //! Reliability kind enumeration
 using ReliabilityKind = eprosima::fastdds::rtps::ReliabilityKind_t;
 
+//! What to do with a new data when the queue of a writer is full
+enum class WriterQueueOverflowPolicy
+{
+    drop_oldest,    //! Discard the oldest data in the queue
+    drop_newest,    //! Discard the new data
+    block           //! Stop taking data from the reader until the queue has room
+};
+
 /**
  * The collection of QoS related to a Topic.
  *
@@ -51,6 +59,9 @@ using ReliabilityKind = eprosima::fastdds::rtps::ReliabilityKind_t;
  *  - Max Transmission Rate
  *  - Max Reception Rate
  *  - Downsampling
+ *  - Transmission Quantum (samples and time)
+ *  - Writer Queue (size and overflow policy)
+ *  - Inline Transmission
  *
  * @warning partitions are considered a Topic QoS. A Topic can then only either have partitions or not have them, but it
  * cannot support empty partitions.
@@ -144,6 +155,27 @@ TopicQoS
     //! Downsampling factor: keep 1 out of every *downsampling* samples received (downsampling=1 <=> no downsampling)
     utils::Fuzzy<unsigned int> downsampling;
 
+    //! Max samples a Track transmits before yielding its thread to other Tracks. Default: 100 (0 <=> no limit)
+    utils::Fuzzy<unsigned int> transmission_quantum_samples;
+
+    //! Max time a Track transmits before yielding its thread to other Tracks [us]. Default: 0 (no limit)
+    utils::Fuzzy<unsigned int> transmission_quantum_time;
+
+    //! Size of the queue of each writer, so they do not delay each other. Default: 0 (writers share the Track thread)
+    utils::Fuzzy<unsigned int> writer_queue_size;
+
+    //! What to do with a new data when the queue of a writer is full. Default: drop_oldest
+    utils::Fuzzy<WriterQueueOverflowPolicy> writer_queue_overflow_policy;
+
+    //! Transmit data in the thread that receives it instead of in the thread pool. Default: false
+    utils::Fuzzy<bool> inline_transmission;
+
+    //! Backlog from which a Track only forwards the latest sample of each instance of a keyed topic. Default: 0 (never)
+    utils::Fuzzy<unsigned int> conflation_threshold;
+
+    //! Max time since a sample was published until it is forwarded, older ones are dropped [ms]. Default: 0 (no limit)
+    utils::Fuzzy<unsigned int> max_forward_latency;
+
     //! XML profile name to use for endpoint QoS lookup
     utils::Fuzzy<std::string> endpoint_profile_name;
 
@@ -194,6 +226,35 @@ TopicQoS
     //! Downsampling (Default = 1)
     DDSPIPE_CORE_DllAPI
     static constexpr const unsigned int DEFAULT_DOWNSAMPLING = 1;
+
+    //! Transmission Quantum in samples (Default = 100)
+    DDSPIPE_CORE_DllAPI
+    static constexpr const unsigned int DEFAULT_TRANSMISSION_QUANTUM_SAMPLES = 100;
+
+    //! Transmission Quantum in microseconds (Default = 0)
+    DDSPIPE_CORE_DllAPI
+    static constexpr const unsigned int DEFAULT_TRANSMISSION_QUANTUM_TIME = 0;
+
+    //! Writer Queue size (Default = 0)
+    DDSPIPE_CORE_DllAPI
+    static constexpr const unsigned int DEFAULT_WRITER_QUEUE_SIZE = 0;
+
+    //! Writer Queue overflow policy (Default = drop_oldest)
+    DDSPIPE_CORE_DllAPI
+    static constexpr const WriterQueueOverflowPolicy DEFAULT_WRITER_QUEUE_OVERFLOW_POLICY =
+            WriterQueueOverflowPolicy::drop_oldest;
+
+    //! Whether data is transmitted in the thread that receives it (Default = False)
+    DDSPIPE_CORE_DllAPI
+    static constexpr const bool DEFAULT_INLINE_TRANSMISSION = false;
+
+    //! Backlog from which samples of the same instance are conflated (Default = 0, no conflation)
+    DDSPIPE_CORE_DllAPI
+    static constexpr const unsigned int DEFAULT_CONFLATION_THRESHOLD = 0;
+
+    //! Max forward latency [ms] (Default = 0, no limit)
+    DDSPIPE_CORE_DllAPI
+    static constexpr const unsigned int DEFAULT_MAX_FORWARD_LATENCY = 0;
 };
 
 /**
@@ -247,6 +308,23 @@ std::ostream& operator <<(
         std::ostream& os,
         const utils::Fuzzy<OwnershipQosPolicyKind>& qos);
 
+/**
+ * @brief \c WriterQueueOverflowPolicy to stream serialization
+ */
+DDSPIPE_CORE_DllAPI
+std::ostream& operator <<(
+        std::ostream& os,
+        const WriterQueueOverflowPolicy& policy);
+
+/**
+ * @brief The operator << must be overloaded for Fuzzy so that the \c WriterQueueOverflowPolicy overloaded operator <<
+ * gets called.
+ */
+DDSPIPE_CORE_DllAPI
+std::ostream& operator <<(
+        std::ostream& os,
+        const utils::Fuzzy<WriterQueueOverflowPolicy>& policy);
+
 /**
  * @brief \c TopicQoS to stream serialization
  */
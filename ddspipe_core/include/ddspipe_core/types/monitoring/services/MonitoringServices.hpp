@@ -0,0 +1,91 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+//! Upper bounds in milliseconds of the buckets of the request-reply latency histogram (the last one is unbounded)
+constexpr std::array<std::uint32_t, 12> SERVICE_LATENCY_BUCKETS_MS{
+    {1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 2000, 5000}};
+
+/**
+ * @brief Requests and replies forwarded in a service through a participant in a monitoring period.
+ *
+ * The requests are the ones forwarded to the servers reachable through the participant, and the replies the ones
+ * received from them.
+ */
+struct DdsServiceData
+{
+    //! Participant that forwards the requests to the servers.
+    std::string participant_id;
+
+    //! Requests forwarded.
+    std::uint64_t requests{0};
+
+    //! Replies forwarded back to their clients.
+    std::uint64_t replies{0};
+
+    //! Requests not replied within the request timeout.
+    std::uint64_t requests_expired{0};
+
+    //! Requests removed to make room for new ones, so their replies are dropped.
+    std::uint64_t requests_evicted{0};
+
+    //! Replies discarded, because their request had already been replied (e.g. by another server) or expired.
+    std::uint64_t replies_discarded{0};
+
+    //! Requests waiting for their reply at the end of the period.
+    std::uint64_t requests_pending{0};
+
+    //! Mean time in milliseconds since a request was forwarded until its reply was received.
+    double mean_latency_ms{0};
+
+    //! Max time in milliseconds since a request was forwarded until its reply was received.
+    double max_latency_ms{0};
+
+    //! Replies in each latency bucket of \c SERVICE_LATENCY_BUCKETS_MS , plus the ones slower than the last bucket.
+    std::vector<std::uint64_t> latency_histogram;
+};
+
+/**
+ * @brief Data of a service gathered in a monitoring period.
+ */
+struct DdsService
+{
+    //! Name of the service.
+    std::string name;
+
+    //! Data of each participant forwarding the requests of the service.
+    std::vector<DdsServiceData> data;
+};
+
+/**
+ * @brief Data of the services gathered in a monitoring period.
+ */
+struct MonitoringServices
+{
+    std::vector<DdsService> services;
+};
+
+} // namespace core
+} // namespace ddspipe
+} // namespace eprosima
@@ -90,6 +90,8 @@ public:
 
                     m_msg_rx_rate = x.m_msg_rx_rate;
 
+                    m_msgs_dropped = x.m_msgs_dropped;
+
     }
 
     /*!
@@ -103,6 +105,7 @@ public:
         m_msgs_lost = x.m_msgs_lost;
         m_msgs_received = x.m_msgs_received;
         m_msg_rx_rate = x.m_msg_rx_rate;
+        m_msgs_dropped = x.m_msgs_dropped;
     }
 
     /*!
@@ -121,6 +124,8 @@ public:
 
                     m_msg_rx_rate = x.m_msg_rx_rate;
 
+                    m_msgs_dropped = x.m_msgs_dropped;
+
         return *this;
     }
 
@@ -136,6 +141,7 @@ public:
         m_msgs_lost = x.m_msgs_lost;
         m_msgs_received = x.m_msgs_received;
         m_msg_rx_rate = x.m_msg_rx_rate;
+        m_msgs_dropped = x.m_msgs_dropped;
         return *this;
     }
 
@@ -149,7 +155,8 @@ public:
         return (m_participant_id == x.m_participant_id &&
            m_msgs_lost == x.m_msgs_lost &&
            m_msgs_received == x.m_msgs_received &&
-           m_msg_rx_rate == x.m_msg_rx_rate);
+           m_msg_rx_rate == x.m_msg_rx_rate &&
+           m_msgs_dropped == x.m_msgs_dropped);
     }
 
     /*!
@@ -288,6 +295,35 @@ public:
     }
 
 
+    /*!
+     * @brief This function sets a value in member msgs_dropped
+     * @param _msgs_dropped New value for member msgs_dropped
+     */
+    eProsima_user_DllExport void msgs_dropped(
+            uint32_t _msgs_dropped)
+    {
+        m_msgs_dropped = _msgs_dropped;
+    }
+
+    /*!
+     * @brief This function returns the value of member msgs_dropped
+     * @return Value of member msgs_dropped
+     */
+    eProsima_user_DllExport uint32_t msgs_dropped() const
+    {
+        return m_msgs_dropped;
+    }
+
+    /*!
+     * @brief This function returns a reference to member msgs_dropped
+     * @return Reference to member msgs_dropped
+     */
+    eProsima_user_DllExport uint32_t& msgs_dropped()
+    {
+        return m_msgs_dropped;
+    }
+
+
 
 private:
 
@@ -295,6 +331,7 @@ private:
     uint32_t m_msgs_lost{0};
     uint32_t m_msgs_received{0};
     double m_msg_rx_rate{0.0};
+    uint32_t m_msgs_dropped{0};
 
 };
 /*!
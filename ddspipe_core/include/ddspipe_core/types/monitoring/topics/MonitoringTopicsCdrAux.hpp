@@ -24,7 +24,7 @@
 
 #include "MonitoringTopics.hpp"
 
-constexpr uint32_t DdsTopicData_max_cdr_typesize {280UL};
+constexpr uint32_t DdsTopicData_max_cdr_typesize {284UL};
 constexpr uint32_t DdsTopicData_max_key_cdr_typesize {0UL};
 
 constexpr uint32_t MonitoringTopics_max_cdr_typesize {12UL};
@@ -62,6 +62,9 @@ eProsima_user_DllExport size_t calculate_serialized_size(
         calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(3),
                 data.msg_rx_rate(), current_alignment);
 
+        calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(4),
+                data.msgs_dropped(), current_alignment);
+
 
     calculated_size += calculator.end_calculate_type_serialized_size(previous_encoding, current_alignment);
 
@@ -84,6 +87,7 @@ eProsima_user_DllExport void serialize(
         << eprosima::fastcdr::MemberId(1) << data.msgs_lost()
         << eprosima::fastcdr::MemberId(2) << data.msgs_received()
         << eprosima::fastcdr::MemberId(3) << data.msg_rx_rate()
+        << eprosima::fastcdr::MemberId(4) << data.msgs_dropped()
 ;
     scdr.end_serialize_type(current_state);
 }
@@ -117,6 +121,10 @@ eProsima_user_DllExport void deserialize(
                                                 dcdr >> data.msg_rx_rate();
                                             break;
 
+                                        case 4:
+                                                dcdr >> data.msgs_dropped();
+                                            break;
+
                     default:
                         ret_value = false;
                         break;
@@ -140,6 +148,8 @@ void serialize_key(
 
                         scdr << data.msg_rx_rate();
 
+                        scdr << data.msgs_dropped();
+
 }
 
 
@@ -0,0 +1,70 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+#include <ddspipe_core/library/library_dll.h>
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+namespace types {
+
+/**
+ * @brief Compact handle of an interned \c ParticipantId
+ *
+ * Every \c ParticipantId is interned once, and its handle never changes during the execution.
+ * The data path keeps and compares handles instead of copying and comparing strings.
+ * Ids are kept for configuration and logging.
+ */
+using ParticipantHandle = std::uint32_t;
+
+//! Handle of \c DEFAULT_PARTICIPANT_ID , interned before any other id
+constexpr const ParticipantHandle DEFAULT_PARTICIPANT_HANDLE = 0;
+
+//! Handle no id is interned with, to mark that there is no participant
+constexpr const ParticipantHandle INVALID_PARTICIPANT_HANDLE = std::numeric_limits<ParticipantHandle>::max();
+
+/**
+ * @brief Get the handle of a participant id, interning it if it is new.
+ *
+ * It takes a mutex, so it is meant to be called when an entity is created, not for every data.
+ *
+ * Thread safe
+ */
+DDSPIPE_CORE_DllAPI
+ParticipantHandle intern_participant_id(
+        const ParticipantId& participant_id) noexcept;
+
+/**
+ * @brief Get the participant id of a handle.
+ *
+ * The reference is valid during the whole execution.
+ *
+ * @return The participant id interned with \c handle , or \c DEFAULT_PARTICIPANT_ID if the handle is unknown.
+ *
+ * Thread safe
+ */
+DDSPIPE_CORE_DllAPI
+const ParticipantId& interned_participant_id(
+        const ParticipantHandle handle) noexcept;
+
+} /* namespace types */
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,112 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <cpp_utils/memory/Heritable.hpp>
+
+#include <ddspipe_core/library/library_dll.h>
+#include <ddspipe_core/interface/ITopic.hpp>
+#include <ddspipe_core/types/topic/filter/IFilterTopic.hpp>
+#include <ddspipe_core/types/topic/filter/WildcardDdsFilterTopic.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+namespace types {
+
+/**
+ * Collection of filters compiled to find the ones that match a topic without checking every one of them.
+ *
+ * \c WildcardDdsFilterTopic filters are indexed by the topic name pattern:
+ *  - Patterns without wildcards are stored in a hash map by the name itself.
+ *  - Patterns with wildcards are stored in a trie by their literal prefix (the characters before the first wildcard).
+ *
+ * Only the filters found by the topic name, and any other kind of filter, are checked with \c IFilterTopic::matches ,
+ * so the result is the same as checking every filter.
+ */
+class FilterTopicIndex
+{
+public:
+
+    //! Default constructor without filters
+    DDSPIPE_CORE_DllAPI
+    FilterTopicIndex();
+
+    //! Compile the filters in \c filters
+    DDSPIPE_CORE_DllAPI
+    FilterTopicIndex(
+            const std::set<utils::Heritable<IFilterTopic>>& filters);
+
+    //! Whether any of the filters matches \c topic
+    DDSPIPE_CORE_DllAPI
+    bool matches(
+            const ITopic& topic) const noexcept;
+
+    //! Whether there are no filters
+    DDSPIPE_CORE_DllAPI
+    bool empty() const noexcept;
+
+    /**
+     * @brief Whether the result of \c matches only depends on the topic name and type name.
+     *
+     * It is true when every filter is a \c WildcardDdsFilterTopic , so its result can be memoized.
+     */
+    DDSPIPE_CORE_DllAPI
+    bool only_names_matched() const noexcept;
+
+protected:
+
+    //! Node of the trie of literal prefixes
+    struct PrefixNode
+    {
+        //! Index of the next nodes in \c prefix_trie_ by the next character
+        std::map<char, std::size_t> children;
+
+        //! Filters whose literal prefix ends in this node
+        std::vector<utils::Heritable<IFilterTopic>> filters;
+    };
+
+    //! Add a \c WildcardDdsFilterTopic filter to the index
+    void add_wildcard_filter_(
+            const utils::Heritable<IFilterTopic>& filter);
+
+    //! Characters of \c pattern before the first wildcard, or the whole pattern if it has none
+    static std::string literal_prefix_(
+            const std::string& pattern) noexcept;
+
+    //! Wildcard filters without wildcards in the topic name, by topic name
+    std::unordered_map<std::string, std::vector<utils::Heritable<IFilterTopic>>> literal_filters_;
+
+    //! Trie of the wildcard filters with wildcards in the topic name. The first node is the root.
+    std::vector<PrefixNode> prefix_trie_;
+
+    //! Filters that cannot be indexed, checked for every topic
+    std::vector<utils::Heritable<IFilterTopic>> generic_filters_;
+
+    //! Number of filters
+    std::size_t size_;
+};
+
+} /* namespace types */
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
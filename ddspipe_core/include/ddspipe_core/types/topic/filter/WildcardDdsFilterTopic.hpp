@@ -48,7 +48,15 @@ struct WildcardDdsFilterTopic : public IFilterTopic
     // FILTER METHODS
     /////////////////////////
 
-    //! Implement \c contains parent method.
+    /**
+     * @brief Implement \c contains parent method.
+     *
+     * \c other is contained if it is a \c WildcardDdsFilterTopic and every topic name and type name it matches is
+     * also matched by \c this . A name not set is considered as the pattern \c * .
+     *
+     * @note The check is conservative: it may return false for some patterns that are contained (e.g. \c ?* and
+     * \c *? ), but it never returns true for patterns that are not.
+     */
     DDSPIPE_CORE_DllAPI
     virtual bool contains(
             const IFilterTopic& other) const override;
@@ -93,6 +101,17 @@ protected:
     DDSPIPE_CORE_DllAPI
     bool matches_(
             const DdsTopic& real_topic) const;
+
+    /**
+     * @brief Whether every string matched by pattern \c other is matched by pattern \c pattern .
+     *
+     * Wildcards \c * and \c ? are supported. Patterns with other special characters are only contained if they
+     * are equal.
+     */
+    DDSPIPE_CORE_DllAPI
+    static bool pattern_contains_(
+            const std::string& pattern,
+            const std::string& other);
 };
 
 /**
@@ -36,12 +36,13 @@ DdsBridge::DdsBridge(
         const std::vector<core::types::ManualTopic>& manual_topics)
     : Bridge(participants_database, payload_pool, thread_pool)
     , topic_(topic)
+    , route_table_(routes_config(), participants_database->get_participants_repeater_map())
+    , active_writers_(route_table_.size())
     , manual_topics_(manual_topics)
+    , discovery_time_(std::chrono::steady_clock::now())
 {
     logDebug(DDSPIPE_DDSBRIDGE, "Creating DdsBridge " << *this << ".");
 
-    routes_ = routes_config();
-
     if (remove_unused_entities && topic->topic_discoverer() != DEFAULT_PARTICIPANT_ID)
     {
         create_writer(topic->topic_discoverer());
@@ -51,6 +52,8 @@ DdsBridge::DdsBridge(
         create_all_tracks_();
     }
 
+    creation_time_ = std::chrono::steady_clock::now();
+
     logDebug(DDSPIPE_DDSBRIDGE, "DdsBridge " << *this << " created.");
 }
 
@@ -104,50 +107,20 @@ void DdsBridge::create_all_tracks_()
 {
     std::lock_guard<std::mutex> lock(mutex_);
 
-    const auto& ids = participants_->get_participants_ids();
-
-    // Figure out what writers need to be created
-    std::set<ParticipantId> writers_to_create;
+    // Create the writers that forward the data of any reader.
+    const auto& writers_to_create = route_table_.routed_writers();
+    std::vector<std::shared_ptr<IWriter>> writers(route_table_.size());
 
-    for (const ParticipantId& id : ids)
+    for (const auto index : writers_to_create.indexes())
     {
-        const auto& routes_it = routes_.find(id);
-
-        if (routes_it != routes_.end())
-        {
-            // The reader has a route. Create only the writers in the route.
-
-            // We are not going to modify the writers_ids in this route. We can get the writers_ids by reference.
-            const auto& writers_ids = routes_it->second;
-            writers_to_create.insert(writers_ids.begin(), writers_ids.end());
-        }
-        else
-        {
-            // The reader doesn't have a route. Create every writer (+ itself if repeater)
-            auto writers_ids = ids;
-
-            if (!participants_->get_participant(id)->is_repeater())
-            {
-                // The participant is not a repeater. Do not add its writer.
-                writers_ids.erase(id);
-            }
-
-            writers_to_create.insert(writers_ids.begin(), writers_ids.end());
-        }
-    }
-
-    // Create the writers.
-    std::map<ParticipantId, std::shared_ptr<IWriter>> writers;
-
-    for (const auto& id : writers_to_create)
-    {
-        std::shared_ptr<IParticipant> participant = participants_->get_participant(id);
+        std::shared_ptr<IParticipant> participant =
+                participants_->get_participant(route_table_.participant_id(index));
         const auto topic = create_topic_for_participant_nts_(participant);
-        writers[id] = participant->create_writer(*topic);
+        writers[index] = participant->create_writer(*topic);
     }
 
     // Add the writers to the tracks they have routes for.
-    add_writers_to_tracks_nts_(writers);
+    add_writers_to_tracks_nts_(writers_to_create, writers);
 }
 
 void DdsBridge::create_writer(
@@ -159,6 +132,14 @@ void DdsBridge::create_writer(
 
     // Create the writer.
     std::shared_ptr<IParticipant> participant = participants_->get_participant(participant_id);
+
+    if (!participant)
+    {
+        EPROSIMA_LOG_WARNING(DDSPIPE_DDSBRIDGE,
+                "Participant " << participant_id << " does not exist. No writer created in DdsBridge " << *this << ".");
+        return;
+    }
+
     const auto topic = create_topic_for_participant_nts_(participant);
     auto writer = participant->create_writer(*topic);
 
@@ -173,19 +154,31 @@ void DdsBridge::remove_writer(
 
     std::lock_guard<std::mutex> lock(mutex_);
 
-    for (auto it = tracks_.cbegin(), next_it = it; it != tracks_.cend(); it = next_it)
+    std::size_t writer;
+
+    if (!route_table_.find_index(participant_id, writer))
     {
-        ++next_it;
+        return;
+    }
 
-        const auto& track = it->second;
+    active_writers_.reset(writer);
 
-        // If the writer is in the track, remove it.
-        track->remove_writer(participant_id);
+    // Only the tracks of the readers in the route of the writer may have it.
+    for (const auto reader : route_table_.readers_of(writer).indexes())
+    {
+        const auto track_it = tracks_.find(route_table_.participant_id(reader));
 
-        if (!track->has_writers())
+        if (track_it == tracks_.end())
+        {
+            continue;
+        }
+
+        track_it->second->remove_writer(participant_id);
+
+        if (!(route_table_.writers_of(reader) & active_writers_).any())
         {
             // The track doesn't have any writers. Remove it.
-            tracks_.erase(it);
+            tracks_.erase(track_it);
         }
     }
 }
@@ -194,90 +187,87 @@ void DdsBridge::add_writer_to_tracks_nts_(
         const ParticipantId& participant_id,
         std::shared_ptr<IWriter>& writer)
 {
-    // Create the writer.
-    std::map<ParticipantId, std::shared_ptr<IWriter>> writers;
-    writers[participant_id] = writer;
+    std::size_t index;
+
+    if (!route_table_.find_index(participant_id, index))
+    {
+        EPROSIMA_LOG_WARNING(DDSPIPE_DDSBRIDGE,
+                "Participant " << participant_id << " has no routes in DdsBridge " << *this << ".");
+        return;
+    }
+
+    ParticipantBitset new_writers(route_table_.size());
+    new_writers.set(index);
+
+    std::vector<std::shared_ptr<IWriter>> writers(route_table_.size());
+    writers[index] = writer;
 
     // Add the writer to the tracks it has routes for.
-    add_writers_to_tracks_nts_(writers);
+    add_writers_to_tracks_nts_(new_writers, writers);
 }
 
 void DdsBridge::add_writers_to_tracks_nts_(
-        std::map<ParticipantId, std::shared_ptr<IWriter>>& writers)
+        const ParticipantBitset& new_writers,
+        const std::vector<std::shared_ptr<IWriter>>& writers)
 {
+    // Gather the readers in the routes of the new writers.
+    ParticipantBitset readers(route_table_.size());
+
+    for (const auto writer : new_writers.indexes())
+    {
+        readers |= route_table_.readers_of(writer);
+        active_writers_.set(writer);
+    }
+
     // Add writers to the tracks of the readers in their route.
     // If the readers in their route don't exist, create them with their tracks.
-    for (const ParticipantId& id : participants_->get_participants_ids())
+    for (const auto reader : readers.indexes())
     {
-        // Select the necessary writers
-        std::map<ParticipantId, std::shared_ptr<IWriter>> writers_of_track;
-
-        const auto& routes_it = routes_.find(id);
-
-        if (routes_it != routes_.end())
-        {
-            // The reader has a route. Add only the writers in the route.
-            const auto& writers_in_route = routes_it->second;
-
-            for (const auto& writer_id : writers_in_route)
-            {
-                if (writers.count(writer_id) >= 1)
-                {
-                    writers_of_track[writer_id] = writers[writer_id];
-                }
-            }
-        }
-        else
-        {
-            // The reader doesn't have a route. Add every writer (+ itself if repeater)
-            writers_of_track = writers;
+        const ParticipantId& id = route_table_.participant_id(reader);
+        const auto writers_of_track = (route_table_.writers_of(reader) & new_writers).indexes();
 
-            if (!participants_->get_participant(id)->is_repeater())
-            {
-                // The participant is not a repeater. Do not add its writer.
-                writers_of_track.erase(id);
-            }
-        }
+        const auto track_it = tracks_.find(id);
 
-        if (writers_of_track.size() == 0)
-        {
-            // There are no writers in the route. There is nothing to do. Skip participant.
-            continue;
-        }
-
-        if (tracks_.count(id))
+        if (track_it != tracks_.end())
         {
             // The track already exists. Add the writers to it.
-            for (const auto& writers_of_track_it : writers_of_track)
+            for (const auto writer : writers_of_track)
             {
-                const auto& writer_id = writers_of_track_it.first;
-                const auto& writer = writers_of_track_it.second;
+                const auto& writer_id = route_table_.participant_id(writer);
 
-                if (!tracks_[id]->has_writer(writer_id))
+                if (!track_it->second->has_writer(writer_id))
                 {
                     // Add the writer to the track
-                    tracks_[id]->add_writer(writer_id, writer);
+                    track_it->second->add_writer(writer_id, writers[writer]);
                 }
             }
         }
         else
         {
             // The track doesn't exist. Create it.
+            std::map<ParticipantId, std::shared_ptr<IWriter>> track_writers;
+
+            for (const auto writer : writers_of_track)
+            {
+                track_writers[route_table_.participant_id(writer)] = writers[writer];
+            }
+
             std::shared_ptr<IParticipant> participant = participants_->get_participant(id);
             const auto topic = create_topic_for_participant_nts_(participant);
-            auto reader = participant->create_reader(*topic);
+            auto reader_entity = participant->create_reader(*topic);
 
-            tracks_[id] = std::make_unique<Track>(
-                topic_,
+            auto& track = tracks_[id];
+            track = std::make_unique<Track>(
+                topic,
                 id,
-                std::move(reader),
-                std::move(writers_of_track),
+                std::move(reader_entity),
+                std::move(track_writers),
                 payload_pool_,
                 thread_pool_);
 
             if (enabled_)
             {
-                tracks_[id]->enable();
+                track->enable();
             }
         }
     }
@@ -306,6 +296,59 @@ void DdsBridge::update_topic_filter(
     }
 }
 
+void DdsBridge::set_discovery_time(
+        const std::chrono::steady_clock::time_point& discovery_time) noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    discovery_time_ = discovery_time;
+}
+
+DdsBridgeMetrics DdsBridge::metrics() noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (first_transmission_time_ == std::chrono::steady_clock::time_point())
+    {
+        // Look for the first data forwarded by the Tracks
+        for (const auto& track : tracks_)
+        {
+            const auto track_time = track.second->first_transmission_time();
+
+            if (track_time != std::chrono::steady_clock::time_point() &&
+                    (first_transmission_time_ == std::chrono::steady_clock::time_point() ||
+                    track_time < first_transmission_time_))
+            {
+                first_transmission_time_ = track_time;
+            }
+        }
+    }
+
+    DdsBridgeMetrics metrics;
+    metrics.creation_latency =
+            std::chrono::duration_cast<std::chrono::microseconds>(creation_time_ - discovery_time_);
+
+    if (first_transmission_time_ != std::chrono::steady_clock::time_point())
+    {
+        metrics.forwarded = true;
+        metrics.first_sample_latency =
+                std::chrono::duration_cast<std::chrono::microseconds>(first_transmission_time_ - discovery_time_);
+    }
+
+    for (const auto& track : tracks_)
+    {
+        metrics.yield_count += track.second->yield_count();
+
+        auto writer_queues = track.second->writer_queues_metrics();
+        if (!writer_queues.empty())
+        {
+            metrics.writer_queues[track.first] = std::move(writer_queues);
+        }
+    }
+
+    return metrics;
+}
+
 utils::Heritable<DistributedTopic> DdsBridge::create_topic_for_participant_nts_(
         const std::shared_ptr<IParticipant>& participant) noexcept
 {
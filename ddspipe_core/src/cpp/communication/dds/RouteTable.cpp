@@ -0,0 +1,214 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RouteTable.cpp
+ *
+ */
+
+#include <algorithm>
+#include <cassert>
+
+#include <ddspipe_core/communication/dds/RouteTable.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+using namespace eprosima::ddspipe::core::types;
+
+ParticipantBitset::ParticipantBitset(
+        const std::size_t size)
+    : words_((size + WORD_BITS_ - 1) / WORD_BITS_, 0)
+{
+}
+
+void ParticipantBitset::set(
+        const std::size_t index) noexcept
+{
+    words_[index / WORD_BITS_] |= std::uint64_t(1) << (index % WORD_BITS_);
+}
+
+void ParticipantBitset::reset(
+        const std::size_t index) noexcept
+{
+    words_[index / WORD_BITS_] &= ~(std::uint64_t(1) << (index % WORD_BITS_));
+}
+
+bool ParticipantBitset::test(
+        const std::size_t index) const noexcept
+{
+    return (words_[index / WORD_BITS_] >> (index % WORD_BITS_)) & 1;
+}
+
+bool ParticipantBitset::any() const noexcept
+{
+    return std::any_of(words_.begin(), words_.end(), [](std::uint64_t word)
+                   {
+                       return word != 0;
+                   });
+}
+
+ParticipantBitset ParticipantBitset::operator &(
+        const ParticipantBitset& other) const noexcept
+{
+    assert(words_.size() == other.words_.size());
+
+    ParticipantBitset result(*this);
+
+    for (std::size_t i = 0; i < words_.size(); ++i)
+    {
+        result.words_[i] &= other.words_[i];
+    }
+
+    return result;
+}
+
+ParticipantBitset& ParticipantBitset::operator |=(
+        const ParticipantBitset& other) noexcept
+{
+    assert(words_.size() == other.words_.size());
+
+    for (std::size_t i = 0; i < words_.size(); ++i)
+    {
+        words_[i] |= other.words_[i];
+    }
+
+    return *this;
+}
+
+std::vector<std::size_t> ParticipantBitset::indexes() const
+{
+    std::vector<std::size_t> result;
+
+    for (std::size_t i = 0; i < words_.size(); ++i)
+    {
+        // Skip the words without participants at once
+        for (std::size_t bit = 0; bit < WORD_BITS_ && (words_[i] >> bit) != 0; ++bit)
+        {
+            if ((words_[i] >> bit) & 1)
+            {
+                result.push_back(i * WORD_BITS_ + bit);
+            }
+        }
+    }
+
+    return result;
+}
+
+RouteTable::RouteTable(
+        const RoutesConfiguration::RoutesMap& routes,
+        const std::map<ParticipantId, bool>& participants)
+{
+    ids_.reserve(participants.size());
+
+    for (const auto& participant : participants)
+    {
+        ids_.push_back(participant.first);
+    }
+
+    const std::size_t n_participants = ids_.size();
+
+    rows_.assign(n_participants, ParticipantBitset(n_participants));
+    columns_.assign(n_participants, ParticipantBitset(n_participants));
+    routed_writers_ = ParticipantBitset(n_participants);
+
+    std::size_t reader = 0;
+
+    for (const auto& participant : participants)
+    {
+        const auto routes_it = routes.find(participant.first);
+
+        if (routes_it != routes.end())
+        {
+            // The reader has a route. Only the writers in the route forward its data.
+            for (const auto& writer_id : routes_it->second)
+            {
+                std::size_t writer;
+
+                if (find_index(writer_id, writer))
+                {
+                    rows_[reader].set(writer);
+                }
+            }
+        }
+        else
+        {
+            // The reader doesn't have a route. Every writer forwards its data (+ itself if repeater).
+            for (std::size_t writer = 0; writer < n_participants; ++writer)
+            {
+                if (writer != reader || participant.second)
+                {
+                    rows_[reader].set(writer);
+                }
+            }
+        }
+
+        for (const auto writer : rows_[reader].indexes())
+        {
+            columns_[writer].set(reader);
+        }
+
+        routed_writers_ |= rows_[reader];
+
+        ++reader;
+    }
+}
+
+std::size_t RouteTable::size() const noexcept
+{
+    return ids_.size();
+}
+
+const ParticipantId& RouteTable::participant_id(
+        const std::size_t index) const noexcept
+{
+    return ids_[index];
+}
+
+bool RouteTable::find_index(
+        const ParticipantId& id,
+        std::size_t& index) const noexcept
+{
+    const auto it = std::lower_bound(ids_.begin(), ids_.end(), id);
+
+    if (it == ids_.end() || *it != id)
+    {
+        return false;
+    }
+
+    index = static_cast<std::size_t>(it - ids_.begin());
+    return true;
+}
+
+const ParticipantBitset& RouteTable::writers_of(
+        const std::size_t reader) const noexcept
+{
+    return rows_[reader];
+}
+
+const ParticipantBitset& RouteTable::readers_of(
+        const std::size_t writer) const noexcept
+{
+    return columns_[writer];
+}
+
+const ParticipantBitset& RouteTable::routed_writers() const noexcept
+{
+    return routed_writers_;
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
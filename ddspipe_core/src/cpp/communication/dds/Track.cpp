@@ -17,13 +17,20 @@
  *
  */
 
+#include <algorithm>
+#include <limits>
+
 #include <cpp_utils/exception/UnsupportedException.hpp>
 #include <cpp_utils/Log.hpp>
 #include <cpp_utils/ReturnCode.hpp>
 #include <cpp_utils/thread_pool/pool/SlotThreadPool.hpp>
 #include <cpp_utils/thread_pool/task/TaskId.hpp>
 
+#include <ddspipe_core/communication/dds/conflation.hpp>
+#include <ddspipe_core/communication/dds/latency_budget.hpp>
 #include <ddspipe_core/communication/dds/Track.hpp>
+#include <ddspipe_core/logging/LogThrottle.hpp>
+#include <ddspipe_core/monitoring/producers/TopicsMonitorProducer.hpp>
 
 namespace eprosima {
 namespace ddspipe {
@@ -31,7 +38,8 @@ namespace core {
 
 using namespace eprosima::ddspipe::core::types;
 
-const unsigned int Track::MAX_MESSAGES_TRANSMIT_LOOP_ = 100;
+const unsigned int Track::MAX_MESSAGES_TAKE_BATCH_ = 32;
+thread_local unsigned int Track::calls_in_thread_ = 0;
 
 Track::Track(
         const utils::Heritable<DistributedTopic>& topic,
@@ -43,16 +51,45 @@ Track::Track(
     : topic_(topic)
     , reader_participant_id_(reader_participant_id)
     , reader_(std::move(reader))
-    , writers_(std::move(writers))
+    , writers_(writers.begin(), writers.end())
     , payload_pool_(payload_pool)
     , enabled_(false)
     , exit_(false)
     , data_available_status_(DataAvailableStatus::no_more_data)
     , transmit_task_id_(utils::new_unique_task_id())
     , thread_pool_(thread_pool)
+    , quantum_samples_(topic->topic_qos.transmission_quantum_samples.get_value())
+    , quantum_time_(topic->topic_qos.transmission_quantum_time.get_value())
+    , yield_count_(0)
+    , first_transmission_ticks_(0)
+    , writer_queue_size_(topic->topic_qos.writer_queue_size.get_value())
+    , writer_queue_overflow_policy_(topic->topic_qos.writer_queue_overflow_policy.get_value())
+    , waiting_writer_queue_room_(false)
+    , inline_transmission_(topic->topic_qos.inline_transmission.get_value())
+    , conflation_threshold_(
+        topic->topic_qos.keyed.get_value() ? topic->topic_qos.conflation_threshold.get_value() : 0)
+    , max_forward_latency_(topic->topic_qos.max_forward_latency.get_value())
 {
     logDebug(DDSPIPE_TRACK, "Creating Track " << *this << ".");
 
+    taken_data_.reserve(MAX_MESSAGES_TAKE_BATCH_);
+
+    const auto* dds_topic = dynamic_cast<const types::DdsTopic*>(&(*topic));
+
+    if ((max_forward_latency_.count() > 0 || conflation_threshold_ > 0) && dds_topic != nullptr)
+    {
+        // Samples dropped by the QoS are notified as dropped by the participant of the reader
+        monitor_counters_ = monitor_counters(*dds_topic, reader_participant_id_);
+    }
+
+    if (use_writer_queues_())
+    {
+        for (const auto& writer_it : writers_)
+        {
+            create_writer_queue_nts_(writer_it.first, writer_it.second);
+        }
+    }
+
     // Set this track to on_data_available lambda call
     reader_->set_on_data_available_callback(std::bind(&Track::data_available_, this));
 
@@ -97,6 +134,9 @@ void Track::enable() noexcept
         // Without this, it could enable and never send the track slot again
         data_available_status_.store(DataAvailableStatus::no_more_data);
 
+        // A transmission waiting for room in a queue stopped with the Track, so it must not be awakened
+        waiting_writer_queue_room_.store(false);
+
         // Enable writers before reader, to avoid starting a transmission (not protected with \c track_mutex_) which may
         // attempt to write with a yet disabled writer
 
@@ -106,8 +146,17 @@ void Track::enable() noexcept
             writer_it.second->enable();
         }
 
+        // Enabling writer queues
+        for (auto& queue_it : writer_queues_)
+        {
+            queue_it.second->enable();
+        }
+
         // Enabling reader
-        reader_->enable();
+        call_reader_([this]()
+                {
+                    reader_->enable();
+                });
     }
 }
 
@@ -123,13 +172,23 @@ void Track::disable() noexcept
 
         // Do disable before stop in the mutex so the Track is forced to stop in next iteration
         enabled_ = false;
+
+        // Disable writer queues before waiting for the transmission, so their data is not written anymore
+        for (auto& queue_it : writer_queues_)
+        {
+            queue_it.second->disable();
+        }
+
         {
             // Stop if there is a transmission in course till the data is sent
             std::unique_lock<std::mutex> lock(on_transmission_mutex_);
         }
 
         // Disabling Reader
-        reader_->disable();
+        call_reader_([this]()
+                {
+                    reader_->disable();
+                });
 
         // Disabling Writers
         for (auto& writer_it : writers_)
@@ -151,7 +210,27 @@ void Track::add_writer(
         writer->enable();
     }
 
-    writers_[id] = writer;
+    auto writer_it = find_writer_nts_(id);
+
+    if (writer_it != writers_.end())
+    {
+        writer_it->second = writer;
+
+        // The queue of the writer replaced must not write anymore. Destroying it waits for the data being written.
+        writer_queues_.erase(id);
+    }
+    else
+    {
+        writers_.emplace_back(id, writer);
+    }
+
+    if (use_writer_queues_())
+    {
+        create_writer_queue_nts_(id, writer);
+    }
+
+    // The transmission may be waiting for room in the queue replaced
+    writer_queue_room_available_();
 }
 
 void Track::remove_writer(
@@ -159,12 +238,27 @@ void Track::remove_writer(
 {
     std::lock_guard<std::mutex> track_lock(track_mutex_);
     std::lock_guard<std::mutex> transmission_lock(on_transmission_mutex_);
-    writers_.erase(id);
+
+    // Destroying the queue waits for the data being written
+    writer_queues_.erase(id);
+
+    auto writer_it = find_writer_nts_(id);
+
+    if (writer_it != writers_.end())
+    {
+        writers_.erase(writer_it);
+    }
+
+    // The transmission may be waiting for room in the queue removed
+    writer_queue_room_available_();
 }
 
 void Track::update_reader()
 {
-    reader_->disable();
+    call_reader_([this]()
+            {
+                reader_->disable();
+            });
 }
 
 void Track::update_writers_topic_partitions(
@@ -179,24 +273,30 @@ void Track::update_writers_topic_partitions(
 void Track::update_reader_partitions(
         const std::set<std::string>& partitions_set)
 {
-    reader_->disable();
-    reader_->update_partitions(partitions_set);
-    reader_->enable();
+    call_reader_([this, &partitions_set]()
+            {
+                reader_->disable();
+                reader_->update_partitions(partitions_set);
+                reader_->enable();
+            });
 }
 
 void Track::update_reader_content_filter(
         const std::string& expression)
 {
-    reader_->disable();
-    reader_->update_content_topic_filter(expression);
-    reader_->enable();
+    call_reader_([this, &expression]()
+            {
+                reader_->disable();
+                reader_->update_content_topic_filter(expression);
+                reader_->enable();
+            });
 }
 
 bool Track::has_writer(
         const ParticipantId& id) noexcept
 {
     std::lock_guard<std::mutex> lock(track_mutex_);
-    return writers_.count(id) != 0;
+    return find_writer_nts_(id) != writers_.end();
 }
 
 bool Track::has_writers() noexcept
@@ -205,11 +305,136 @@ bool Track::has_writers() noexcept
     return writers_.size() > 0;
 }
 
+std::vector<std::pair<ParticipantId, std::shared_ptr<IWriter>>>::iterator Track::find_writer_nts_(
+        const ParticipantId& id) noexcept
+{
+    return std::find_if(writers_.begin(), writers_.end(),
+                   [&id](const std::pair<ParticipantId, std::shared_ptr<IWriter>>& writer)
+                   {
+                       return writer.first == id;
+                   });
+}
+
+std::uint64_t Track::yield_count() const noexcept
+{
+    return yield_count_.load(std::memory_order_relaxed);
+}
+
+std::chrono::steady_clock::time_point Track::first_transmission_time() const noexcept
+{
+    return std::chrono::steady_clock::time_point(
+        std::chrono::steady_clock::duration(first_transmission_ticks_.load(std::memory_order_relaxed)));
+}
+
+std::map<ParticipantId, WriterQueueMetrics> Track::writer_queues_metrics() noexcept
+{
+    std::lock_guard<std::mutex> lock(track_mutex_);
+
+    std::map<ParticipantId, WriterQueueMetrics> metrics;
+    for (const auto& queue_it : writer_queues_)
+    {
+        metrics[queue_it.first] = queue_it.second->metrics();
+    }
+
+    return metrics;
+}
+
+bool Track::use_writer_queues_() const noexcept
+{
+    return writer_queue_size_ > 0;
+}
+
+void Track::create_writer_queue_nts_(
+        const ParticipantId& id,
+        const std::shared_ptr<IWriter>& writer) noexcept
+{
+    if (writer_queues_.count(id))
+    {
+        return;
+    }
+
+    auto queue = std::make_unique<WriterQueue>(
+        id,
+        writer,
+        writer_queue_size_,
+        writer_queue_overflow_policy_,
+        thread_pool_,
+        std::bind(&Track::writer_queue_room_available_, this));
+
+    if (enabled_)
+    {
+        queue->enable();
+    }
+
+    writer_queues_[id] = std::move(queue);
+}
+
+std::size_t Track::writer_queues_room_nts_() noexcept
+{
+    if (!use_writer_queues_() || writer_queue_overflow_policy_ != WriterQueueOverflowPolicy::block)
+    {
+        return std::numeric_limits<std::size_t>::max();
+    }
+
+    // Set before checking the queues, so a queue that gets room meanwhile emits the transmission
+    waiting_writer_queue_room_.store(true);
+
+    std::size_t room = std::numeric_limits<std::size_t>::max();
+
+    for (auto& queue_it : writer_queues_)
+    {
+        // Stop in the first full queue, so only that one notifies when it has room
+        room = std::min(room, queue_it.second->room_or_notify());
+
+        if (room == 0)
+        {
+            return 0;
+        }
+    }
+
+    if (!waiting_writer_queue_room_.exchange(false))
+    {
+        // A queue full in a previous call has just notified and emitted the transmission, which must continue it
+        return 0;
+    }
+
+    return room;
+}
+
+void Track::writer_queue_room_available_() noexcept
+{
+    // Only the notification that finds the transmission waiting emits it, so it never runs twice
+    if (waiting_writer_queue_room_.exchange(false))
+    {
+        logDebug(DDSPIPE_TRACK, "Track " << *this << " resumes transmission after waiting for room in a queue.");
+
+        thread_pool_->emit(transmit_task_id_);
+    }
+}
+
 bool Track::should_transmit_() noexcept
 {
     return !exit_ && enabled_;
 }
 
+bool Track::quantum_exhausted_(
+        unsigned int processed_samples,
+        unsigned int max_samples,
+        const std::chrono::steady_clock::time_point& transmission_start) const noexcept
+{
+    if (processed_samples == 0)
+    {
+        return false;
+    }
+
+    if (max_samples > 0 && processed_samples >= max_samples)
+    {
+        return true;
+    }
+
+    return quantum_time_.count() > 0 && std::chrono::steady_clock::now() - transmission_start >= quantum_time_;
+}
+
 void Track::data_available_() noexcept
 {
     // Only hear callback if it is enabled
@@ -224,12 +449,52 @@ void Track::data_available_() noexcept
         {
             // no_more_data was set as current status, so no thread was running
             // (and will not start as 2 is set as new current status)
+            if (inline_transmission_ && calls_in_thread_ == 0)
+            {
+                // If the transmission is busy (being disabled or finishing a previous call), leave it to the pool
+                std::unique_lock<std::mutex> lock(on_transmission_mutex_, std::try_to_lock);
+
+                if (lock.owns_lock())
+                {
+                    logDebug(DDSPIPE_TRACK, "Track " << *this << " transmitting inline.");
+
+                    // Transmit a single batch at most, so the notifying thread is not stalled by long transmissions
+                    unsigned int max_samples = MAX_MESSAGES_TAKE_BATCH_;
+                    if (quantum_samples_ > 0)
+                    {
+                        max_samples = std::min(max_samples, quantum_samples_);
+                    }
+
+                    ++calls_in_thread_;
+                    transmit_nts_(lock, max_samples);
+                    --calls_in_thread_;
+                    return;
+                }
+            }
+
             thread_pool_->emit(transmit_task_id_);
             logDebug(DDSPIPE_TRACK, "Track " << *this << " send callback to queue.");
         }
     }
 }
 
+void Track::call_reader_(
+        const std::function<void()>& call) noexcept
+{
+    if (!inline_transmission_)
+    {
+        call();
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(on_transmission_mutex_);
+
+    // The Reader may notify data within the call, which must not transmit inline
+    ++calls_in_thread_;
+    call();
+    --calls_in_thread_;
+}
+
 void Track::transmit_() noexcept
 {
     // Loop that ends if it should stop transmitting (should_transmit_nts_).
@@ -240,16 +505,64 @@ void Track::transmit_() noexcept
     // enabled_ will be set to false before taking the mutex, so the track will finish after current iteration
     std::unique_lock<std::mutex> lock(on_transmission_mutex_);
 
-    // TODO: Count the times it loops to break it at some point if needed
+    transmit_nts_(lock, quantum_samples_);
+}
+
+void Track::transmit_nts_(
+        std::unique_lock<std::mutex>& lock,
+        unsigned int max_samples) noexcept
+{
+    // Samples taken (sent or dropped) and start time of this call, so the thread is released when the quantum runs out
+    unsigned int processed_samples = 0;
+    const auto transmission_start = std::chrono::steady_clock::now();
+    bool yield = false;
+
     while (should_transmit_())
     {
+        if (quantum_exhausted_(processed_samples, max_samples, transmission_start))
+        {
+            // Status is still >= transmitting_data, so no listener will emit the task meanwhile
+            yield = true;
+            break;
+        }
+
+        // With block policy, a full queue stops the transmission instead of holding this thread until it has room.
+        // Status is still >= transmitting_data, so no listener will emit the task until the queue notifies.
+        const std::size_t room = writer_queues_room_nts_();
+
+        if (room == 0)
+        {
+            logDebug(DDSPIPE_TRACK, "Track " << *this << " waits for room in a writer queue.");
+            break;
+        }
+
         // It starts transmitting, so it sets the data available status as transmitting
         // This will erase every previous value added in on_data_available and set 1
         data_available_status_.store(DataAvailableStatus::transmitting_data);
 
-        // Get data received (send empty data to be created(allocated) in reader)
-        std::unique_ptr<IRoutingData> data;
-        auto ret = reader_->take(data);
+        // Do not take more data than the quantum or the queues allow
+        std::size_t batch_samples = std::min<std::size_t>(MAX_MESSAGES_TAKE_BATCH_, room);
+        if (max_samples > 0)
+        {
+            batch_samples = std::min<std::size_t>(batch_samples, max_samples - processed_samples);
+        }
+
+        // Get data received (send empty vector to be filled with data created(allocated) in reader)
+        taken_data_.clear();
+        auto ret = reader_->take_batch(taken_data_, batch_samples);
+
+        if (ret == utils::ReturnCode::RETCODE_OK && conflation_threshold_ > 0 && conflation_threshold_ <= room &&
+                taken_data_.size() >= batch_samples)
+        {
+            // The batch is full, so the reader may have a backlog
+            processed_samples += conflate_backlog_nts_();
+        }
+
+        if (ret == utils::ReturnCode::RETCODE_OK && max_forward_latency_.count() > 0)
+        {
+            // Samples dropped count towards the quantum, so discarding a long backlog also yields
+            processed_samples += drop_stale_samples_nts_();
+        }
 
         if (ret == utils::ReturnCode::RETCODE_NO_DATA)
         {
@@ -277,7 +590,7 @@ void Track::transmit_() noexcept
         else if (ret != utils::ReturnCode::RETCODE_OK)
         {
             // Error reading data
-            EPROSIMA_LOG_WARNING(DDSPIPE_TRACK,
+            DDSPIPE_LOG_WARNING_THROTTLED(DDSPIPE_TRACK,
                     "Error taking data in Track " << topic_->serialize() << ". Error code " << ret
                                                   << ". Skipping data and continue.");
             continue;
@@ -285,31 +598,122 @@ void Track::transmit_() noexcept
 
         logDebug(DDSPIPE_TRACK,
                 "Track " << reader_participant_id_ << " for topic " << topic_->serialize()
-                         << " transmitting data from remote endpoint.");
+                         << " transmitting " << taken_data_.size() << " data from remote endpoint.");
 
-        // Send data through writers
-        for (auto& writer_it : writers_)
+        if (use_writer_queues_())
         {
-            logDebug(
-                DDSPIPE_TRACK,
-                "Forwarding data to writer " << writer_it.first << ".");
-
-            ret = writer_it.second->write(*data);
+            // Share each data among the writer queues, so it is released when the last writer has sent it
+            for (auto& data : taken_data_)
+            {
+                std::shared_ptr<IRoutingData> shared_data(std::move(data));
 
-            if (ret != utils::ReturnCode::RETCODE_OK)
+                for (auto& queue_it : writer_queues_)
+                {
+                    queue_it.second->push(shared_data);
+                }
+            }
+        }
+        else
+        {
+            // Send the whole batch through each writer
+            for (auto& writer_it : writers_)
             {
-                EPROSIMA_LOG_WARNING(
+                logDebug(
                     DDSPIPE_TRACK,
-                    "Error writting data in Track " << topic_->serialize()
-                                                    << " for writer " << writer_it.second.get()
-                                                    << ". Error code " << ret
-                                                    << ". Skipping data for this writer and continue.");
-                continue;
+                    "Forwarding data to writer " << writer_it.first << ".");
+
+                for (auto& data : taken_data_)
+                {
+                    ret = writer_it.second->write(*data);
+
+                    if (ret != utils::ReturnCode::RETCODE_OK)
+                    {
+                        DDSPIPE_LOG_WARNING_THROTTLED(
+                            DDSPIPE_TRACK,
+                            "Error writting data in Track " << topic_->serialize()
+                                                            << " for writer " << writer_it.second.get()
+                                                            << ". Error code " << ret
+                                                            << ". Skipping data for this writer and continue.");
+                        continue;
+                    }
+                }
             }
         }
 
-        // Let the data be removed by itself
+        processed_samples += taken_data_.size();
+
+        // Only one transmission runs at a time, so there is no race setting it
+        if (!taken_data_.empty() && first_transmission_ticks_.load(std::memory_order_relaxed) == 0)
+        {
+            first_transmission_ticks_.store(
+                std::chrono::steady_clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+        }
+
+        // Let the data of this batch be removed by itself, so its payloads are released right away
+        taken_data_.clear();
     }
+
+    if (yield)
+    {
+        // Release the transmission before emitting, so the next call does not wait for this one
+        lock.unlock();
+
+        yield_count_.fetch_add(1, std::memory_order_relaxed);
+
+        logDebug(DDSPIPE_TRACK,
+                "Track " << *this << " yields after processing " << processed_samples << " samples.");
+
+        thread_pool_->emit(transmit_task_id_);
+    }
+}
+
+std::size_t Track::conflate_backlog_nts_() noexcept
+{
+    // Take the backlog up to the threshold, to know whether the Track is falling behind
+    if (taken_data_.size() < conflation_threshold_)
+    {
+        reader_->take_batch(taken_data_, conflation_threshold_ - taken_data_.size());
+    }
+
+    if (taken_data_.size() < conflation_threshold_)
+    {
+        // The Track keeps up with the reader, so every sample is forwarded
+        return 0;
+    }
+
+    const auto conflated = conflate_instances(taken_data_);
+
+    if (conflated > 0)
+    {
+        logDebug(DDSPIPE_TRACK,
+                "Track " << *this << " drops " << conflated << " samples superseded by newer ones of their instance.");
+
+        if (monitor_counters_)
+        {
+            monitor_counters_msgs_dropped(monitor_counters_, conflated);
+        }
+    }
+
+    return conflated;
+}
+
+std::size_t Track::drop_stale_samples_nts_() noexcept
+{
+    const auto dropped = drop_stale_samples(taken_data_, max_forward_latency_, std::chrono::system_clock::now());
+
+    if (dropped > 0)
+    {
+        logDebug(DDSPIPE_TRACK,
+                "Track " << *this << " drops " << dropped << " samples older than " << max_forward_latency_.count()
+                         << " ms.");
+
+        if (monitor_counters_)
+        {
+            monitor_counters_msgs_dropped(monitor_counters_, dropped);
+        }
+    }
+
+    return dropped;
 }
 
 std::ostream& operator <<(
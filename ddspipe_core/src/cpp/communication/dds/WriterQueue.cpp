@@ -0,0 +1,264 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file WriterQueue.cpp
+ *
+ */
+
+#include <algorithm>
+#include <functional>
+
+#include <cpp_utils/Log.hpp>
+#include <cpp_utils/ReturnCode.hpp>
+#include <cpp_utils/thread_pool/task/TaskId.hpp>
+#include <cpp_utils/utils.hpp>
+
+#include <ddspipe_core/communication/dds/WriterQueue.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+using namespace eprosima::ddspipe::core::types;
+
+WriterQueue::WriterQueue(
+        const ParticipantId& writer_participant_id,
+        const std::shared_ptr<IWriter>& writer,
+        const std::size_t capacity,
+        const WriterQueueOverflowPolicy overflow_policy,
+        const std::shared_ptr<utils::SlotThreadPool>& thread_pool,
+        const std::function<void()>& on_room_available) noexcept
+    : writer_participant_id_(writer_participant_id)
+    , writer_(writer)
+    , capacity_(std::max<std::size_t>(capacity, 1))
+    , overflow_policy_(overflow_policy)
+    , enabled_(false)
+    , draining_(false)
+    , notify_room_(false)
+    , max_depth_(0)
+    , dropped_(0)
+    , on_room_available_(on_room_available)
+    , drain_task_id_(utils::new_unique_task_id())
+    , drain_slot_(std::make_shared<DrainSlot>())
+    , thread_pool_(thread_pool)
+{
+    drain_slot_->queue = this;
+
+    // The slot cannot be removed from the pool, so it only holds the shared slot and not the queue itself
+    std::shared_ptr<DrainSlot> drain_slot = drain_slot_;
+    thread_pool_->slot(
+        drain_task_id_,
+        [drain_slot]()
+        {
+            std::lock_guard<std::mutex> lock(drain_slot->mutex);
+
+            if (drain_slot->queue != nullptr)
+            {
+                drain_slot->queue->drain_();
+            }
+        });
+}
+
+WriterQueue::~WriterQueue()
+{
+    disable();
+
+    // Wait for a drain task running and make the ones pending do nothing
+    std::lock_guard<std::mutex> lock(drain_slot_->mutex);
+    drain_slot_->queue = nullptr;
+}
+
+void WriterQueue::enable() noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (!enabled_)
+    {
+        enabled_ = true;
+
+        // A drain task may have exited because of disable without finding the queue empty
+        draining_ = false;
+    }
+}
+
+void WriterQueue::disable() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (!enabled_)
+        {
+            return;
+        }
+
+        enabled_ = false;
+
+        // Release the data that will not be written, so their payloads return to the pool
+        queue_.clear();
+
+        // The owner stops waiting for room when it disables the queue
+        notify_room_ = false;
+    }
+
+    {
+        // Stop if there is a data being written till it is sent
+        std::lock_guard<std::mutex> lock(on_drain_mutex_);
+    }
+}
+
+bool WriterQueue::push(
+        const std::shared_ptr<IRoutingData>& data) noexcept
+{
+    bool emit_drain = false;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (!enabled_)
+        {
+            return false;
+        }
+
+        if (queue_.size() >= capacity_)
+        {
+            switch (overflow_policy_)
+            {
+                case WriterQueueOverflowPolicy::drop_oldest:
+                    queue_.pop_front();
+                    ++dropped_;
+                    break;
+
+                case WriterQueueOverflowPolicy::drop_newest:
+                    ++dropped_;
+                    return false;
+
+                case WriterQueueOverflowPolicy::block:
+                    // Waiting would hold a thread of the pool, so the caller must check room_or_notify before
+                    logDevError(DDSPIPE_TRACK, "Data pushed to a full blocking queue of writer "
+                            << writer_participant_id_ << ".");
+                    ++dropped_;
+                    return false;
+
+                default:
+                    utils::tsnh(utils::Formatter() << "Invalid Writer Queue Overflow Policy.");
+                    break;
+            }
+        }
+
+        queue_.push_back(data);
+        max_depth_ = std::max(max_depth_, queue_.size());
+
+        if (!draining_)
+        {
+            draining_ = true;
+            emit_drain = true;
+        }
+    }
+
+    if (emit_drain)
+    {
+        thread_pool_->emit(drain_task_id_);
+    }
+
+    return true;
+}
+
+std::size_t WriterQueue::room_or_notify() noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (!enabled_)
+    {
+        return capacity_;
+    }
+
+    const std::size_t room = capacity_ - std::min(queue_.size(), capacity_);
+
+    if (room == 0)
+    {
+        notify_room_ = true;
+    }
+
+    return room;
+}
+
+WriterQueueMetrics WriterQueue::metrics() const noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    WriterQueueMetrics metrics;
+    metrics.depth = queue_.size();
+    metrics.max_depth = max_depth_;
+    metrics.dropped = dropped_;
+
+    return metrics;
+}
+
+void WriterQueue::drain_() noexcept
+{
+    // Lock Mutex on_drain while data is being written, so the queue is not disabled meanwhile
+    std::lock_guard<std::mutex> drain_lock(on_drain_mutex_);
+
+    // Write at most a full queue in each call, so this task does not hold the thread while data keeps arriving
+    for (std::size_t written = 0; written < capacity_; ++written)
+    {
+        std::shared_ptr<IRoutingData> data;
+        bool notify_room = false;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            if (!enabled_)
+            {
+                return;
+            }
+
+            if (queue_.empty())
+            {
+                // Next push must emit the task again
+                draining_ = false;
+                return;
+            }
+
+            data = std::move(queue_.front());
+            queue_.pop_front();
+
+            std::swap(notify_room, notify_room_);
+        }
+
+        if (notify_room && on_room_available_)
+        {
+            on_room_available_();
+        }
+
+        auto ret = writer_->write(*data);
+
+        if (ret != utils::ReturnCode::RETCODE_OK)
+        {
+            EPROSIMA_LOG_WARNING(
+                DDSPIPE_TRACK,
+                "Error writting data in writer " << writer_participant_id_
+                                                 << ". Error code " << ret
+                                                 << ". Skipping data for this writer and continue.");
+        }
+    }
+
+    // There may be data left: keep draining_ set and let other tasks run before continuing
+    thread_pool_->emit(drain_task_id_);
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,78 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file conflation.cpp
+ *
+ */
+
+#include <algorithm>
+#include <set>
+
+#include <ddspipe_core/communication/dds/conflation.hpp>
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+using namespace eprosima::ddspipe::core::types;
+
+namespace {
+
+//! The sample if it can be conflated with other samples of its instance, nullptr otherwise
+const RtpsPayloadData* conflatable_sample(
+        const std::unique_ptr<IRoutingData>& data) noexcept
+{
+    const auto* rtps_data = dynamic_cast<const RtpsPayloadData*>(data.get());
+
+    if (rtps_data == nullptr ||
+            !rtps_data->instanceHandle.isDefined() ||
+            rtps_data->kind != ChangeKind::ALIVE)
+    {
+        return nullptr;
+    }
+
+    return rtps_data;
+}
+
+} /* namespace */
+
+std::size_t conflate_instances(
+        std::vector<std::unique_ptr<IRoutingData>>& data) noexcept
+{
+    // Walk from the newest sample, so the first sample found of each instance is the one kept
+    std::set<InstanceHandle> instances_seen;
+
+    for (auto it = data.rbegin(); it != data.rend(); ++it)
+    {
+        const auto* rtps_data = conflatable_sample(*it);
+
+        if (rtps_data != nullptr && !instances_seen.insert(rtps_data->instanceHandle).second)
+        {
+            // A newer sample of this instance is kept
+            it->reset();
+        }
+    }
+
+    const auto new_end = std::remove(data.begin(), data.end(), nullptr);
+    const std::size_t removed = static_cast<std::size_t>(data.end() - new_end);
+    data.erase(new_end, data.end());
+
+    return removed;
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,87 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file latency_budget.cpp
+ *
+ */
+
+#include <algorithm>
+
+#include <ddspipe_core/communication/dds/latency_budget.hpp>
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+using namespace eprosima::ddspipe::core::types;
+
+namespace {
+
+//! Whether the sample was published more than \c max_latency before \c now
+bool is_stale(
+        const std::unique_ptr<IRoutingData>& data,
+        const std::chrono::nanoseconds& max_latency,
+        const std::chrono::system_clock::time_point& now) noexcept
+{
+    const auto* rtps_data = dynamic_cast<const RtpsPayloadData*>(data.get());
+
+    if (rtps_data == nullptr)
+    {
+        return false;
+    }
+
+    const auto& source_timestamp = rtps_data->source_timestamp;
+
+    if (source_timestamp.seconds() == 0 && source_timestamp.nanosec() == 0)
+    {
+        // The publisher did not set the timestamp
+        return false;
+    }
+
+    if (source_timestamp.seconds() < 0 || source_timestamp.nanosec() >= 1000000000u)
+    {
+        // The timestamp is invalid (e.g. c_RTPSTimeInvalid) or infinite, so the age of the sample is unknown
+        return false;
+    }
+
+    const auto source_time =
+            std::chrono::seconds(source_timestamp.seconds()) + std::chrono::nanoseconds(source_timestamp.nanosec());
+
+    return now.time_since_epoch() - source_time > max_latency;
+}
+
+} /* namespace */
+
+std::size_t drop_stale_samples(
+        std::vector<std::unique_ptr<IRoutingData>>& data,
+        const std::chrono::nanoseconds& max_latency,
+        const std::chrono::system_clock::time_point& now) noexcept
+{
+    const auto new_end = std::remove_if(data.begin(), data.end(),
+                    [&max_latency, &now](const std::unique_ptr<IRoutingData>& sample)
+                    {
+                        return is_stale(sample, max_latency, now);
+                    });
+
+    const std::size_t removed = static_cast<std::size_t>(data.end() - new_end);
+    data.erase(new_end, data.end());
+
+    return removed;
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
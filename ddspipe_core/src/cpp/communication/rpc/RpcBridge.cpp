@@ -17,6 +17,7 @@
  *
  */
 
+#include <algorithm>
 #include <functional>
 
 
@@ -37,10 +38,17 @@ RpcBridge::RpcBridge(
         const RpcTopic& topic,
         const std::shared_ptr<ParticipantsDatabase>& participants_database,
         const std::shared_ptr<PayloadPool>& payload_pool,
-        const std::shared_ptr<utils::SlotThreadPool>& thread_pool)
+        const std::shared_ptr<utils::SlotThreadPool>& thread_pool,
+        const unsigned int max_pending_requests,
+        const std::chrono::milliseconds& request_timeout,
+        const RpcDispatchPolicy dispatch_policy)
     : Bridge(participants_database, payload_pool, thread_pool)
     , init_(false)
     , rpc_topic_(topic)
+    , max_pending_requests_(max_pending_requests)
+    , request_timeout_(request_timeout)
+    , dispatch_policy_(dispatch_policy)
+    , next_target_(0)
 {
     logDebug(DDSPIPE_RPCBRIDGE, "Creating RpcBridge " << *this << ".");
 
@@ -69,9 +77,11 @@ void RpcBridge::init_nts_()
     {
         create_proxy_client_nts_(id);
         create_proxy_server_nts_(id);
-        if (current_servers_[id].size())
+
+        const ParticipantHandle handle = intern_participant_id(id);
+        if (has_servers_(handle))
         {
-            service_registries_[id]->enable();
+            service_registries_[handle]->enable();
         }
     }
 
@@ -85,26 +95,37 @@ void RpcBridge::create_proxy_server_nts_(
         ParticipantId participant_id)
 {
     std::shared_ptr<IParticipant> participant = participants_->get_participant(participant_id);
+    const ParticipantHandle handle = intern_participant_id(participant_id);
 
-    reply_writers_[participant_id] = participant->create_writer(rpc_topic_.reply_topic());
-    request_readers_[participant_id] = participant->create_reader(rpc_topic_.request_topic());
+    reply_writers_[handle] = participant->create_writer(rpc_topic_.reply_topic());
+    request_readers_[handle] = participant->create_reader(rpc_topic_.request_topic());
 
-    create_slot_(request_readers_[participant_id]);
+    create_slot_(request_readers_[handle], handle);
 }
 
 void RpcBridge::create_proxy_client_nts_(
         ParticipantId participant_id)
 {
     std::shared_ptr<IParticipant> participant = participants_->get_participant(participant_id);
+    const ParticipantHandle handle = intern_participant_id(participant_id);
 
     // Safe casting as we are only getting RTPS participants
-    request_writers_[participant_id] = participant->create_writer(rpc_topic_.request_topic());
-    reply_readers_[participant_id] = participant->create_reader(rpc_topic_.reply_topic());
+    request_writers_[handle] = participant->create_writer(rpc_topic_.request_topic());
+    reply_readers_[handle] = participant->create_reader(rpc_topic_.reply_topic());
+
+    create_slot_(reply_readers_[handle], handle);
 
-    create_slot_(reply_readers_[participant_id]);
+    if (participant->is_repeater())
+    {
+        repeater_participants_.insert(handle);
+    }
 
     // Create service registry associated to this proxy client
-    service_registries_[participant_id] = std::make_shared<ServiceRegistry>(rpc_topic_, participant_id);
+    service_registries_[handle] = std::make_shared<ServiceRegistry>(
+        rpc_topic_,
+        participant_id,
+        max_pending_requests_,
+        request_timeout_);
 }
 
 void RpcBridge::enable() noexcept
@@ -198,10 +219,17 @@ void RpcBridge::discovered_service(
         const types::ParticipantId& server_participant_id,
         const types::GuidPrefix& server_guid_prefix) noexcept
 {
-    current_servers_[server_participant_id].emplace(server_guid_prefix);
+    const ParticipantHandle server_participant_handle = intern_participant_id(server_participant_id);
+
+    {
+        std::lock_guard<std::mutex> lock(servers_mutex_);
+
+        current_servers_[server_participant_handle].emplace(server_guid_prefix);
+    }
+
     if (init_)
     {
-        service_registries_[server_participant_id]->enable();
+        service_registries_[server_participant_handle]->enable();
     }
     else
     {
@@ -212,8 +240,13 @@ void RpcBridge::removed_service(
         const types::ParticipantId& server_participant_id,
         const types::GuidPrefix& server_guid_prefix) noexcept
 {
-    current_servers_[server_participant_id].erase(server_guid_prefix);
-    if (!current_servers_[server_participant_id].size() && !servers_available_())
+    {
+        std::lock_guard<std::mutex> lock(servers_mutex_);
+
+        current_servers_[intern_participant_id(server_participant_id)].erase(server_guid_prefix);
+    }
+
+    if (!servers_available_())
     {
         disable();
     }
@@ -221,6 +254,8 @@ void RpcBridge::removed_service(
 
 bool RpcBridge::servers_available_() const noexcept
 {
+    std::lock_guard<std::mutex> lock(servers_mutex_);
+
     for (auto it = current_servers_.begin(); it != current_servers_.end(); it++)
     {
         if (it->second.size())
@@ -231,6 +266,141 @@ bool RpcBridge::servers_available_() const noexcept
     return false;
 }
 
+bool RpcBridge::has_servers_(
+        const ParticipantHandle participant_handle) const noexcept
+{
+    std::lock_guard<std::mutex> lock(servers_mutex_);
+
+    return has_servers_nts_(participant_handle);
+}
+
+bool RpcBridge::has_servers_nts_(
+        const ParticipantHandle participant_handle) const noexcept
+{
+    const auto it = current_servers_.find(participant_handle);
+
+    return it != current_servers_.end() && !it->second.empty();
+}
+
+void RpcBridge::dispatch_targets_(
+        const ParticipantHandle participant_receiver,
+        std::vector<ParticipantHandle>& targets) noexcept
+{
+    targets.clear();
+
+    {
+        // Registries are not disabled when their servers leave, so check them when sending through a single one
+        std::unique_lock<std::mutex> lock(servers_mutex_, std::defer_lock);
+
+        if (dispatch_policy_ != RpcDispatchPolicy::BROADCAST)
+        {
+            lock.lock();
+        }
+
+        for (const auto& service_registry : service_registries_)
+        {
+            // Do not send request through same participant who received it (unless repeater),
+            // or if there are no servers to process it
+            if ((participant_receiver == service_registry.first &&
+                    repeater_participants_.count(service_registry.first) == 0) ||
+                    !service_registry.second->enabled())
+            {
+                continue;
+            }
+
+            if (lock.owns_lock() && !has_servers_nts_(service_registry.first))
+            {
+                continue;
+            }
+
+            targets.push_back(service_registry.first);
+        }
+    }
+
+    if (targets.size() < 2)
+    {
+        return;
+    }
+
+    std::size_t preferred = 0;
+
+    switch (dispatch_policy_)
+    {
+        case RpcDispatchPolicy::ROUND_ROBIN:
+            preferred = next_target_.fetch_add(1, std::memory_order_relaxed) % targets.size();
+            break;
+
+        case RpcDispatchPolicy::LEAST_OUTSTANDING:
+        {
+            // The size of the registries is read without locking them
+            std::size_t least_pending = service_registries_.at(targets[0])->size();
+
+            for (std::size_t i = 1; i < targets.size(); ++i)
+            {
+                const std::size_t pending = service_registries_.at(targets[i])->size();
+
+                if (pending < least_pending)
+                {
+                    least_pending = pending;
+                    preferred = i;
+                }
+            }
+
+            break;
+        }
+
+        default:
+            break;
+    }
+
+    // Keep the order of the others after the preferred one, so the fallback is also balanced
+    std::rotate(targets.begin(), targets.begin() + preferred, targets.end());
+}
+
+void RpcBridge::forward_request_(
+        RpcPayloadData& rpc_data,
+        const SampleIdentity& reply_related_sample_identity,
+        std::vector<ParticipantHandle>& targets) noexcept
+{
+    dispatch_targets_(rpc_data.participant_receiver, targets);
+
+    for (const auto& target : targets)
+    {
+        const auto& service_registry = service_registries_.at(target);
+
+        // Perform write + add entry to registry atomically -> avoid reply processed before entry added to registry
+        std::lock_guard<std::mutex> lock(service_registry->get_mutex());
+
+        // Attach the information the server needs in order to reply to the appropiate proxy client.
+        rpc_data.write_params.set_level();
+        rpc_data.write_params.get_reference().related_sample_identity().writer_guid(
+            reply_readers_[target]->guid());
+
+        utils::ReturnCode ret = request_writers_[target]->write(rpc_data);
+
+        if (ret != utils::ReturnCode::RETCODE_OK)
+        {
+            EPROSIMA_LOG_WARNING(DDSPIPE_RPCBRIDGE, "Error writting request in RpcBridge for service "
+                    << rpc_topic_ << ". Error code " << ret <<
+                    ". Skipping data for this writer and continue.");
+            continue;
+        }
+
+        eprosima::fastdds::rtps::SequenceNumber_t sequence_number =
+                rpc_data.sent_sequence_number;
+        // Add entry to registry associated to the transmission of this request through this proxy client.
+        service_registry->add_nts(
+            sequence_number,
+            {rpc_data.participant_receiver, reply_related_sample_identity});
+
+        if (dispatch_policy_ != RpcDispatchPolicy::BROADCAST)
+        {
+            // Request sent to a single server participant, the others are only a fallback
+            break;
+        }
+    }
+}
+
 void RpcBridge::data_available_(
         const Guid& reader_guid) noexcept
 {
@@ -260,7 +430,8 @@ void RpcBridge::data_available_(
 }
 
 void RpcBridge::transmit_(
-        std::shared_ptr<IReader> reader) noexcept
+        std::shared_ptr<IReader> reader,
+        const ParticipantHandle participant_handle) noexcept
 {
     // Avoid being disabled while transmitting
     std::shared_lock<std::shared_timed_mutex> lock(on_transmission_mutex_);
@@ -268,6 +439,10 @@ void RpcBridge::transmit_(
     logDebug(DDSPIPE_RPCBRIDGE, "RpcBridge " << *this <<
             " transmitting for reader " << reader->guid() << " .");
 
+    // Participants each request is forwarded to, reused for every request taken in this transmission
+    std::vector<ParticipantHandle> targets;
+    targets.reserve(service_registries_.size());
+
     while (true)
     {
         {
@@ -329,43 +504,7 @@ void RpcBridge::transmit_(
             }
             else
             {
-                for (auto& service_registry : service_registries_)
-                {
-                    // Do not send request through same participant who received it (unless repeater), or if there are no servers to process it
-                    if ((rpc_data.participant_receiver == service_registry.first &&
-                            !participants_->get_participant(service_registry.first)->is_repeater()) ||
-                            !service_registry.second->enabled())
-                    {
-                        continue;
-                    }
-
-                    // Perform write + add entry to registry atomically -> avoid reply processed before entry added to registry
-                    std::lock_guard<std::recursive_mutex> lock(service_registry.second->get_mutex());
-
-                    // Attach the information the server needs in order to reply to the appropiate proxy client.
-                    rpc_data.write_params.set_level();
-                    rpc_data.write_params.get_reference().related_sample_identity().writer_guid(
-                        reply_readers_[service_registry.first]->guid());
-
-
-                    ret = request_writers_[service_registry.first]->write(*data);
-
-                    if (ret != utils::ReturnCode::RETCODE_OK)
-                    {
-                        EPROSIMA_LOG_WARNING(DDSPIPE_RPCBRIDGE, "Error writting request in RpcBridge for service "
-                                << rpc_topic_ << ". Error code " << ret <<
-                                ". Skipping data for this writer and continue.");
-                        continue;
-                    }
-
-                    eprosima::fastdds::rtps::SequenceNumber_t sequence_number =
-                            rpc_data.sent_sequence_number;
-                    // Add entry to registry associated to the transmission of this request through this proxy client.
-                    service_registry.second->add(
-                        sequence_number,
-                        {rpc_data.participant_receiver, reply_related_sample_identity});
-
-                }
+                forward_request_(rpc_data, reply_related_sample_identity, targets);
             }
         }
         else if (RpcTopic::is_reply_topic(reader->topic()))
@@ -385,22 +524,16 @@ void RpcBridge::transmit_(
             }
             else
             {
-                std::pair<ParticipantId, SampleIdentity> registry_entry;
-                {
-                    // Wait for request transmission to be finished (entry added to registry)
-                    std::lock_guard<std::recursive_mutex> lock(
-                        service_registries_[reader->participant_id()]->get_mutex());
-
-                    // Fetch information required for transmission; which proxy server should send it and with what parameters
-                    registry_entry = service_registries_[reader->participant_id()]->get(
-                        rpc_data.write_params.get_reference().sample_identity().sequence_number());
-                }
+                // Fetch information required for transmission; which proxy server should send it and with what parameters
+                // NOTE: get waits for the request transmission to be finished (entry added to registry)
+                std::pair<ParticipantHandle, SampleIdentity> registry_entry =
+                        service_registries_.at(participant_handle)->get(
+                    rpc_data.write_params.get_reference().sample_identity().sequence_number());
 
                 // Not valid means:
                 //   Case 1: (SimpleParticipant) Request already replied by another server connected to the same participant as this one.
                 //   Case 2: (WAN Participant repeater) Request already replied by another PROXY server connected to the same participant as this one.
-                // TODO: recheck ParticipantId non valid
-                if (!registry_entry.first.empty())
+                if (registry_entry.first != INVALID_PARTICIPANT_HANDLE)
                 {
                     rpc_data.write_params.set_level();
                     rpc_data.write_params.get_reference().related_sample_identity(registry_entry.second);
@@ -414,7 +547,7 @@ void RpcBridge::transmit_(
                     }
                     else
                     {
-                        service_registries_[reader->participant_id()]->erase(
+                        service_registries_.at(participant_handle)->erase(
                             rpc_data.write_params.get_reference().sample_identity().sequence_number());
                     }
                 }
@@ -431,7 +564,8 @@ void RpcBridge::transmit_(
 }
 
 void RpcBridge::create_slot_(
-        std::shared_ptr<IReader> reader) noexcept
+        std::shared_ptr<IReader> reader,
+        const ParticipantHandle participant_handle) noexcept
 {
     Guid reader_guid = reader->guid();
 
@@ -447,7 +581,7 @@ void RpcBridge::create_slot_(
         task_id,
         [=]()
         {
-            transmit_(reader);
+            transmit_(reader, participant_handle);
         });
     tasks_map_[reader_guid] = {false, task_id};
 }
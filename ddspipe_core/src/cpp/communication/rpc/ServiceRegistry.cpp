@@ -17,7 +17,6 @@
  *
  */
 
-#include <regex>
 #include <string>
 
 #include <cpp_utils/Log.hpp>
@@ -30,14 +29,42 @@ namespace core {
 
 using namespace eprosima::ddspipe::core::types;
 
-const unsigned int ServiceRegistry::DEFAULT_MAX_ENTRIES_ = 5000;
+constexpr const unsigned int ServiceRegistry::DEFAULT_CAPACITY;
+
+namespace {
+
+//! Smallest power of two not lower than \c value
+std::size_t next_power_of_two(
+        std::size_t value) noexcept
+{
+    std::size_t result = 1;
+
+    while (result < value)
+    {
+        result <<= 1;
+    }
+
+    return result;
+}
+
+} /* namespace */
 
 ServiceRegistry::ServiceRegistry(
         const RpcTopic& topic,
-        const ParticipantId& participant_id)
+        const ParticipantId& participant_id,
+        const unsigned int capacity,
+        const std::chrono::milliseconds& request_timeout)
     : topic_(topic)
     , participant_id_(participant_id)
     , enabled_(false)
+    , capacity_(capacity > 0 ? capacity : 1)
+    , request_timeout_(request_timeout)
+    , slots_(next_power_of_two(capacity_ * 2))
+    , size_(0)
+    , next_reap_time_(std::chrono::steady_clock::now() + request_timeout)
+    , expired_requests_(0)
+    , evicted_requests_(0)
+    , monitor_counters_(monitor_service_counters(topic.service_name(), participant_id))
 {
     logDebug(DDSPIPE_SERVICEREGISTRY,
             "ServiceRegistry created for service " << topic <<
@@ -61,11 +88,27 @@ bool ServiceRegistry::enabled() const noexcept
 
 void ServiceRegistry::add(
         SequenceNumber idx,
-        std::pair<ParticipantId, SampleIdentity> new_entry) noexcept
+        const std::pair<ParticipantHandle, SampleIdentity>& new_entry) noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    add_nts(idx, new_entry);
+}
+
+void ServiceRegistry::add_nts(
+        SequenceNumber idx,
+        const std::pair<ParticipantHandle, SampleIdentity>& new_entry) noexcept
 {
-    std::lock_guard<std::recursive_mutex> lock(mutex_);
+    const auto now = std::chrono::steady_clock::now();
+
+    // Remove the expired requests once per timeout, so they do not fill the registry
+    if (request_timeout_.count() > 0 && now >= next_reap_time_)
+    {
+        reap_expired_nts_(now);
+        next_reap_time_ = now + request_timeout_;
+    }
 
-    if (registry_.count(idx))
+    if (slots_[find_slot_nts_(idx)].used)
     {
         // Should never occur as each sequence number associated to a write operation is unique
         EPROSIMA_LOG_WARNING(DDSPIPE_SERVICEREGISTRY,
@@ -74,55 +117,230 @@ void ServiceRegistry::add(
         return;
     }
 
-    registry_[idx] = new_entry;
-
-    // Remove oldest entry if registry full
-    // TMP: Use configuration specs value when available
-    if (registry_.size() == DEFAULT_MAX_ENTRIES_)
+    if (size_.load(std::memory_order_relaxed) >= capacity_ && reap_expired_nts_(now) == 0)
     {
-        registry_.erase(registry_.begin());
+        evict_oldest_nts_();
     }
+
+    // Look for the slot again, as removing entries moves the others
+    auto& slot = slots_[find_slot_nts_(idx)];
+    slot.used = true;
+    slot.sequence_number = idx;
+    slot.participant_handle = new_entry.first;
+    slot.sample_identity = new_entry.second;
+    slot.request_time = now;
+
+    const std::size_t size = size_.fetch_add(1, std::memory_order_relaxed) + 1;
+
+    monitor_service_request(monitor_counters_);
+    monitor_service_requests_pending(monitor_counters_, size);
 }
 
-std::pair<ParticipantId, SampleIdentity> ServiceRegistry::get(
-        SequenceNumber idx) const noexcept
+std::pair<ParticipantHandle, SampleIdentity> ServiceRegistry::get(
+        SequenceNumber idx) noexcept
 {
-    std::lock_guard<std::recursive_mutex> lock(mutex_);
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    const auto slot_idx = find_slot_nts_(idx);
+    const auto& slot = slots_[slot_idx];
 
-    std::pair<ParticipantId, SampleIdentity> ret;
-    if (registry_.count(idx))
+    if (!slot.used)
     {
-        ret = registry_.at(idx);
+        // Already replied, expired or evicted
+        monitor_service_reply_discarded(monitor_counters_);
+        return {INVALID_PARTICIPANT_HANDLE, SampleIdentity()};
     }
-    else
+
+    if (is_expired_nts_(slot, std::chrono::steady_clock::now()))
     {
-        ret = {ParticipantId(), SampleIdentity()};
+        EPROSIMA_LOG_WARNING(DDSPIPE_SERVICEREGISTRY,
+                "ServiceRegistry for service " << topic_ << " in participant " << participant_id_ <<
+                " received the reply of request " << idx << " after it expired.");
+
+        erase_slot_nts_(slot_idx);
+        expired_requests_.fetch_add(1, std::memory_order_relaxed);
+        monitor_service_requests_expired(monitor_counters_, 1);
+        monitor_service_reply_discarded(monitor_counters_);
+        return {INVALID_PARTICIPANT_HANDLE, SampleIdentity()};
     }
 
-    return ret;
+    return {slot.participant_handle, slot.sample_identity};
 }
 
 void ServiceRegistry::erase(
         SequenceNumber idx) noexcept
 {
-    std::lock_guard<std::recursive_mutex> lock(mutex_);
+    std::lock_guard<std::mutex> lock(mutex_);
 
-    if (registry_.count(idx))
+    const auto slot_idx = find_slot_nts_(idx);
+
+    if (slots_[slot_idx].used)
     {
-        registry_.erase(idx);
+        monitor_service_reply(monitor_counters_, std::chrono::steady_clock::now() - slots_[slot_idx].request_time);
+
+        erase_slot_nts_(slot_idx);
     }
 }
 
+std::size_t ServiceRegistry::reap_expired() noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    return reap_expired_nts_(std::chrono::steady_clock::now());
+}
+
+std::size_t ServiceRegistry::size() const noexcept
+{
+    return size_.load(std::memory_order_relaxed);
+}
+
+std::uint64_t ServiceRegistry::expired_requests() const noexcept
+{
+    return expired_requests_.load(std::memory_order_relaxed);
+}
+
+std::uint64_t ServiceRegistry::evicted_requests() const noexcept
+{
+    return evicted_requests_.load(std::memory_order_relaxed);
+}
+
 RpcTopic ServiceRegistry::topic() const noexcept
 {
     return topic_;
 }
 
-std::recursive_mutex& ServiceRegistry::get_mutex() noexcept
+std::mutex& ServiceRegistry::get_mutex() noexcept
 {
     return mutex_;
 }
 
+std::size_t ServiceRegistry::find_slot_nts_(
+        const SequenceNumber& idx) const noexcept
+{
+    const std::size_t mask = slots_.size() - 1;
+
+    // The table is never full, so the probe always ends
+    for (std::size_t slot = home_slot_nts_(idx);; slot = (slot + 1) & mask)
+    {
+        if (!slots_[slot].used || slots_[slot].sequence_number == idx)
+        {
+            return slot;
+        }
+    }
+}
+
+std::size_t ServiceRegistry::home_slot_nts_(
+        const SequenceNumber& idx) const noexcept
+{
+    const std::uint64_t key = (static_cast<std::uint64_t>(static_cast<std::uint32_t>(idx.high)) << 32) | idx.low;
+
+    // Fibonacci hashing: consecutive sequence numbers spread over the table
+    return static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ull) >> 32) & (slots_.size() - 1);
+}
+
+bool ServiceRegistry::is_expired_nts_(
+        const Slot& slot,
+        const std::chrono::steady_clock::time_point& now) const noexcept
+{
+    return request_timeout_.count() > 0 && now - slot.request_time > request_timeout_;
+}
+
+void ServiceRegistry::erase_slot_nts_(
+        std::size_t slot) noexcept
+{
+    const std::size_t mask = slots_.size() - 1;
+
+    std::size_t next = slot;
+
+    while (true)
+    {
+        next = (next + 1) & mask;
+
+        if (!slots_[next].used)
+        {
+            break;
+        }
+
+        // Move the entry back only if the emptied slot is in its probe sequence (between its home and itself)
+        const std::size_t home = home_slot_nts_(slots_[next].sequence_number);
+        const bool reachable = slot <= next ? (home <= slot || home > next) : (home <= slot && home > next);
+
+        if (reachable)
+        {
+            slots_[slot] = std::move(slots_[next]);
+            slot = next;
+        }
+    }
+
+    slots_[slot] = Slot();
+    const std::size_t size = size_.fetch_sub(1, std::memory_order_relaxed) - 1;
+
+    monitor_service_requests_pending(monitor_counters_, size);
+}
+
+std::size_t ServiceRegistry::reap_expired_nts_(
+        const std::chrono::steady_clock::time_point& now) noexcept
+{
+    if (request_timeout_.count() == 0)
+    {
+        return 0;
+    }
+
+    std::size_t reaped = 0;
+
+    for (std::size_t slot = 0; slot < slots_.size();)
+    {
+        if (slots_[slot].used && is_expired_nts_(slots_[slot], now))
+        {
+            // Another entry may be moved to this slot, so check it again
+            erase_slot_nts_(slot);
+            ++reaped;
+        }
+        else
+        {
+            ++slot;
+        }
+    }
+
+    if (reaped > 0)
+    {
+        expired_requests_.fetch_add(reaped, std::memory_order_relaxed);
+        monitor_service_requests_expired(monitor_counters_, reaped);
+
+        EPROSIMA_LOG_INFO(DDSPIPE_SERVICEREGISTRY,
+                "ServiceRegistry for service " << topic_ << " in participant " << participant_id_ <<
+                " removed " << reaped << " requests not replied in " << request_timeout_.count() << " ms.");
+    }
+
+    return reaped;
+}
+
+void ServiceRegistry::evict_oldest_nts_() noexcept
+{
+    std::size_t oldest = slots_.size();
+
+    for (std::size_t slot = 0; slot < slots_.size(); ++slot)
+    {
+        if (slots_[slot].used && (oldest == slots_.size() || slots_[slot].request_time < slots_[oldest].request_time))
+        {
+            oldest = slot;
+        }
+    }
+
+    if (oldest == slots_.size())
+    {
+        return;
+    }
+
+    EPROSIMA_LOG_WARNING(DDSPIPE_SERVICEREGISTRY,
+            "ServiceRegistry for service " << topic_ << " in participant " << participant_id_ <<
+            " is full: the reply of request " << slots_[oldest].sequence_number << " will be dropped.");
+
+    erase_slot_nts_(oldest);
+    evicted_requests_.fetch_add(1, std::memory_order_relaxed);
+    monitor_service_request_evicted(monitor_counters_);
+}
+
 } /* namespace core */
 } /* namespace ddspipe */
 } /* namespace eprosima */
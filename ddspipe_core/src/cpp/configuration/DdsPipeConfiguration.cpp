@@ -35,6 +35,18 @@ bool DdsPipeConfiguration::is_valid(
         return false;
     }
 
+    if (!topology_cache_file.empty() && topology_cache_period == 0)
+    {
+        error_msg << "The period to store the topology cache must be greater than 0.";
+        return false;
+    }
+
+    if (rpc_max_pending_requests == 0)
+    {
+        error_msg << "The max number of pending requests of a service must be greater than 0.";
+        return false;
+    }
+
     return routes.is_valid(error_msg) && topic_routes.is_valid(error_msg);
 }
 
@@ -83,6 +95,20 @@ std::vector<core::types::ManualTopic> DdsPipeConfiguration::get_manual_topics(
     return matching_manual_topics;
 }
 
+RpcDispatchPolicy DdsPipeConfiguration::get_rpc_dispatch_policy(
+        const types::RpcTopic& service) const noexcept
+{
+    const auto it = service_dispatch_policies.find(service.service_name());
+
+    if (it != service_dispatch_policies.end())
+    {
+        // There is a policy for this service. Use it, and ignore the generic one.
+        return it->second;
+    }
+
+    return rpc_dispatch_policy;
+}
+
 } /* namespace core */
 } /* namespace ddspipe */
 } /* namespace eprosima */
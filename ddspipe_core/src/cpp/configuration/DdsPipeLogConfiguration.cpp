@@ -32,6 +32,24 @@ bool DdsPipeLogConfiguration::is_valid(
         return false;
     }
 
+    if (publish_batch_size == 0)
+    {
+        error_msg << "The number of log entries that wake up the publishing thread must be greater than 0.";
+        return false;
+    }
+
+    if (publish_batch_period == 0)
+    {
+        error_msg << "The period of the publishing thread must be greater than 0.";
+        return false;
+    }
+
+    if (throttle_max_occurrences > 0 && throttle_window == 0)
+    {
+        error_msg << "The window of the throttled log messages must be greater than 0.";
+        return false;
+    }
+
     return BaseLogConfiguration::is_valid(error_msg);
 }
 
@@ -0,0 +1,119 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BridgeBuilder.cpp
+ *
+ */
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_core/core/BridgeBuilder.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+BridgeBuilder::BridgeBuilder(
+        const unsigned int n_threads,
+        const BuildFunction& build)
+    : build_(build)
+    , exit_(false)
+{
+    for (unsigned int i = 0; i < n_threads; ++i)
+    {
+        threads_.emplace_back(&BridgeBuilder::thread_routine_, this);
+    }
+}
+
+BridgeBuilder::~BridgeBuilder()
+{
+    stop();
+}
+
+void BridgeBuilder::push(
+        const utils::Heritable<types::DistributedTopic>& topic) noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (exit_)
+        {
+            return;
+        }
+
+        topics_.push_back(topic);
+    }
+
+    cv_.notify_one();
+}
+
+void BridgeBuilder::stop() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (exit_)
+        {
+            return;
+        }
+
+        exit_ = true;
+
+        if (!topics_.empty())
+        {
+            logDebug(DDSPIPE_BRIDGE_BUILDER, "Discarding " << topics_.size() << " bridges not built yet.");
+            topics_.clear();
+        }
+    }
+
+    cv_.notify_all();
+
+    for (auto& thread : threads_)
+    {
+        thread.join();
+    }
+
+    threads_.clear();
+}
+
+void BridgeBuilder::thread_routine_() noexcept
+{
+    while (true)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(
+            lock,
+            [this]()
+            {
+                return !topics_.empty() || exit_;
+            });
+
+        if (exit_)
+        {
+            break;
+        }
+
+        const auto topic = topics_.front();
+        topics_.pop_front();
+
+        // Build without the mutex, so other threads build at the same time
+        lock.unlock();
+        build_(topic);
+    }
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -12,7 +12,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <chrono>
 #include <set>
+#include <vector>
 
 #include <cpp_utils/exception/ConfigurationException.hpp>
 #include <cpp_utils/exception/InconsistencyException.hpp>
@@ -20,9 +22,11 @@
 #include <cpp_utils/exception/UnsupportedException.hpp>
 #include <cpp_utils/Log.hpp>
 #include <cpp_utils/ReturnCode.hpp>
+#include <cpp_utils/types/cast.hpp>
 #include <cpp_utils/utils.hpp>
 
 #include <ddspipe_core/core/DdsPipe.hpp>
+#include <ddspipe_core/logging/LogThrottle.hpp>
 
 namespace eprosima {
 namespace ddspipe {
@@ -54,6 +58,9 @@ DdsPipe::DdsPipe(
                       << "Configuration for DDS Pipe is invalid: " << error_msg);
     }
 
+    // Limit the log messages repeated at line rate
+    LogThrottle::configure(configuration_.log_configuration);
+
     // Initialize the allowed topics
     init_allowed_topics_();
 
@@ -72,6 +79,20 @@ DdsPipe::DdsPipe(
     // Create Bridges for builtin topics
     init_bridges_nts_(configuration_.builtin_topics);
 
+    // Create the bridges of the topics discovered from now on in their own threads
+    if (configuration_.bridge_builder_threads > 0)
+    {
+        bridge_builder_ = std::make_unique<BridgeBuilder>(
+            configuration_.bridge_builder_threads,
+            std::bind(&DdsPipe::build_bridge_, this, std::placeholders::_1));
+    }
+
+    // Create Bridges for the topics discovered in previous executions
+    if (!configuration_.topology_cache_file.empty())
+    {
+        init_topology_cache_nts_();
+    }
+
     // Enable thread pool
     thread_pool_->enable();
 
@@ -91,16 +112,30 @@ DdsPipe::~DdsPipe()
 {
     logDebug(DDSPIPE, "Destroying DDS Pipe.");
 
+    // Store the topology one last time, while the Discovery Database still knows the topics discovered
+    if (topology_cache_)
+    {
+        topology_cache_event_.reset();
+        save_topology_cache_();
+    }
+
     // Stop Discovery Database
     discovery_database_->stop();
 
     // Stop all communications
     disable();
 
+    // Stop creating bridges. It must be done without the mutex, as the builder takes it when a bridge is created
+    if (bridge_builder_)
+    {
+        bridge_builder_->stop();
+    }
+
     // Disable thread pool
     thread_pool_->disable();
 
     // Destroy Bridges, so Writers and Readers are destroyed before the Databases
+    pending_bridges_.clear();
     bridges_.clear();
 
     // Destroy RpcBridges, so Writers and Readers are destroyed before the Databases
@@ -302,27 +337,33 @@ void DdsPipe::discovered_endpoint_nts_(
         // Another endpoint from an already tracked topic/participant was discovered
         // Refresh bridge partition metadata and reader partition QoS
 
-        const auto bridge_it = bridges_.find(utils::Heritable<DdsTopic>::make_heritable(endpoint.topic));
-        // Add the specific partition of the endpoint in the bridge topic
-        if (bridge_it != bridges_.end())
-        {
-            std::ostringstream guid_ss;
-            guid_ss << endpoint.guid;
+        std::ostringstream guid_ss;
+        guid_ss << endpoint.guid;
+
+        const auto part_it = endpoint.specific_partitions.find(guid_ss.str());
+        const bool has_partition = part_it != endpoint.specific_partitions.end();
+        const std::string partition = has_partition ? part_it->second : std::string();
 
-            const auto part_it = endpoint.specific_partitions.find(guid_ss.str());
-            if (part_it != endpoint.specific_partitions.end())
+        // Refresh this bridge so writers receive the updated guid->partition map
+        // Also refresh reader partitions using
+        // filter (if set), otherwise
+        // the current reader partition configuration
+        const std::set<std::string> partitions_to_apply =
+                filter_partition_.empty() ? reader_partitions_ : filter_partition_;
+
+        apply_to_bridge_nts_(
+            utils::Heritable<DdsTopic>::make_heritable(endpoint.topic),
+            [guid = guid_ss.str(), has_partition, partition, partitions_to_apply](
+                DdsBridge& bridge)
             {
-                bridge_it->second->add_partition_to_topic(guid_ss.str(), part_it->second);
-            }
+                // Add the specific partition of the endpoint in the bridge topic
+                if (has_partition)
+                {
+                    bridge.add_partition_to_topic(guid, partition);
+                }
 
-            // Refresh this bridge so writers receive the updated guid->partition map
-            // Also refresh reader partitions using
-            // filter (if set), otherwise
-            // the current reader partition configuration
-            const auto& partitions_to_apply =
-                    filter_partition_.empty() ? reader_partitions_ : filter_partition_;
-            bridge_it->second->update_partitions(partitions_to_apply);
-        }
+                bridge.update_partitions(partitions_to_apply);
+            });
     }
 }
 
@@ -346,11 +387,17 @@ void DdsPipe::removed_endpoint_nts_(
         const auto& topic = utils::Heritable<DdsTopic>::make_heritable(endpoint.topic);
 
         // Remove the subscriber from the topic.
-        auto it_bridge = bridges_.find(topic);
-
-        if (it_bridge != bridges_.end() && endpoint.discoverer_participant_id != DEFAULT_PARTICIPANT_ID)
+        if (endpoint.discoverer_participant_id != DEFAULT_PARTICIPANT_ID)
         {
-            it_bridge->second->remove_writer(endpoint.discoverer_participant_id);
+            const auto participant_id = endpoint.discoverer_participant_id;
+
+            apply_to_bridge_nts_(
+                topic,
+                [participant_id](
+                    DdsBridge& bridge)
+                {
+                    bridge.remove_writer(participant_id);
+                });
         }
     }
 }
@@ -407,27 +454,30 @@ bool DdsPipe::is_endpoint_relevant_(
         return false;
     }
 
-    auto is_endpoint_relevant = [&](const Endpoint& entity)
-            {
-                return entity.active &&
-                       is_endpoint_kind_relevant_(entity) &&
-                       entity.topic == endpoint.topic &&
-                       entity.discoverer_participant_id == endpoint.discoverer_participant_id;
-            };
+    // Count the active endpoints of relevant kinds in the topic with the same discoverer participant id
+    std::size_t relevant_endpoints = discovery_database_->active_endpoints_count(
+        endpoint.topic, endpoint.discoverer_participant_id, endpoint.kind);
 
-    const auto& relevant_endpoints = discovery_database_->get_endpoints(is_endpoint_relevant);
+    if (configuration_.discovery_trigger == DiscoveryTrigger::ANY)
+    {
+        // Endpoints of the other kind are relevant as well
+        const auto other_kind = endpoint.is_reader() ? EndpointKind::writer : EndpointKind::reader;
+
+        relevant_endpoints += discovery_database_->active_endpoints_count(
+            endpoint.topic, endpoint.discoverer_participant_id, other_kind);
+    }
 
     if (endpoint.active)
     {
         // An active reader is relevant when it is the only active reader in a topic
         // with a discoverer participant id.
-        return relevant_endpoints.size() == 1 && relevant_endpoints.count(endpoint.guid);
+        return relevant_endpoints == 1 && discovery_database_->is_endpoint_active(endpoint);
     }
     else
     {
         // An inactive reader is relevant when there aren't any active readers in a topic
         // with a discoverer participant id.
-        return relevant_endpoints.size() == 0;
+        return relevant_endpoints == 0;
     }
 }
 
@@ -441,15 +491,126 @@ void DdsPipe::init_bridges_nts_(
     }
 }
 
+void DdsPipe::init_topology_cache_nts_()
+{
+    topology_cache_ = std::make_unique<TopologyCache>(configuration_.topology_cache_file);
+
+    const auto now = std::chrono::system_clock::now();
+    const auto expiration = std::chrono::seconds(configuration_.topology_cache_expiration);
+
+    for (const auto& entry : topology_cache_->load())
+    {
+        if (configuration_.remove_unused_entities && expiration.count() > 0 && now - entry.second > expiration)
+        {
+            logDebug(DDSPIPE, "Discarding expired topic " << entry.first << " from the topology cache.");
+            continue;
+        }
+
+        DdsTopic cached_topic = entry.first;
+
+        // The cache may have been written with a different configuration of participants
+        if (cached_topic.m_topic_discoverer != DEFAULT_PARTICIPANT_ID &&
+                !participants_database_->get_participant(cached_topic.m_topic_discoverer))
+        {
+            EPROSIMA_LOG_WARNING(DDSPIPE,
+                    "Cached topic " << cached_topic << " was discovered by unknown participant " <<
+                    cached_topic.m_topic_discoverer << ". Ignoring its discoverer.");
+
+            cached_topic.m_topic_discoverer = DEFAULT_PARTICIPANT_ID;
+        }
+
+        cached_topology_[cached_topic] = entry.second;
+
+        const auto topic = utils::Heritable<DdsTopic>::make_heritable(cached_topic);
+
+        // Builtin topics have their bridge already, and blocked topics do not need one
+        if (current_topics_.find(topic) != current_topics_.end() || !allowed_topics_->is_topic_allowed(*topic))
+        {
+            continue;
+        }
+
+        EPROSIMA_LOG_INFO(DDSPIPE, "Creating Bridge for cached topic: " << topic << ".");
+
+        discovered_topic_nts_(topic);
+        create_new_bridge_nts_(topic, false);
+    }
+
+    topology_cache_event_ = std::make_unique<utils::event::PeriodicEventHandler>(
+        std::bind(&DdsPipe::save_topology_cache_, this),
+        utils::Duration_ms(configuration_.topology_cache_period));
+}
+
+void DdsPipe::save_topology_cache_() noexcept
+{
+    TopologyCache::Topology topology;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        const auto now = std::chrono::system_clock::now();
+        const auto expiration = std::chrono::seconds(configuration_.topology_cache_expiration);
+
+        std::vector<utils::Heritable<DistributedTopic>> expired_topics;
+
+        for (const auto& topic_it : current_topics_)
+        {
+            // Builtin topics are always created from the configuration
+            if (!utils::can_cast<DdsTopic>(*topic_it.first) ||
+                    configuration_.builtin_topics.find(topic_it.first) != configuration_.builtin_topics.end())
+            {
+                continue;
+            }
+
+            const DdsTopic& topic = dynamic_cast<const DdsTopic&>(*topic_it.first);
+
+            if (discovery_database_->topic_exists(topic))
+            {
+                topology[topic] = now;
+                continue;
+            }
+
+            const auto cached_it = cached_topology_.find(topic);
+
+            if (cached_it == cached_topology_.end())
+            {
+                // Discovered in this execution and removed since the last time the topology was stored
+                topology[topic] = now;
+            }
+            else if (configuration_.remove_unused_entities && expiration.count() > 0 &&
+                    now - cached_it->second > expiration &&
+                    pending_bridges_.find(topic_it.first) == pending_bridges_.end())
+            {
+                expired_topics.push_back(topic_it.first);
+            }
+            else
+            {
+                topology[topic] = cached_it->second;
+            }
+        }
+
+        for (const auto& topic : expired_topics)
+        {
+            // Remove the topic as well, so a new discovery creates its bridge again from scratch
+            EPROSIMA_LOG_INFO(DDSPIPE, "Removing expired cached topic: " << topic << ".");
+
+            bridges_.erase(topic);
+            current_topics_.erase(topic);
+        }
+
+        cached_topology_ = topology;
+    }
+
+    // Write the file without the mutex, so the discovery is not blocked meanwhile
+    topology_cache_->save(topology);
+}
+
 void DdsPipe::discovered_topic_nts_(
         const utils::Heritable<DistributedTopic>& topic) noexcept
 {
     EPROSIMA_LOG_INFO(DDSPIPE, "Discovered topic: " << topic << " by: " << topic->topic_discoverer() << ".");
 
-    // Check if the bridge (and the topic) already exist.
-    auto it_bridge = bridges_.find(topic);
-
-    if (it_bridge == bridges_.end())
+    // Check if the bridge (and the topic) already exist, or the bridge is being created.
+    if (bridges_.find(topic) == bridges_.end() && pending_bridges_.find(topic) == pending_bridges_.end())
     {
         // Add topic to current_topics as not activated
         current_topics_.emplace(topic, false);
@@ -463,7 +624,15 @@ void DdsPipe::discovered_topic_nts_(
     else if (configuration_.remove_unused_entities && topic->topic_discoverer() != DEFAULT_PARTICIPANT_ID)
     {
         // The bridge already exists. Create a writer in the participant who discovered it.
-        it_bridge->second->create_writer(topic->topic_discoverer());
+        const auto participant_id = topic->topic_discoverer();
+
+        apply_to_bridge_nts_(
+            topic,
+            [participant_id](
+                DdsBridge& bridge)
+            {
+                bridge.create_writer(participant_id);
+            });
     }
 }
 
@@ -516,6 +685,45 @@ void DdsPipe::removed_service_nts_(
 void DdsPipe::create_new_bridge_nts_(
         const utils::Heritable<DistributedTopic>& topic,
         bool enabled /*= false*/) noexcept
+{
+    if (bridge_builder_)
+    {
+        EPROSIMA_LOG_INFO(DDSPIPE, "Requesting Bridge for topic: " << topic << ".");
+
+        PendingBridge& pending_bridge = pending_bridges_[topic];
+        pending_bridge.discovery_time = std::chrono::steady_clock::now();
+
+        if (enabled)
+        {
+            pending_bridge.operations.push_back(
+                [](
+                    DdsBridge& bridge)
+                {
+                    bridge.enable();
+                });
+        }
+
+        bridge_builder_->push(topic);
+        return;
+    }
+
+    auto new_bridge = new_bridge_(topic);
+
+    if (!new_bridge)
+    {
+        return;
+    }
+
+    if (enabled)
+    {
+        new_bridge->enable();
+    }
+
+    bridges_[topic] = std::move(new_bridge);
+}
+
+std::unique_ptr<DdsBridge> DdsPipe::new_bridge_(
+        const utils::Heritable<DistributedTopic>& topic) noexcept
 {
     EPROSIMA_LOG_INFO(DDSPIPE, "Creating Bridge for topic: " << topic << ".");
 
@@ -525,27 +733,88 @@ void DdsPipe::create_new_bridge_nts_(
         auto manual_topics = configuration_.get_manual_topics(dynamic_cast<const core::ITopic&>(*topic));
 
         // Create bridge instance
-        auto new_bridge = std::make_unique<DdsBridge>(topic,
-                        participants_database_,
-                        payload_pool_,
-                        thread_pool_,
-                        routes_config,
-                        configuration_.remove_unused_entities,
-                        manual_topics);
+        return std::make_unique<DdsBridge>(topic,
+                       participants_database_,
+                       payload_pool_,
+                       thread_pool_,
+                       routes_config,
+                       configuration_.remove_unused_entities,
+                       manual_topics);
+    }
+    catch (const utils::InitializationException& e)
+    {
+        EPROSIMA_LOG_ERROR(DDSPIPE,
+                "Error creating Bridge for topic " << topic
+                                                   << ". Error code:" << e.what() << ".");
+    }
 
-        if (enabled)
+    return nullptr;
+}
+
+void DdsPipe::build_bridge_(
+        const utils::Heritable<DistributedTopic>& topic) noexcept
+{
+    auto new_bridge = new_bridge_(topic);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it_pending = pending_bridges_.find(topic);
+
+    if (it_pending == pending_bridges_.end())
+    {
+        // The creation has been discarded
+        return;
+    }
+
+    if (new_bridge)
+    {
+        new_bridge->set_discovery_time(it_pending->second.discovery_time);
+
+        try
+        {
+            for (const auto& operation : it_pending->second.operations)
+            {
+                operation(*new_bridge);
+            }
+        }
+        catch (const utils::InitializationException& e)
         {
-            new_bridge->enable();
+            EPROSIMA_LOG_ERROR(DDSPIPE,
+                    "Error updating Bridge for topic " << topic
+                                                       << ". Error code:" << e.what() << ".");
         }
 
+        logDebug(DDSPIPE, "Bridge for topic " << topic << " created after "
+                                              << new_bridge->metrics().creation_latency.count() << " us.");
+
         bridges_[topic] = std::move(new_bridge);
     }
-    catch (const utils::InitializationException& e)
+
+    pending_bridges_.erase(it_pending);
+}
+
+bool DdsPipe::apply_to_bridge_nts_(
+        const utils::Heritable<DistributedTopic>& topic,
+        const std::function<void(DdsBridge&)>& operation)
+{
+    auto it_bridge = bridges_.find(topic);
+
+    if (it_bridge != bridges_.end())
     {
-        EPROSIMA_LOG_ERROR(DDSPIPE,
-                "Error creating Bridge for topic " << topic
-                                                   << ". Error code:" << e.what() << ".");
+        operation(*it_bridge->second);
+        return true;
+    }
+
+    auto it_pending = pending_bridges_.find(topic);
+
+    if (it_pending != pending_bridges_.end())
+    {
+        // Apply it once the bridge is created, after the operations requested before
+        it_pending->second.operations.push_back(operation);
+        return true;
     }
+
+    return false;
 }
 
 void DdsPipe::create_new_service_nts_(
@@ -554,7 +823,14 @@ void DdsPipe::create_new_service_nts_(
     EPROSIMA_LOG_INFO(DDSPIPE, "Creating Service: " << topic << ".");
 
     // Endpoints not created until enabled for the first time, so no exception can be thrown
-    rpc_bridges_[topic] = std::make_unique<RpcBridge>(topic, participants_database_, payload_pool_, thread_pool_);
+    rpc_bridges_[topic] = std::make_unique<RpcBridge>(
+        topic,
+        participants_database_,
+        payload_pool_,
+        thread_pool_,
+        configuration_.rpc_max_pending_requests,
+        std::chrono::milliseconds(configuration_.rpc_request_timeout),
+        configuration_.get_rpc_dispatch_policy(topic));
 }
 
 void DdsPipe::activate_topic_nts_(
@@ -566,18 +842,19 @@ void DdsPipe::activate_topic_nts_(
     current_topics_[topic] = true;
 
     // Enable bridge. In case it is already enabled nothing should happen
-    auto it_bridge = bridges_.find(topic);
+    const bool bridge_exists = apply_to_bridge_nts_(
+        topic,
+        [](
+            DdsBridge& bridge)
+        {
+            bridge.enable();
+        });
 
-    if (it_bridge == bridges_.end())
+    if (!bridge_exists)
     {
         // The Bridge did not exist
         create_new_bridge_nts_(topic, true);
     }
-    else
-    {
-        // The Bridge already exists
-        it_bridge->second->enable();
-    }
 }
 
 void DdsPipe::deactivate_topic_nts_(
@@ -589,14 +866,14 @@ void DdsPipe::deactivate_topic_nts_(
     current_topics_[topic] = false;
 
     // Disable bridge. In case it is already disabled nothing should happen
-    auto it_bridge = bridges_.find(topic);
-
-    if (it_bridge != bridges_.end())
-    {
-        // The Bridge already exists
-        it_bridge->second->disable();
-    }
     // If the Bridge does not exist, there is no need to create it
+    apply_to_bridge_nts_(
+        topic,
+        [](
+            DdsBridge& bridge)
+        {
+            bridge.disable();
+        });
 }
 
 void DdsPipe::activate_all_topics_nts_() noexcept
@@ -640,6 +917,16 @@ void DdsPipe::update_partitions_nts_(
     {
         pair.second->update_partitions(partitions_set);
     }
+
+    for (auto& pair : pending_bridges_)
+    {
+        pair.second.operations.push_back(
+            [partitions_set](
+                DdsBridge& bridge)
+            {
+                bridge.update_partitions(partitions_set);
+            });
+    }
 }
 
 void DdsPipe::update_content_filter(
@@ -655,6 +942,33 @@ void DdsPipe::update_content_filter(
             pair.second->update_topic_filter(expression);
         }
     }
+
+    for (auto& pair : pending_bridges_)
+    {
+        if (pair.first->m_topic_name == topic_name)
+        {
+            pair.second.operations.push_back(
+                [expression](
+                    DdsBridge& bridge)
+                {
+                    bridge.update_topic_filter(expression);
+                });
+        }
+    }
+}
+
+std::map<utils::Heritable<DistributedTopic>, DdsBridgeMetrics> DdsPipe::bridges_metrics()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::map<utils::Heritable<DistributedTopic>, DdsBridgeMetrics> metrics;
+
+    for (const auto& pair : bridges_)
+    {
+        metrics[pair.first] = pair.second->metrics();
+    }
+
+    return metrics;
 }
 
 void DdsPipe::update_filter(
@@ -19,14 +19,18 @@
 
 #include <cpp_utils/exception/UnsupportedException.hpp>
 #include <cpp_utils/Log.hpp>
+#include <cpp_utils/types/cast.hpp>
 #include <cpp_utils/utils.hpp>
 
 #include <dynamic/AllowedTopicList.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
 
 namespace eprosima {
 namespace ddspipe {
 namespace core {
 
+constexpr const std::size_t AllowedTopicList::MAX_DECISIONS;
+
 AllowedTopicList::AllowedTopicList()
 {
 }
@@ -39,6 +43,8 @@ AllowedTopicList::AllowedTopicList(
     allowlist_ = AllowedTopicList::get_topic_list_without_repetition_(allowlist);
     blocklist_ = AllowedTopicList::get_topic_list_without_repetition_(blocklist);
 
+    compile_nts_();
+
     logDebug(DDSPIPE_ALLOWEDTOPICLIST, "New Allowed topic list created:");
     logDebug(DDSPIPE_ALLOWEDTOPICLIST, "New Allowed topic list created: " << *this << ".");
 }
@@ -46,9 +52,13 @@ AllowedTopicList::AllowedTopicList(
 AllowedTopicList& AllowedTopicList::operator =(
         const AllowedTopicList& other)
 {
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+
     this->allowlist_ = other.allowlist_;
     this->blocklist_ = other.blocklist_;
 
+    compile_nts_();
+
     return *this;
 }
 
@@ -64,6 +74,8 @@ void AllowedTopicList::clear() noexcept
 
     blocklist_.clear();
     allowlist_.clear();
+
+    compile_nts_();
 }
 
 bool AllowedTopicList::is_topic_allowed(
@@ -71,36 +83,33 @@ bool AllowedTopicList::is_topic_allowed(
 {
     std::lock_guard<std::recursive_mutex> lock(mutex_);
 
-    // It is accepted by default if allowlist is empty, if not it should pass the allowlist filter
-    bool accepted = allowlist_.empty();
-
-    // Check if allowlist filter it (this will do anything if empty and accepted will be true)
-    for (const auto& filter : allowlist_)
+    // The decision can only be memoized if it depends on nothing but the names of the topic
+    if (!utils::can_cast<types::DdsTopic>(topic) ||
+            !allowlist_index_.only_names_matched() ||
+            !blocklist_index_.only_names_matched())
     {
-        if (filter->matches(topic))
-        {
-            accepted = true;
-            break;
-        }
+        return is_topic_allowed_nts_(topic);
     }
 
-    // Check if it has not passed the allowlist so blocklist is skipped
-    if (!accepted)
+    const auto& dds_topic = static_cast<const types::DdsTopic&>(topic);
+    auto key = std::make_pair(dds_topic.m_topic_name, dds_topic.type_name);
+
+    auto it = decisions_.find(key);
+    if (it != decisions_.end())
     {
-        return false;
+        return it->second;
     }
 
-    // Allowlist passed, check blocklist
-    for (const auto& filter : blocklist_)
+    bool allowed = is_topic_allowed_nts_(topic);
+
+    if (decisions_.size() >= MAX_DECISIONS)
     {
-        if (filter->matches(topic))
-        {
-            return false;
-        }
+        decisions_.clear();
     }
 
-    // Blocklist passed, the topic is allowed
-    return true;
+    decisions_.emplace(std::move(key), allowed);
+
+    return allowed;
 }
 
 bool AllowedTopicList::is_service_allowed(
@@ -118,6 +127,27 @@ bool AllowedTopicList::operator ==(
     return allowlist_ == other.allowlist_ && blocklist_ == other.blocklist_;
 }
 
+void AllowedTopicList::compile_nts_() noexcept
+{
+    allowlist_index_ = types::FilterTopicIndex(allowlist_);
+    blocklist_index_ = types::FilterTopicIndex(blocklist_);
+
+    decisions_.clear();
+}
+
+bool AllowedTopicList::is_topic_allowed_nts_(
+        const ITopic& topic) const noexcept
+{
+    // It is accepted by default if allowlist is empty, if not it should pass the allowlist filter
+    if (!allowlist_index_.empty() && !allowlist_index_.matches(topic))
+    {
+        return false;
+    }
+
+    // Allowlist passed, the topic is allowed if it does not pass the blocklist filter
+    return !blocklist_index_.matches(topic);
+}
+
 std::set<utils::Heritable<types::IFilterTopic>> AllowedTopicList::get_topic_list_without_repetition_(
         const std::set<utils::Heritable<types::IFilterTopic>>& list) noexcept
 {
@@ -29,7 +29,8 @@ namespace core {
 using namespace eprosima::ddspipe::core::types;
 
 DiscoveryDatabase::DiscoveryDatabase() noexcept
-    : exit_(false)
+    : next_callback_id_(0)
+    , exit_(false)
     , enabled_(false)
 {
     logDebug(DDSPIPE_DISCOVERY_DATABASE, "Creating queue processing thread.");
@@ -81,6 +82,8 @@ void DiscoveryDatabase::stop() noexcept
         std::unique_lock<std::shared_timed_mutex> lock(mutex_);
         entities_.clear();
         entities_filter_.clear();
+        topics_index_.clear();
+        active_endpoints_index_.clear();
     }
 }
 
@@ -88,17 +91,7 @@ bool DiscoveryDatabase::topic_exists(
         const DdsTopic& topic) const noexcept
 {
     std::shared_lock<std::shared_timed_mutex> lock(mutex_);
-
-    // Loop over every Endpoint checking if topic matches
-    // It is not required to be reference
-    for (const auto& entity : entities_)
-    {
-        if (entity.second.topic == topic)
-        {
-            return true;
-        }
-    }
-    return false;
+    return topics_index_.find(topic.topic_unique_name()) != topics_index_.end();
 }
 
 bool DiscoveryDatabase::endpoint_exists(
@@ -128,7 +121,9 @@ bool DiscoveryDatabase::add_endpoint_(
             else
             {
                 // If exists but inactive, modify entry
+                unindex_endpoint_nts_(it->second);
                 it->second = new_endpoint;
+                index_endpoint_nts_(it->second);
 
                 EPROSIMA_LOG_INFO(DDSPIPE_DISCOVERY_DATABASE,
                         "Modifying an already discovered (inactive) Endpoint " << new_endpoint << ".");
@@ -143,13 +138,14 @@ bool DiscoveryDatabase::add_endpoint_(
 
             // Add it to the dictionary
             entities_.insert(std::pair<Guid, Endpoint>(new_endpoint.guid, new_endpoint));
+            index_endpoint_nts_(new_endpoint);
         }
     }
 
     std::lock_guard<std::mutex> lock(callbacks_mutex_);
-    for (auto added_endpoint_callback : added_endpoint_callbacks_)
+    for (const auto& added_endpoint_callback : added_endpoint_callbacks_)
     {
-        added_endpoint_callback(new_endpoint);
+        added_endpoint_callback.second(new_endpoint);
     }
 
     return true;
@@ -202,15 +198,17 @@ bool DiscoveryDatabase::update_endpoint_(
                     "Modifying an already discovered Endpoint " << endpoint_to_update << ".");
 
             // Modify entry
+            // It is assumed a topic cannot change, but the endpoint is reindexed in case it does
+            unindex_endpoint_nts_(it->second);
             it->second = endpoint_to_update;
-            // It is assumed a topic cannot change, otherwise further actions may be taken
+            index_endpoint_nts_(it->second);
         }
     }
 
     std::lock_guard<std::mutex> lock(callbacks_mutex_);
-    for (auto updated_endpoint_callback : updated_endpoint_callbacks_)
+    for (const auto& updated_endpoint_callback : updated_endpoint_callbacks_)
     {
-        updated_endpoint_callback(endpoint_to_update);
+        updated_endpoint_callback.second(endpoint_to_update);
     }
 
     return true;
@@ -226,10 +224,9 @@ utils::ReturnCode DiscoveryDatabase::erase_endpoint_(
 
         EPROSIMA_LOG_INFO(DDSPIPE_DISCOVERY_DATABASE, "Erasing Endpoint " << endpoint_to_erase << ".");
 
-        auto erased = entities_.erase(endpoint_to_erase.guid);
-        endpoint_erased = erased > 0;
+        auto it = entities_.find(endpoint_to_erase.guid);
 
-        if (erased == 0)
+        if (it == entities_.end())
         {
             throw utils::InconsistencyException(
                       utils::Formatter()
@@ -237,15 +234,19 @@ utils::ReturnCode DiscoveryDatabase::erase_endpoint_(
                           << " from database. Endpoint entry not found.");
         }
 
+        unindex_endpoint_nts_(it->second);
+        entities_.erase(it);
+        endpoint_erased = true;
+
         entities_filter_.erase(endpoint_to_erase.guid);
     }
 
     if (endpoint_erased)
     {
         std::lock_guard<std::mutex> lock(callbacks_mutex_);
-        for (auto erased_endpoint_callback : erased_endpoint_callbacks_)
+        for (const auto& erased_endpoint_callback : erased_endpoint_callbacks_)
         {
-            erased_endpoint_callback(endpoint_to_erase);
+            erased_endpoint_callback.second(endpoint_to_erase);
         }
     }
 
@@ -328,28 +329,80 @@ std::map<Guid, Endpoint> DiscoveryDatabase::get_endpoints(
     return endpoints;
 }
 
-void DiscoveryDatabase::add_endpoint_discovered_callback(
+std::size_t DiscoveryDatabase::active_endpoints_count(
+        const DdsTopic& topic,
+        const ParticipantId& discoverer_participant_id,
+        const EndpointKind kind) const noexcept
+{
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+
+    auto it = active_endpoints_index_.find(
+        ActiveEndpointsKey(topic.topic_unique_name(), discoverer_participant_id, kind));
+
+    if (it == active_endpoints_index_.end())
+    {
+        return 0;
+    }
+
+    return it->second.size();
+}
+
+bool DiscoveryDatabase::is_endpoint_active(
+        const Endpoint& endpoint) const noexcept
+{
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+
+    auto it = active_endpoints_index_.find(active_endpoints_key_(endpoint));
+
+    if (it == active_endpoints_index_.end())
+    {
+        return false;
+    }
+
+    return it->second.find(endpoint.guid) != it->second.end();
+}
+
+DiscoveryDatabase::CallbackId DiscoveryDatabase::add_endpoint_discovered_callback(
         std::function<void(Endpoint)> endpoint_discovered_callback) noexcept
 {
     std::lock_guard<std::mutex> lock(callbacks_mutex_);
 
-    added_endpoint_callbacks_.push_back(endpoint_discovered_callback);
+    const CallbackId callback_id = next_callback_id_++;
+    added_endpoint_callbacks_[callback_id] = endpoint_discovered_callback;
+
+    return callback_id;
 }
 
-void DiscoveryDatabase::add_endpoint_updated_callback(
+DiscoveryDatabase::CallbackId DiscoveryDatabase::add_endpoint_updated_callback(
         std::function<void(Endpoint)> endpoint_updated_callback) noexcept
 {
     std::lock_guard<std::mutex> lock(callbacks_mutex_);
 
-    updated_endpoint_callbacks_.push_back(endpoint_updated_callback);
+    const CallbackId callback_id = next_callback_id_++;
+    updated_endpoint_callbacks_[callback_id] = endpoint_updated_callback;
+
+    return callback_id;
 }
 
-void DiscoveryDatabase::add_endpoint_erased_callback(
+DiscoveryDatabase::CallbackId DiscoveryDatabase::add_endpoint_erased_callback(
         std::function<void(Endpoint)> endpoint_erased_callback) noexcept
 {
     std::lock_guard<std::mutex> lock(callbacks_mutex_);
 
-    erased_endpoint_callbacks_.push_back(endpoint_erased_callback);
+    const CallbackId callback_id = next_callback_id_++;
+    erased_endpoint_callbacks_[callback_id] = endpoint_erased_callback;
+
+    return callback_id;
+}
+
+void DiscoveryDatabase::remove_callback(
+        CallbackId callback_id) noexcept
+{
+    std::lock_guard<std::mutex> lock(callbacks_mutex_);
+
+    added_endpoint_callbacks_.erase(callback_id);
+    updated_endpoint_callbacks_.erase(callback_id);
+    erased_endpoint_callbacks_.erase(callback_id);
 }
 
 void DiscoveryDatabase::clear_all_callbacks() noexcept
@@ -394,6 +447,49 @@ void DiscoveryDatabase::push_item_to_queue_(
     entities_to_process_cv_.notify_one();
 }
 
+DiscoveryDatabase::ActiveEndpointsKey DiscoveryDatabase::active_endpoints_key_(
+        const Endpoint& endpoint) noexcept
+{
+    return ActiveEndpointsKey(endpoint.topic.topic_unique_name(), endpoint.discoverer_participant_id, endpoint.kind);
+}
+
+void DiscoveryDatabase::index_endpoint_nts_(
+        const Endpoint& endpoint) noexcept
+{
+    topics_index_[endpoint.topic.topic_unique_name()]++;
+
+    if (endpoint.active)
+    {
+        active_endpoints_index_[active_endpoints_key_(endpoint)].insert(endpoint.guid);
+    }
+}
+
+void DiscoveryDatabase::unindex_endpoint_nts_(
+        const Endpoint& endpoint) noexcept
+{
+    auto topic_it = topics_index_.find(endpoint.topic.topic_unique_name());
+
+    if (topic_it != topics_index_.end() && --topic_it->second == 0)
+    {
+        topics_index_.erase(topic_it);
+    }
+
+    if (endpoint.active)
+    {
+        auto active_it = active_endpoints_index_.find(active_endpoints_key_(endpoint));
+
+        if (active_it != active_endpoints_index_.end())
+        {
+            active_it->second.erase(endpoint.guid);
+
+            if (active_it->second.empty())
+            {
+                active_endpoints_index_.erase(active_it);
+            }
+        }
+    }
+}
+
 void DiscoveryDatabase::process_queue_() noexcept
 {
     entities_to_process_.swap();
@@ -0,0 +1,213 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TopologyCache.cpp
+ *
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_core/dynamic/TopologyCache.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+using namespace eprosima::ddspipe::core::types;
+
+const std::string TopologyCache::FILE_HEADER = "ddspipe-topology-cache 1";
+
+namespace {
+
+//! Separator of the fields of a topic. Topic and type names cannot contain it.
+constexpr const char FIELD_SEPARATOR = '\t';
+
+//! Value of a QoS that is not set
+const std::string UNSET_VALUE = "-";
+
+//! Number of fields of each topic
+constexpr const std::size_t N_FIELDS = 10;
+
+template <typename T>
+std::string qos_to_string(
+        const utils::Fuzzy<T>& qos)
+{
+    if (!qos.is_set())
+    {
+        return UNSET_VALUE;
+    }
+
+    return std::to_string(static_cast<unsigned long>(qos.get_value()));
+}
+
+template <typename T>
+void qos_from_string(
+        const std::string& value,
+        utils::Fuzzy<T>& qos)
+{
+    if (value != UNSET_VALUE)
+    {
+        qos.set_value(static_cast<T>(std::stoul(value)));
+    }
+}
+
+std::vector<std::string> split_fields(
+        const std::string& line)
+{
+    std::vector<std::string> fields;
+    std::stringstream ss(line);
+    std::string field;
+
+    while (std::getline(ss, field, FIELD_SEPARATOR))
+    {
+        fields.push_back(field);
+    }
+
+    return fields;
+}
+
+} /* namespace */
+
+TopologyCache::TopologyCache(
+        const std::string& file_name)
+    : file_name_(file_name)
+{
+}
+
+TopologyCache::Topology TopologyCache::load() const noexcept
+{
+    Topology topology;
+
+    std::ifstream file(file_name_);
+
+    if (!file.is_open())
+    {
+        EPROSIMA_LOG_INFO(DDSPIPE_TOPOLOGY_CACHE, "No topology cache found in " << file_name_ << ".");
+        return topology;
+    }
+
+    std::string line;
+
+    if (!std::getline(file, line) || line != FILE_HEADER)
+    {
+        EPROSIMA_LOG_WARNING(DDSPIPE_TOPOLOGY_CACHE,
+                "Ignoring topology cache " << file_name_ << " with an unknown format.");
+        return topology;
+    }
+
+    while (std::getline(file, line))
+    {
+        const auto fields = split_fields(line);
+
+        if (fields.size() != N_FIELDS)
+        {
+            EPROSIMA_LOG_WARNING(DDSPIPE_TOPOLOGY_CACHE,
+                    "Skipping malformed entry in topology cache " << file_name_ << ": " << line << ".");
+            continue;
+        }
+
+        try
+        {
+            DdsTopic topic;
+            topic.m_topic_name = fields[0];
+            topic.type_name = fields[1];
+            topic.m_topic_discoverer = fields[2];
+
+            qos_from_string(fields[3], topic.topic_qos.durability_qos);
+            qos_from_string(fields[4], topic.topic_qos.reliability_qos);
+            qos_from_string(fields[5], topic.topic_qos.ownership_qos);
+            qos_from_string(fields[6], topic.topic_qos.use_partitions);
+            qos_from_string(fields[7], topic.topic_qos.keyed);
+            qos_from_string(fields[8], topic.topic_qos.history_depth);
+
+            const auto last_discovered = std::chrono::system_clock::time_point(std::chrono::seconds(std::stoll(
+                                fields[9])));
+
+            topology[topic] = last_discovered;
+        }
+        catch (const std::exception& e)
+        {
+            EPROSIMA_LOG_WARNING(DDSPIPE_TOPOLOGY_CACHE,
+                    "Skipping malformed entry in topology cache " << file_name_ << ": " << e.what() << ".");
+        }
+    }
+
+    logDebug(DDSPIPE_TOPOLOGY_CACHE, "Loaded " << topology.size() << " topics from " << file_name_ << ".");
+
+    return topology;
+}
+
+bool TopologyCache::save(
+        const Topology& topology) const noexcept
+{
+    const std::string tmp_file_name = file_name_ + ".tmp";
+
+    {
+        std::ofstream file(tmp_file_name, std::ios::trunc);
+
+        if (!file.is_open())
+        {
+            EPROSIMA_LOG_WARNING(DDSPIPE_TOPOLOGY_CACHE, "Error opening topology cache " << tmp_file_name << ".");
+            return false;
+        }
+
+        file << FILE_HEADER << "\n";
+
+        for (const auto& entry : topology)
+        {
+            const DdsTopic& topic = entry.first;
+
+            file << topic.m_topic_name << FIELD_SEPARATOR
+                 << topic.type_name << FIELD_SEPARATOR
+                 << topic.m_topic_discoverer << FIELD_SEPARATOR
+                 << qos_to_string(topic.topic_qos.durability_qos) << FIELD_SEPARATOR
+                 << qos_to_string(topic.topic_qos.reliability_qos) << FIELD_SEPARATOR
+                 << qos_to_string(topic.topic_qos.ownership_qos) << FIELD_SEPARATOR
+                 << qos_to_string(topic.topic_qos.use_partitions) << FIELD_SEPARATOR
+                 << qos_to_string(topic.topic_qos.keyed) << FIELD_SEPARATOR
+                 << qos_to_string(topic.topic_qos.history_depth) << FIELD_SEPARATOR
+                 << std::chrono::duration_cast<std::chrono::seconds>(entry.second.time_since_epoch()).count()
+                 << "\n";
+        }
+
+        if (!file.good())
+        {
+            EPROSIMA_LOG_WARNING(DDSPIPE_TOPOLOGY_CACHE, "Error writing topology cache " << tmp_file_name << ".");
+            return false;
+        }
+    }
+
+    // Replace the previous file at once. On Windows, rename does not replace an existing file.
+    if (std::rename(tmp_file_name.c_str(), file_name_.c_str()) != 0 &&
+            (std::remove(file_name_.c_str()) != 0 || std::rename(tmp_file_name.c_str(), file_name_.c_str()) != 0))
+    {
+        EPROSIMA_LOG_WARNING(DDSPIPE_TOPOLOGY_CACHE, "Error replacing topology cache " << file_name_ << ".");
+        return false;
+    }
+
+    logDebug(DDSPIPE_TOPOLOGY_CACHE, "Stored " << topology.size() << " topics in " << file_name_ << ".");
+
+    return true;
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,173 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DataBlockPool.cpp
+ *
+ */
+
+#include <algorithm>
+#include <functional>
+#include <new>
+#include <thread>
+
+#include <ddspipe_core/efficiency/data/DataBlockPool.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+constexpr const std::size_t DataBlockPool::DEFAULT_MAX_FREE_BLOCKS;
+constexpr const unsigned int DataBlockPool::N_SHARDS;
+constexpr const std::size_t DataBlockPool::SHARD_CAPACITY;
+
+DataBlockPool::DataBlockPool(
+        std::size_t block_size,
+        std::size_t max_free_blocks /* = DEFAULT_MAX_FREE_BLOCKS */)
+    : block_size_(block_size)
+    , max_free_blocks_(max_free_blocks)
+    , free_blocks_(0)
+{
+    // Reserve the space beforehand so releasing a block never allocates
+    for (auto& shard : shards_)
+    {
+        shard.blocks.reserve(SHARD_CAPACITY);
+    }
+
+    depot_.blocks.reserve(max_free_blocks_);
+}
+
+DataBlockPool::~DataBlockPool()
+{
+    for (auto& shard : shards_)
+    {
+        for (auto* block : shard.blocks)
+        {
+            ::operator delete(block);
+        }
+    }
+
+    for (auto* block : depot_.blocks)
+    {
+        ::operator delete(block);
+    }
+}
+
+void* DataBlockPool::allocate(
+        std::size_t size)
+{
+    if (size > block_size_)
+    {
+        return ::operator new(size);
+    }
+
+    void* block = pop_block_();
+
+    if (block != nullptr)
+    {
+        return block;
+    }
+
+    // Every block has the same size so it can be reused by any object
+    return ::operator new(block_size_);
+}
+
+void DataBlockPool::deallocate(
+        void* block,
+        std::size_t size) noexcept
+{
+    if (block == nullptr)
+    {
+        return;
+    }
+
+    if (size <= block_size_ && push_block_(block))
+    {
+        return;
+    }
+
+    ::operator delete(block);
+}
+
+std::size_t DataBlockPool::free_blocks() const noexcept
+{
+    return free_blocks_.load(std::memory_order_relaxed);
+}
+
+DataBlockPool::FreeList& DataBlockPool::shard_free_list_() noexcept
+{
+    const std::size_t shard = std::hash<std::thread::id>()(std::this_thread::get_id()) % N_SHARDS;
+    return shards_[shard];
+}
+
+void* DataBlockPool::pop_block_() noexcept
+{
+    FreeList& free_list = shard_free_list_();
+    std::lock_guard<std::mutex> lock(free_list.mutex);
+
+    // Refill the shard with a batch from the depot, so the depot is not locked in every allocation
+    if (free_list.blocks.empty())
+    {
+        std::lock_guard<std::mutex> depot_lock(depot_.mutex);
+
+        const std::size_t batch = std::min(depot_.blocks.size(), SHARD_CAPACITY / 2);
+        free_list.blocks.insert(free_list.blocks.end(), depot_.blocks.end() - batch, depot_.blocks.end());
+        depot_.blocks.resize(depot_.blocks.size() - batch);
+    }
+
+    if (free_list.blocks.empty())
+    {
+        return nullptr;
+    }
+
+    void* block = free_list.blocks.back();
+    free_list.blocks.pop_back();
+
+    free_blocks_.fetch_sub(1, std::memory_order_relaxed);
+
+    return block;
+}
+
+bool DataBlockPool::push_block_(
+        void* block) noexcept
+{
+    // Reserve the place of the block before keeping it
+    if (free_blocks_.fetch_add(1, std::memory_order_relaxed) >= max_free_blocks_)
+    {
+        free_blocks_.fetch_sub(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    FreeList& free_list = shard_free_list_();
+    std::lock_guard<std::mutex> lock(free_list.mutex);
+
+    // Move the oldest half of the shard to the depot, so the depot is not locked in every release.
+    // The depot has room for every block kept, so this never allocates.
+    if (free_list.blocks.size() >= SHARD_CAPACITY)
+    {
+        std::lock_guard<std::mutex> depot_lock(depot_.mutex);
+
+        const auto batch_end = free_list.blocks.begin() + SHARD_CAPACITY / 2;
+        depot_.blocks.insert(depot_.blocks.end(), free_list.blocks.begin(), batch_end);
+        free_list.blocks.erase(free_list.blocks.begin(), batch_end);
+    }
+
+    free_list.blocks.push_back(block);
+
+    return true;
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
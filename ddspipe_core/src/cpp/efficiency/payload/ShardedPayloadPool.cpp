@@ -0,0 +1,277 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ShardedPayloadPool.cpp
+ *
+ */
+
+#include <cstring>
+#include <utility>
+
+#include <cpp_utils/exception/InconsistencyException.hpp>
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_core/efficiency/payload/ShardedPayloadPool.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+using namespace eprosima::ddspipe::core::types;
+
+constexpr const unsigned int ShardedPayloadPool::SHARD_BITS;
+constexpr const unsigned int ShardedPayloadPool::N_SHARDS;
+constexpr const std::size_t ShardedPayloadPool::INITIAL_SHARD_SLOTS;
+
+ShardedPayloadPool::~ShardedPayloadPool()
+{
+    std::size_t reserved_payloads = 0;
+
+    for (const auto& shard : shards_)
+    {
+        reserved_payloads += shard.size;
+    }
+
+    if (reserved_payloads > 0)
+    {
+        logDevError(
+            DDSPIPE_PAYLOADPOOL,
+            "Removing ShardedPayloadPool with still " << reserved_payloads << " payloads referenced.");
+
+        // Data could not be erased because they will be erased once the Payload is destroyed
+    }
+}
+
+bool ShardedPayloadPool::get_payload(
+        uint32_t size,
+        eprosima::fastdds::rtps::SerializedPayload_t& payload)
+{
+    // Reserve new payload
+    if (!reserve_(size, payload))
+    {
+        return false;
+    }
+
+    // Store this payload in its shard
+    Shard& shard = shard_(payload.data);
+
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    insert_nts_(shard, payload.data);
+
+    return true;
+}
+
+bool ShardedPayloadPool::get_payload(
+        const eprosima::fastdds::rtps::SerializedPayload_t& src_payload,
+        eprosima::fastdds::rtps::SerializedPayload_t& target_payload)
+{
+    // If we are not the owner, create a new payload. Else, reference the existing one
+    if (src_payload.payload_owner != this)
+    {
+        // Store space for payload
+        if (!get_payload(src_payload.max_size, target_payload))
+        {
+            return false;
+        }
+
+        // Copy info
+        std::memcpy(target_payload.data, src_payload.data, src_payload.length);
+        target_payload.length = src_payload.length;
+    }
+    else
+    {
+        Shard& shard = shard_(src_payload.data);
+
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        // src_payload must be inside reserved payloads
+        Entry* entry = find_nts_(shard, src_payload.data);
+        if (entry == nullptr)
+        {
+            EPROSIMA_LOG_ERROR(DDSPIPE_PAYLOADPOOL,
+                    "Payload ownership is this pool, but it is not reserved from here.");
+            throw utils::InconsistencyException("Payload ownership is this pool, but it is not reserved from here.");
+        }
+
+        // Add reference
+        entry->references++;
+
+        // Set Payload to refer same payload
+        target_payload.data = src_payload.data;
+        target_payload.length = src_payload.length;
+        target_payload.max_size = src_payload.max_size;
+        target_payload.payload_owner = this;
+    }
+    return true;
+}
+
+bool ShardedPayloadPool::release_payload(
+        eprosima::fastdds::rtps::SerializedPayload_t& payload)
+{
+    bool last_reference = false;
+
+    {
+        Shard& shard = shard_(payload.data);
+
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        // Check that this payload is in this pool
+        Entry* entry = find_nts_(shard, payload.data);
+        if (entry == nullptr)
+        {
+            EPROSIMA_LOG_ERROR(DDSPIPE_PAYLOADPOOL, "Trying to release a payload from this pool that is not present.");
+            throw utils::InconsistencyException("Trying to release a payload from this pool that is not present.");
+        }
+
+        // Dereference element
+        entry->references--;
+
+        // In case it was the last reference, no one else can reach the data, so free it out of the lock
+        if (entry->references == 0)
+        {
+            erase_nts_(shard, entry);
+            last_reference = true;
+        }
+    }
+
+    if (last_reference && !release_(payload))
+    {
+        return false;
+    }
+
+    // Restore payload info
+    payload.length = 0;
+    payload.pos = 0;
+    payload.max_size = 0;
+    payload.payload_owner = nullptr;
+    payload.data = nullptr;
+
+    return true;
+}
+
+uint64_t ShardedPayloadPool::hash_(
+        const PayloadUnit* data) noexcept
+{
+    // Fibonacci hashing spreads the (aligned) pointers over the highest bits
+    return static_cast<uint64_t>(reinterpret_cast<std::uintptr_t>(data)) * 0x9E3779B97F4A7C15ull;
+}
+
+ShardedPayloadPool::Shard& ShardedPayloadPool::shard_(
+        const PayloadUnit* data) noexcept
+{
+    return shards_[hash_(data) >> (64 - SHARD_BITS)];
+}
+
+std::size_t ShardedPayloadPool::home_slot_(
+        const Shard& shard,
+        const PayloadUnit* data) noexcept
+{
+    // Skip the bits that select the shard, as they are the same for every data in it
+    return static_cast<std::size_t>(hash_(data) >> (32 - SHARD_BITS)) & (shard.slots.size() - 1);
+}
+
+ShardedPayloadPool::Entry* ShardedPayloadPool::find_nts_(
+        Shard& shard,
+        const PayloadUnit* data) noexcept
+{
+    const std::size_t mask = shard.slots.size() - 1;
+
+    // The table is never full, so there is always a free slot that ends the cluster
+    for (std::size_t slot = home_slot_(shard, data);; slot = (slot + 1) & mask)
+    {
+        Entry& entry = shard.slots[slot];
+
+        if (entry.data == data)
+        {
+            return &entry;
+        }
+
+        if (entry.data == nullptr)
+        {
+            return nullptr;
+        }
+    }
+}
+
+void ShardedPayloadPool::insert_nts_(
+        Shard& shard,
+        PayloadUnit* data)
+{
+    // Keep the load factor under 1/2 so the clusters stay short
+    if ((shard.size + 1) * 2 > shard.slots.size())
+    {
+        std::vector<Entry> old_slots(shard.slots.size() * 2);
+        std::swap(old_slots, shard.slots);
+
+        const std::size_t mask = shard.slots.size() - 1;
+
+        for (const auto& old_entry : old_slots)
+        {
+            if (old_entry.data == nullptr)
+            {
+                continue;
+            }
+
+            std::size_t slot = home_slot_(shard, old_entry.data);
+
+            while (shard.slots[slot].data != nullptr)
+            {
+                slot = (slot + 1) & mask;
+            }
+
+            shard.slots[slot] = old_entry;
+        }
+    }
+
+    const std::size_t mask = shard.slots.size() - 1;
+    std::size_t slot = home_slot_(shard, data);
+
+    while (shard.slots[slot].data != nullptr)
+    {
+        slot = (slot + 1) & mask;
+    }
+
+    shard.slots[slot].data = data;
+    shard.slots[slot].references = 1;
+    shard.size++;
+}
+
+void ShardedPayloadPool::erase_nts_(
+        Shard& shard,
+        Entry* entry) noexcept
+{
+    const std::size_t mask = shard.slots.size() - 1;
+
+    std::size_t hole = static_cast<std::size_t>(entry - shard.slots.data());
+
+    for (std::size_t slot = (hole + 1) & mask; shard.slots[slot].data != nullptr; slot = (slot + 1) & mask)
+    {
+        const std::size_t home = home_slot_(shard, shard.slots[slot].data);
+
+        // Move the entry to the hole unless its home is between the hole and its current slot
+        if (((slot - home) & mask) >= ((slot - hole) & mask))
+        {
+            shard.slots[hole] = shard.slots[slot];
+            hole = slot;
+        }
+    }
+
+    shard.slots[hole] = Entry();
+    shard.size--;
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,250 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SlabPayloadPool.cpp
+ *
+ */
+
+#include <cstdlib>
+#include <functional>
+#include <thread>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_core/efficiency/payload/SlabPayloadPool.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+using namespace eprosima::fastdds::rtps;
+
+constexpr const std::size_t SlabPayloadPool::DEFAULT_MAX_RETAINED_MEMORY;
+constexpr const unsigned int SlabPayloadPool::MIN_SIZE_CLASS_BITS;
+constexpr const unsigned int SlabPayloadPool::MAX_SIZE_CLASS_BITS;
+constexpr const unsigned int SlabPayloadPool::N_SIZE_CLASSES;
+constexpr const unsigned int SlabPayloadPool::N_SHARDS;
+constexpr const std::size_t SlabPayloadPool::SHARD_CAPACITY;
+
+SlabPayloadPool::SlabPayloadPool(
+        std::size_t max_retained_memory /* = DEFAULT_MAX_RETAINED_MEMORY */)
+    : max_retained_memory_(max_retained_memory)
+    , retained_memory_(0)
+{
+    // FastPayloadPool finds the reference counter right before the data
+    static_assert(
+        sizeof(std::uint32_t) + sizeof(MetaInfoType) == sizeof(BlockHeader),
+        "The reference counter must be right before the payload data.");
+}
+
+SlabPayloadPool::~SlabPayloadPool()
+{
+    for (auto& shard : shards_)
+    {
+        for (auto& free_list : shard)
+        {
+            for (auto* block : free_list.blocks)
+            {
+                std::free(block);
+            }
+        }
+    }
+
+    for (auto& free_list : depot_)
+    {
+        for (auto* block : free_list.blocks)
+        {
+            std::free(block);
+        }
+    }
+}
+
+std::size_t SlabPayloadPool::retained_memory() const noexcept
+{
+    return retained_memory_.load(std::memory_order_relaxed);
+}
+
+bool SlabPayloadPool::reserve_(
+        uint32_t size,
+        SerializedPayload_t& payload)
+{
+    if (size == 0)
+    {
+        logDevError(DDSPIPE_PAYLOADPOOL,
+                "Trying to reserve a data block of 0 bytes.");
+        return false;
+    }
+
+    const std::size_t required_size = size + sizeof(BlockHeader);
+    const unsigned int size_class = size_class_(required_size);
+
+    BlockHeader* block = nullptr;
+
+    if (size_class < N_SIZE_CLASSES)
+    {
+        block = pop_block_(size_class);
+
+        if (block == nullptr)
+        {
+            block = static_cast<BlockHeader*>(std::malloc(block_size_(size_class)));
+        }
+    }
+    else
+    {
+        // Too big to be recycled
+        block = static_cast<BlockHeader*>(std::malloc(required_size));
+    }
+
+    if (block == nullptr)
+    {
+        logDevError(DDSPIPE_PAYLOADPOOL,
+                "Error allocating a data block of " << required_size << " bytes.");
+        return false;
+    }
+
+    block->size_class = size_class;
+    block->references = 1;
+
+    payload.data = reinterpret_cast<octet*>(block + 1);
+    payload.max_size = size;
+    payload.payload_owner = this;
+
+    add_reserved_payload_();
+
+    logDebug(DDSPIPE_PAYLOADPOOL_SLAB, "Reserved payload ptr: " << static_cast<void*>(payload.data) << ".");
+
+    return true;
+}
+
+bool SlabPayloadPool::release_(
+        SerializedPayload_t& payload)
+{
+    logDebug(DDSPIPE_PAYLOADPOOL_SLAB, "Releasing payload ptr: " << static_cast<void*>(payload.data) << ".");
+
+    BlockHeader* block = reinterpret_cast<BlockHeader*>(payload.data) - 1;
+
+    if (block->size_class >= N_SIZE_CLASSES || !push_block_(block->size_class, block))
+    {
+        std::free(block);
+    }
+
+    // Remove payload internal values
+    payload.length = 0;
+    payload.max_size = 0;
+    payload.data = nullptr;
+    payload.payload_owner = nullptr;
+    payload.pos = 0;
+
+    add_release_payload_();
+
+    return true;
+}
+
+unsigned int SlabPayloadPool::size_class_(
+        std::size_t block_size) noexcept
+{
+    unsigned int size_class = 0;
+
+    while (size_class < N_SIZE_CLASSES && block_size_(size_class) < block_size)
+    {
+        ++size_class;
+    }
+
+    return size_class;
+}
+
+std::size_t SlabPayloadPool::block_size_(
+        unsigned int size_class) noexcept
+{
+    return std::size_t(1) << (size_class + MIN_SIZE_CLASS_BITS);
+}
+
+SlabPayloadPool::FreeList& SlabPayloadPool::shard_free_list_(
+        unsigned int size_class) noexcept
+{
+    const std::size_t shard = std::hash<std::thread::id>()(std::this_thread::get_id()) % N_SHARDS;
+    return shards_[shard][size_class];
+}
+
+SlabPayloadPool::BlockHeader* SlabPayloadPool::pop_block_(
+        unsigned int size_class) noexcept
+{
+    BlockHeader* block = nullptr;
+
+    {
+        FreeList& free_list = shard_free_list_(size_class);
+        std::lock_guard<std::mutex> lock(free_list.mutex);
+
+        if (!free_list.blocks.empty())
+        {
+            block = free_list.blocks.back();
+            free_list.blocks.pop_back();
+        }
+    }
+
+    if (block == nullptr)
+    {
+        FreeList& free_list = depot_[size_class];
+        std::lock_guard<std::mutex> lock(free_list.mutex);
+
+        if (!free_list.blocks.empty())
+        {
+            block = free_list.blocks.back();
+            free_list.blocks.pop_back();
+        }
+    }
+
+    if (block != nullptr)
+    {
+        retained_memory_.fetch_sub(block_size_(size_class), std::memory_order_relaxed);
+    }
+
+    return block;
+}
+
+bool SlabPayloadPool::push_block_(
+        unsigned int size_class,
+        BlockHeader* block) noexcept
+{
+    const std::size_t block_size = block_size_(size_class);
+
+    // Reserve the space in the retained memory before keeping the block
+    if (retained_memory_.fetch_add(block_size, std::memory_order_relaxed) + block_size > max_retained_memory_)
+    {
+        retained_memory_.fetch_sub(block_size, std::memory_order_relaxed);
+        return false;
+    }
+
+    {
+        FreeList& free_list = shard_free_list_(size_class);
+        std::lock_guard<std::mutex> lock(free_list.mutex);
+
+        if (free_list.blocks.size() < SHARD_CAPACITY)
+        {
+            free_list.blocks.push_back(block);
+            return true;
+        }
+    }
+
+    FreeList& free_list = depot_[size_class];
+    std::lock_guard<std::mutex> lock(free_list.mutex);
+    free_list.blocks.push_back(block);
+
+    return true;
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
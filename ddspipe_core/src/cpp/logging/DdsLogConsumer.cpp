@@ -17,8 +17,10 @@
  */
 
 #include <map>
+#include <memory>
 #include <regex>
 #include <string>
+#include <utility>
 
 #include <fastdds/dds/domain/DomainParticipantFactory.hpp>
 #include <fastdds/dds/publisher/qos/DataWriterQos.hpp>
@@ -37,6 +39,9 @@ namespace core {
 DdsLogConsumer::DdsLogConsumer(
         const DdsPipeLogConfiguration* configuration)
     : utils::BaseLogConsumer(configuration)
+    , overflow_policy_(configuration->publish_queue_overflow_policy)
+    , batch_size_(configuration->publish_batch_size)
+    , batch_period_(configuration->publish_batch_period)
 {
     // Create the participant
     fastdds::dds::DomainParticipantQos pqos;
@@ -87,10 +92,29 @@ DdsLogConsumer::DdsLogConsumer(
                   utils::Formatter() << "Error creating DataWriter for Participant " <<
                       participant_->guid() << " in topic " << topic_ << ".");
     }
+
+    // Publish the entries in a dedicated thread so logging does not wait for DDS
+    if (configuration->publish_queue_size > 0)
+    {
+        queue_ = std::make_unique<BoundedQueue<utils::Log::Entry>>(configuration->publish_queue_size);
+        publishing_thread_ = std::thread(&DdsLogConsumer::publishing_routine_, this);
+    }
 }
 
 DdsLogConsumer::~DdsLogConsumer()
 {
+    // Publish the entries queued before deleting the writer
+    if (publishing_thread_.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(publishing_mutex_);
+            stop_publishing_ = true;
+        }
+
+        publishing_cv_.notify_one();
+        publishing_thread_.join();
+    }
+
     if (writer_ != nullptr)
     {
         publisher_->delete_datawriter(writer_);
@@ -120,23 +144,40 @@ void DdsLogConsumer::Consume(
         return;
     }
 
+    if (queue_)
+    {
+        enqueue_(entry);
+    }
+    else
+    {
+        publish_(entry);
+    }
+}
+
+std::uint64_t DdsLogConsumer::dropped_entries() const noexcept
+{
+    return dropped_entries_.load(std::memory_order_relaxed);
+}
+
+void DdsLogConsumer::publish_(
+        const utils::Log::Entry& entry)
+{
     // Extract event from message
     long event = UNDEFINED;
 
     // The content of log messages should be either
     // "Event | Message" or "Message"
-    std::regex pattern(R"(^([^|]+)\s\|\s)");
     std::smatch match;
 
-    if (std::regex_search(entry.message, match, pattern) && match.size() > 1)
+    if (std::regex_search(entry.message, match, event_pattern_) && match.size() > 1)
     {
-        const std::string& event_str = match.str(1);
-
         // For an event to be valid, it must be in the events_ map.
         // Derived classes should add their specific events to the map.
-        if (events_.count(event_str))
+        const auto it = events_.find(match.str(1));
+
+        if (it != events_.end())
         {
-            event = events_[event_str];
+            event = it->second;
         }
     }
 
@@ -150,6 +191,67 @@ void DdsLogConsumer::Consume(
     writer_->write(&log_entry);
 }
 
+void DdsLogConsumer::enqueue_(
+        const utils::Log::Entry& entry)
+{
+    utils::Log::Entry queued_entry(entry);
+
+    if (!queue_->try_push(std::move(queued_entry)))
+    {
+        if (overflow_policy_ == LogQueueOverflowPolicy::drop_oldest)
+        {
+            // Make room for the new entry. The publishing thread may have made it already, so try again anyway.
+            utils::Log::Entry oldest_entry;
+
+            if (queue_->try_pop(oldest_entry))
+            {
+                dropped_entries_.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            if (!queue_->try_push(std::move(queued_entry)))
+            {
+                dropped_entries_.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        else
+        {
+            dropped_entries_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    if (queue_->size() >= batch_size_)
+    {
+        // Not taking the mutex may lose the notification, which only delays the batch till batch_period_
+        publishing_cv_.notify_one();
+    }
+}
+
+void DdsLogConsumer::publishing_routine_()
+{
+    utils::Log::Entry entry;
+    bool stop = false;
+
+    while (!stop)
+    {
+        {
+            std::unique_lock<std::mutex> lock(publishing_mutex_);
+
+            publishing_cv_.wait_for(lock, batch_period_, [this]()
+                    {
+                        return stop_publishing_ || queue_->size() >= batch_size_;
+                    });
+
+            stop = stop_publishing_;
+        }
+
+        // Publish every entry queued, also the ones queued while stopping
+        while (queue_->try_pop(entry))
+        {
+            publish_(entry);
+        }
+    }
+}
+
 constexpr Kind DdsLogConsumer::get_log_entry_kind_(
         const utils::Log::Kind kind) const noexcept
 {
@@ -0,0 +1,83 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LogThrottle.cpp
+ */
+
+#include <ddspipe_core/logging/LogThrottle.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+std::atomic<unsigned int> LogThrottle::max_occurrences_{DdsPipeLogConfiguration().throttle_max_occurrences};
+
+std::atomic<std::int64_t> LogThrottle::window_ticks_{
+    std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::milliseconds(DdsPipeLogConfiguration().throttle_window)).count()};
+
+bool LogThrottle::should_log(
+        std::uint64_t& suppressed) noexcept
+{
+    const auto max_occurrences = max_occurrences_.load(std::memory_order_relaxed);
+
+    if (max_occurrences == 0)
+    {
+        suppressed = 0;
+        return true;
+    }
+
+    const std::int64_t now = std::chrono::steady_clock::now().time_since_epoch().count();
+    auto window_start = window_start_.load(std::memory_order_relaxed);
+
+    suppressed = 0;
+
+    // Only the thread that moves the window resets the occurrences and reports the ones suppressed before.
+    // Occurrences counted by other threads meanwhile may be lost, so the limit is approximated.
+    if (now - window_start >= window_ticks_.load(std::memory_order_relaxed) &&
+            window_start_.compare_exchange_strong(window_start, now, std::memory_order_relaxed))
+    {
+        occurrences_.store(0, std::memory_order_relaxed);
+        suppressed = suppressed_.exchange(0, std::memory_order_relaxed);
+    }
+
+    if (occurrences_.fetch_add(1, std::memory_order_relaxed) < max_occurrences)
+    {
+        return true;
+    }
+
+    suppressed_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+void LogThrottle::configure(
+        const DdsPipeLogConfiguration& configuration) noexcept
+{
+    configure(configuration.throttle_max_occurrences, std::chrono::milliseconds(configuration.throttle_window));
+}
+
+void LogThrottle::configure(
+        unsigned int max_occurrences,
+        const std::chrono::milliseconds& window) noexcept
+{
+    max_occurrences_.store(max_occurrences, std::memory_order_relaxed);
+    window_ticks_.store(
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(window).count(),
+        std::memory_order_relaxed);
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
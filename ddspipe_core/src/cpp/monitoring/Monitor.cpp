@@ -19,6 +19,7 @@
 #include <ddspipe_core/monitoring/consumers/DdsMonitorConsumer.hpp>
 #include <ddspipe_core/monitoring/consumers/LogMonitorConsumer.hpp>
 #include <ddspipe_core/monitoring/Monitor.hpp>
+#include <ddspipe_core/monitoring/producers/ServicesMonitorProducer.hpp>
 #include <ddspipe_core/monitoring/producers/StatusMonitorProducer.hpp>
 #include <ddspipe_core/monitoring/producers/TopicsMonitorProducer.hpp>
 #include <ddspipe_core/types/monitoring/status/MonitoringStatus.hpp>
@@ -96,6 +97,20 @@ void Monitor::monitor_topics()
     register_producer_(topics_producer);
 }
 
+void Monitor::monitor_services()
+{
+    EPROSIMA_LOG_INFO(DDSPIPE_MONITOR, "MONITOR | Registering Services Monitor Producer.");
+
+    // Register the Services Monitor Producer
+    auto services_producer = ddspipe::core::ServicesMonitorProducer::get_instance();
+    services_producer->init(configuration_.producers.at(SERVICES_MONITOR_PRODUCER_ID));
+
+    // Register the consumers
+    services_producer->register_consumer(std::make_unique<ddspipe::core::LogMonitorConsumer<MonitoringServices>>());
+
+    register_producer_(services_producer);
+}
+
 void Monitor::register_producer_(
         IMonitorProducer* producer)
 {
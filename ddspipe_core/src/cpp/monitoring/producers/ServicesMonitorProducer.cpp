@@ -0,0 +1,376 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_core/monitoring/producers/ServicesMonitorProducer.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+std::mutex ServicesMonitorProducer::mutex_;
+std::unique_ptr<ServicesMonitorProducer> ServicesMonitorProducer::instance_ = nullptr;
+
+void ServicesMonitorProducer::ServiceCounters::reply(
+        const std::chrono::nanoseconds& latency) noexcept
+{
+    const auto latency_us = static_cast<std::uint64_t>(
+        std::max<std::int64_t>(std::chrono::duration_cast<std::chrono::microseconds>(latency).count(), 0));
+
+    replies.fetch_add(1, std::memory_order_relaxed);
+    latency_sum_us.fetch_add(latency_us, std::memory_order_relaxed);
+
+    auto max_us = latency_max_us.load(std::memory_order_relaxed);
+
+    while (latency_us > max_us && !latency_max_us.compare_exchange_weak(max_us, latency_us, std::memory_order_relaxed))
+    {
+        // max_us updated by compare_exchange_weak, try again
+    }
+
+    // Find the first bucket whose upper bound is not exceeded (or the unbounded one)
+    const auto bucket = std::lower_bound(
+        SERVICE_LATENCY_BUCKETS_MS.begin(),
+        SERVICE_LATENCY_BUCKETS_MS.end(),
+        latency_us,
+        [](std::uint32_t bound_ms, std::uint64_t value_us)
+        {
+            return static_cast<std::uint64_t>(bound_ms) * 1000 < value_us;
+        }) - SERVICE_LATENCY_BUCKETS_MS.begin();
+
+    latency_histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+void ServicesMonitorProducer::init_instance(
+        std::unique_ptr<ServicesMonitorProducer> instance)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (instance_ != nullptr)
+    {
+        EPROSIMA_LOG_WARNING(DDSPIPE_MONITOR, "MONITOR | ServicesMonitorProducer instance is already initialized.");
+        return;
+    }
+
+    instance_ = std::move(instance);
+}
+
+ServicesMonitorProducer* ServicesMonitorProducer::get_instance()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (instance_ == nullptr)
+    {
+        instance_ = std::make_unique<ServicesMonitorProducer>();
+    }
+
+    return instance_.get();
+}
+
+void ServicesMonitorProducer::enable()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    EPROSIMA_LOG_INFO(DDSPIPE_MONITOR, "MONITOR | Enabling ServicesMonitorProducer.");
+
+    // Counters are not checked for enabled_ , so discard what they counted while disabled
+    discard_counters_nts_();
+
+    enabled_ = true;
+}
+
+void ServicesMonitorProducer::disable()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    EPROSIMA_LOG_INFO(DDSPIPE_MONITOR, "MONITOR | Disabling ServicesMonitorProducer.");
+
+    enabled_ = false;
+}
+
+void ServicesMonitorProducer::register_consumer(
+        std::unique_ptr<IMonitorConsumer<MonitoringServices>> consumer)
+{
+    if (!enabled_)
+    {
+        EPROSIMA_LOG_WARNING(DDSPIPE_MONITOR,
+                "MONITOR | Not registering consumer " << consumer->get_name() << " on ServicesMonitorProducer"
+                " since the ServicesMonitorProducer is disabled.");
+
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    EPROSIMA_LOG_INFO(DDSPIPE_MONITOR,
+            "MONITOR | Registering consumer " << consumer->get_name() << " on ServicesMonitorProducer.");
+
+    consumers_.push_back(std::move(consumer));
+}
+
+void ServicesMonitorProducer::clear_consumers()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    EPROSIMA_LOG_INFO(DDSPIPE_MONITOR, "MONITOR | Removing all consumers from ServicesMonitorProducer.");
+
+    consumers_.clear();
+}
+
+void ServicesMonitorProducer::produce_and_consume()
+{
+    if (!enabled_)
+    {
+        // Don't produce if the producer is not enabled
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    produce_nts_();
+    consume_nts_();
+}
+
+void ServicesMonitorProducer::produce()
+{
+    if (!enabled_)
+    {
+        // Don't produce if the producer is not enabled
+        return;
+    }
+
+    // Take the lock to prevent saving the data while it's changing
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    produce_nts_();
+}
+
+void ServicesMonitorProducer::consume()
+{
+    if (!enabled_)
+    {
+        // Don't consume if the producer is not enabled
+        return;
+    }
+
+    // Take the lock to prevent consuming the data while it's changing
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    consume_nts_();
+}
+
+void ServicesMonitorProducer::clear_data()
+{
+    // Take the lock to prevent clearing the data while it's being saved
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    EPROSIMA_LOG_INFO(DDSPIPE_MONITOR, "MONITOR | Clearing the data.");
+
+    registered_.clear();
+
+    // The counters are kept, as they may be in use
+    discard_counters_nts_();
+
+    data_.services.clear();
+}
+
+std::shared_ptr<ServicesMonitorProducer::ServiceCounters> ServicesMonitorProducer::counters(
+        const std::string& service_name,
+        const types::ParticipantId& participant_id)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto& counters = counters_[service_name][participant_id];
+
+    if (!counters)
+    {
+        counters = std::make_shared<ServiceCounters>();
+    }
+
+    return counters;
+}
+
+void ServicesMonitorProducer::produce_nts_()
+{
+    EPROSIMA_LOG_INFO(DDSPIPE_MONITOR, "MONITOR | Producing MonitoringServices.");
+
+    std::vector<DdsService> services_data;
+
+    for (auto& service : counters_)
+    {
+        DdsService service_data;
+        service_data.name = service.first;
+
+        auto& registered_participants = registered_[service.first];
+
+        for (auto& participant : service.second)
+        {
+            auto& counters = *participant.second;
+
+            DdsServiceData data;
+            data.participant_id = participant.first;
+            data.requests = counters.requests.exchange(0, std::memory_order_relaxed);
+            data.replies = counters.replies.exchange(0, std::memory_order_relaxed);
+            data.requests_expired = counters.requests_expired.exchange(0, std::memory_order_relaxed);
+            data.requests_evicted = counters.requests_evicted.exchange(0, std::memory_order_relaxed);
+            data.replies_discarded = counters.replies_discarded.exchange(0, std::memory_order_relaxed);
+            data.requests_pending = counters.requests_pending.load(std::memory_order_relaxed);
+
+            const auto latency_sum_us = counters.latency_sum_us.exchange(0, std::memory_order_relaxed);
+            const auto latency_max_us = counters.latency_max_us.exchange(0, std::memory_order_relaxed);
+
+            for (auto& bucket : counters.latency_histogram)
+            {
+                data.latency_histogram.push_back(bucket.exchange(0, std::memory_order_relaxed));
+            }
+
+            if (data.requests == 0 && data.replies == 0 && data.requests_pending == 0 &&
+                    registered_participants.find(participant.first) == registered_participants.end())
+            {
+                // Do not register a service nor a participant till it has forwarded a request or a reply
+                continue;
+            }
+
+            registered_participants.insert(participant.first);
+
+            if (data.replies > 0)
+            {
+                data.mean_latency_ms = static_cast<double>(latency_sum_us) / data.replies / 1000;
+            }
+
+            data.max_latency_ms = static_cast<double>(latency_max_us) / 1000;
+
+            service_data.data.push_back(std::move(data));
+        }
+
+        if (!service_data.data.empty())
+        {
+            services_data.push_back(std::move(service_data));
+        }
+    }
+
+    data_.services = std::move(services_data);
+}
+
+void ServicesMonitorProducer::consume_nts_()
+{
+    EPROSIMA_LOG_INFO(DDSPIPE_MONITOR, "MONITOR | Consuming MonitoringServices.");
+
+    for (auto& consumer : consumers_)
+    {
+        consumer->consume(data_);
+    }
+}
+
+void ServicesMonitorProducer::discard_counters_nts_()
+{
+    for (auto& service : counters_)
+    {
+        for (auto& participant : service.second)
+        {
+            auto& counters = *participant.second;
+
+            counters.requests.store(0, std::memory_order_relaxed);
+            counters.replies.store(0, std::memory_order_relaxed);
+            counters.requests_expired.store(0, std::memory_order_relaxed);
+            counters.requests_evicted.store(0, std::memory_order_relaxed);
+            counters.replies_discarded.store(0, std::memory_order_relaxed);
+            counters.latency_sum_us.store(0, std::memory_order_relaxed);
+            counters.latency_max_us.store(0, std::memory_order_relaxed);
+
+            for (auto& bucket : counters.latency_histogram)
+            {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+}
+
+} //namespace core
+} //namespace ddspipe
+} //namespace eprosima
+
+namespace std {
+
+std::ostream& operator <<(
+        std::ostream& os,
+        const eprosima::ddspipe::core::DdsServiceData& data)
+{
+    os << "Participant ID: " << data.participant_id;
+    os << ", Requests: " << data.requests;
+    os << ", Replies: " << data.replies;
+    os << ", Requests Expired: " << data.requests_expired;
+    os << ", Requests Evicted: " << data.requests_evicted;
+    os << ", Replies Discarded: " << data.replies_discarded;
+    os << ", Requests Pending: " << data.requests_pending;
+    os << ", Mean Latency (ms): " << data.mean_latency_ms;
+    os << ", Max Latency (ms): " << data.max_latency_ms;
+
+    os << ", Latency Histogram: [";
+
+    for (std::size_t i = 0; i < data.latency_histogram.size(); ++i)
+    {
+        if (i < eprosima::ddspipe::core::SERVICE_LATENCY_BUCKETS_MS.size())
+        {
+            os << "<=" << eprosima::ddspipe::core::SERVICE_LATENCY_BUCKETS_MS[i] << "ms: ";
+        }
+        else
+        {
+            os << ">" << eprosima::ddspipe::core::SERVICE_LATENCY_BUCKETS_MS.back() << "ms: ";
+        }
+
+        os << data.latency_histogram[i] << "; ";
+    }
+
+    os << "]";
+
+    return os;
+}
+
+std::ostream& operator <<(
+        std::ostream& os,
+        const eprosima::ddspipe::core::DdsService& service)
+{
+    os << "Service Name: " << service.name;
+
+    os << ", Data: [";
+
+    for (const auto& data : service.data)
+    {
+        os << data << "; ";
+    }
+
+    os << "]";
+
+    return os;
+}
+
+std::ostream& operator <<(
+        std::ostream& os,
+        const eprosima::ddspipe::core::MonitoringServices& data)
+{
+    os << "Monitoring Services: [";
+
+    for (const auto& service : data.services)
+    {
+        os << service << "; ";
+    }
+
+    os << "]";
+    return os;
+}
+
+} // namespace std
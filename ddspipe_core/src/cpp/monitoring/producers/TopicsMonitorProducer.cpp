@@ -14,6 +14,7 @@
 
 #include <cpp_utils/Log.hpp>
 
+#include <ddspipe_core/logging/LogThrottle.hpp>
 #include <ddspipe_core/monitoring/producers/TopicsMonitorProducer.hpp>
 
 namespace eprosima {
@@ -55,6 +56,9 @@ void TopicsMonitorProducer::enable()
 
     EPROSIMA_LOG_INFO(DDSPIPE_MONITOR, "MONITOR | Enabling TopicsMonitorProducer.");
 
+    // Counters are not checked for enabled_ , so discard what they counted while disabled
+    discard_counters_nts_();
+
     enabled_ = true;
 }
 
@@ -149,9 +153,21 @@ void TopicsMonitorProducer::clear_data()
     participant_data_.clear();
     types_discovered_.clear();
 
+    // The counters are kept, as they may be in use
+    discard_counters_nts_();
+
     data_.topics().clear();
 }
 
+std::shared_ptr<TopicsMonitorProducer::MessageCounters> TopicsMonitorProducer::counters(
+        const types::DdsTopic& topic,
+        const types::ParticipantId& participant_id)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    return counters_nts_(topic, participant_id);
+}
+
 void TopicsMonitorProducer::msgs_received(
         const types::DdsTopic& topic,
         const types::ParticipantId& participant_id,
@@ -168,19 +184,12 @@ void TopicsMonitorProducer::msgs_received(
     //      2. Simultaneous calls to msg_received.
     std::lock_guard<std::mutex> lock(mutex_);
 
-    EPROSIMA_LOG_INFO(DDSPIPE_MONITOR, "MONITOR | Received " << number_of_messages << " messages from Participant " <<
-            participant_id << " on Topic " << topic << ".");
-
-    // Register the topic
-    topic_data_[topic].name(topic.m_topic_name);
-    topic_data_[topic].type_name(topic.type_name);
-
-    // Register the participant
-    participant_data_[topic][participant_id].participant_id(participant_id);
+    DDSPIPE_LOG_INFO_THROTTLED(DDSPIPE_MONITOR,
+            "MONITOR | Received " << number_of_messages << " messages from Participant " << participant_id <<
+            " on Topic " << topic << ".");
 
     // Increase the count of the received messages
-    participant_data_[topic][participant_id].msgs_received(participant_data_[topic][participant_id].msgs_received() +
-            number_of_messages);
+    counters_nts_(topic, participant_id)->msgs_received.fetch_add(number_of_messages, std::memory_order_relaxed);
 }
 
 void TopicsMonitorProducer::msgs_lost(
@@ -199,19 +208,12 @@ void TopicsMonitorProducer::msgs_lost(
     //      2. Simultaneous calls to msg_lost.
     std::lock_guard<std::mutex> lock(mutex_);
 
-    EPROSIMA_LOG_INFO(DDSPIPE_MONITOR, "MONITOR | Lost " << number_of_messages << " messages from Participant " <<
-            participant_id << " on Topic " << topic << ".");
-
-    // Register the topic
-    topic_data_[topic].name(topic.m_topic_name);
-    topic_data_[topic].type_name(topic.type_name);
-
-    // Register the participant id
-    participant_data_[topic][participant_id].participant_id(participant_id);
+    DDSPIPE_LOG_INFO_THROTTLED(DDSPIPE_MONITOR,
+            "MONITOR | Lost " << number_of_messages << " messages from Participant " << participant_id <<
+            " on Topic " << topic << ".");
 
     // Increase the count of the lost messages
-    participant_data_[topic][participant_id].msgs_lost(participant_data_[topic][participant_id].msgs_lost() +
-            number_of_messages);
+    counters_nts_(topic, participant_id)->msgs_lost.fetch_add(number_of_messages, std::memory_order_relaxed);
 }
 
 void TopicsMonitorProducer::type_discovered(
@@ -285,6 +287,8 @@ void TopicsMonitorProducer::produce_nts_()
 {
     EPROSIMA_LOG_INFO(DDSPIPE_MONITOR, "MONITOR | Producing MonitoringTopics.");
 
+    gather_counters_nts_();
+
     std::vector<DdsTopic> topics_data;
 
     // Iterate through the different topics
@@ -330,7 +334,8 @@ void TopicsMonitorProducer::consume_nts_()
 
 void TopicsMonitorProducer::reset_data_()
 {
-    EPROSIMA_LOG_INFO(DDSPIPE_MONITOR, "MONITOR | Resetting the messages received and lost for the next period.");
+    EPROSIMA_LOG_INFO(DDSPIPE_MONITOR,
+            "MONITOR | Resetting the messages received, lost and dropped for the next period.");
 
     // Reset the data
     for (auto& topic : participant_data_)
@@ -339,6 +344,69 @@ void TopicsMonitorProducer::reset_data_()
         {
             participant.second.msgs_received(0);
             participant.second.msgs_lost(0);
+            participant.second.msgs_dropped(0);
+        }
+    }
+}
+
+std::shared_ptr<TopicsMonitorProducer::MessageCounters> TopicsMonitorProducer::counters_nts_(
+        const types::DdsTopic& topic,
+        const types::ParticipantId& participant_id)
+{
+    auto& counters = counters_[topic][participant_id];
+
+    if (!counters)
+    {
+        counters = std::make_shared<MessageCounters>();
+    }
+
+    return counters;
+}
+
+void TopicsMonitorProducer::gather_counters_nts_()
+{
+    for (auto& topic : counters_)
+    {
+        for (auto& participant : topic.second)
+        {
+            const auto msgs_received = participant.second->msgs_received.exchange(0, std::memory_order_relaxed);
+            const auto msgs_lost = participant.second->msgs_lost.exchange(0, std::memory_order_relaxed);
+            const auto msgs_dropped = participant.second->msgs_dropped.exchange(0, std::memory_order_relaxed);
+
+            auto& topic_participants = participant_data_[topic.first];
+
+            if (msgs_received == 0 && msgs_lost == 0 && msgs_dropped == 0 &&
+                    topic_participants.find(participant.first) == topic_participants.end())
+            {
+                // Do not register a topic nor a participant till it has received, lost or dropped a message
+                continue;
+            }
+
+            // Register the topic
+            topic_data_[topic.first].name(topic.first.m_topic_name);
+            topic_data_[topic.first].type_name(topic.first.type_name);
+
+            // Register the participant
+            auto& data = topic_participants[participant.first];
+            data.participant_id(participant.first);
+
+            // Increase the count of the messages
+            data.msgs_received(static_cast<uint32_t>(data.msgs_received() + msgs_received));
+            data.msgs_lost(static_cast<uint32_t>(data.msgs_lost() + msgs_lost));
+            data.msgs_dropped(static_cast<uint32_t>(data.msgs_dropped() + msgs_dropped));
+        }
+    }
+}
+
+void TopicsMonitorProducer::discard_counters_nts_()
+{
+    for (auto& topic : counters_)
+    {
+        for (auto& participant : topic.second)
+        {
+            participant.second->msgs_received.store(0, std::memory_order_relaxed);
+            participant.second->msgs_lost.store(0, std::memory_order_relaxed);
+            participant.second->msgs_dropped.store(0, std::memory_order_relaxed);
         }
     }
 }
@@ -356,6 +424,7 @@ std::ostream& operator <<(
     os << "Participant ID: " << data.participant_id();
     os << ", Messages Received: " << data.msgs_received();
     os << ", Messages Lost: " << data.msgs_lost();
+    os << ", Messages Dropped: " << data.msgs_dropped();
     os << ", Message Reception Rate: " << data.msg_rx_rate();
     return os;
 }
@@ -42,6 +42,32 @@ types::TopicInternalTypeDiscriminator RtpsPayloadData::internal_type_discriminat
     return INTERNAL_TOPIC_TYPE_RTPS;
 }
 
+void* RtpsPayloadData::operator new(
+        std::size_t size)
+{
+    return block_pool().allocate(size);
+}
+
+void RtpsPayloadData::operator delete(
+        void* ptr,
+        std::size_t size) noexcept
+{
+    block_pool().deallocate(ptr, size);
+}
+
+DataBlockPool& RtpsPayloadData::block_pool() noexcept
+{
+    // NOTE: it is never destroyed, so data destroyed during the static destruction can still return its memory
+    static DataBlockPool* pool = new DataBlockPool(sizeof(RtpsPayloadData));
+    return *pool;
+}
+
+const SpecificEndpointQoS& RtpsPayloadData::writer_specific_qos() const noexcept
+{
+    static const SpecificEndpointQoS default_qos;
+    return writer_qos ? *writer_qos : default_qos;
+}
+
 std::ostream& operator <<(
         std::ostream& os,
         const RtpsPayloadData& data)
@@ -51,11 +77,11 @@ std::ostream& operator <<(
     os << data.payload << ";";
     os << data.instanceHandle << ";";
     os << data.kind << ";";
-    os << data.participant_receiver << ";";
+    os << interned_participant_id(data.participant_receiver) << ";";
     os << data.payload_owner << ";";
     os << data.source_guid << ";";
     os << data.source_timestamp << ";";
-    os << data.writer_qos << ";";
+    os << data.writer_specific_qos() << ";";
     os << "}";
     return os;
 }
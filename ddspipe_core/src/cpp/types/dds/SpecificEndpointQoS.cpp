@@ -17,6 +17,9 @@
  *
  */
 
+#include <cstring>
+#include <functional>
+
 #include <ddspipe_core/types/dds/SpecificEndpointQoS.hpp>
 #include <cpp_utils/utils.hpp>
 
@@ -48,19 +51,19 @@ bool SpecificEndpointQoS::operator < (
         return false;
     }
 
-    auto const this_names = this->partitions.getNames();
-    auto const other_names = other.partitions.getNames();
+    // Iterate the partitions in place, as getNames allocates a vector of strings
+    auto other_it = other.partitions.begin();
 
-    for (unsigned int i = 0; i < this_names.size(); ++i)
+    for (const auto& partition : this->partitions)
     {
-        if (this_names[i] < other_names[i])
-        {
-            return true;
-        }
-        else if (this_names[i] > other_names[i])
+        const int comparison = std::strcmp(partition.name(), (*other_it).name());
+
+        if (comparison != 0)
         {
-            return false;
+            return comparison < 0;
         }
+
+        ++other_it;
     }
 
     return false;
@@ -69,7 +72,48 @@ bool SpecificEndpointQoS::operator < (
 bool SpecificEndpointQoS::operator == (
         const SpecificEndpointQoS& other) const noexcept
 {
-    return this->partitions == other.partitions && this->ownership_strength == other.ownership_strength;
+    if (this->ownership_strength.value != other.ownership_strength.value ||
+            this->partitions.size() != other.partitions.size())
+    {
+        return false;
+    }
+
+    // Compare the partition names in place, as this is called in every write of a MultiWriter
+    auto other_it = other.partitions.begin();
+
+    for (const auto& partition : this->partitions)
+    {
+        if (std::strcmp(partition.name(), (*other_it).name()) != 0)
+        {
+            return false;
+        }
+
+        ++other_it;
+    }
+
+    return true;
+}
+
+std::size_t SpecificEndpointQoS::hash() const noexcept
+{
+    // Combine the same fields compared in equality operator
+    std::size_t seed = std::hash<uint32_t>()(this->ownership_strength.value);
+
+    // Hash the partition names in place, as this is called in every write of a MultiWriter
+    for (const auto& partition : this->partitions)
+    {
+        // FNV-1a of the name
+        std::size_t name_hash = 14695981039346656037ull;
+
+        for (const char* c = partition.name(); *c != '\0'; ++c)
+        {
+            name_hash = (name_hash ^ static_cast<unsigned char>(*c)) * 1099511628211ull;
+        }
+
+        seed ^= name_hash + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+
+    return seed;
 }
 
 std::ostream& operator <<(
@@ -34,6 +34,13 @@ constexpr const bool TopicQoS::DEFAULT_KEYED;
 constexpr const float TopicQoS::DEFAULT_MAX_TX_RATE;
 constexpr const float TopicQoS::DEFAULT_MAX_RX_RATE;
 constexpr const unsigned int TopicQoS::DEFAULT_DOWNSAMPLING;
+constexpr const unsigned int TopicQoS::DEFAULT_TRANSMISSION_QUANTUM_SAMPLES;
+constexpr const unsigned int TopicQoS::DEFAULT_TRANSMISSION_QUANTUM_TIME;
+constexpr const unsigned int TopicQoS::DEFAULT_WRITER_QUEUE_SIZE;
+constexpr const WriterQueueOverflowPolicy TopicQoS::DEFAULT_WRITER_QUEUE_OVERFLOW_POLICY;
+constexpr const bool TopicQoS::DEFAULT_INLINE_TRANSMISSION;
+constexpr const unsigned int TopicQoS::DEFAULT_CONFLATION_THRESHOLD;
+constexpr const unsigned int TopicQoS::DEFAULT_MAX_FORWARD_LATENCY;
 
 utils::Fuzzy<TopicQoS> TopicQoS::default_topic_qos{};
 
@@ -62,6 +69,13 @@ bool TopicQoS::operator ==(
         this->max_tx_rate == other.max_tx_rate &&
         this->max_rx_rate == other.max_rx_rate &&
         this->downsampling == other.downsampling &&
+        this->transmission_quantum_samples == other.transmission_quantum_samples &&
+        this->transmission_quantum_time == other.transmission_quantum_time &&
+        this->writer_queue_size == other.writer_queue_size &&
+        this->writer_queue_overflow_policy == other.writer_queue_overflow_policy &&
+        this->inline_transmission == other.inline_transmission &&
+        this->conflation_threshold == other.conflation_threshold &&
+        this->max_forward_latency == other.max_forward_latency &&
         this->endpoint_profile_name == other.endpoint_profile_name;
 }
 
@@ -134,6 +148,41 @@ void TopicQoS::set_qos(
         downsampling.set_value(qos.downsampling.get_value(), fuzzy_level);
     }
 
+    if (transmission_quantum_samples.get_level() < fuzzy_level && qos.transmission_quantum_samples.is_set())
+    {
+        transmission_quantum_samples.set_value(qos.transmission_quantum_samples.get_value(), fuzzy_level);
+    }
+
+    if (transmission_quantum_time.get_level() < fuzzy_level && qos.transmission_quantum_time.is_set())
+    {
+        transmission_quantum_time.set_value(qos.transmission_quantum_time.get_value(), fuzzy_level);
+    }
+
+    if (writer_queue_size.get_level() < fuzzy_level && qos.writer_queue_size.is_set())
+    {
+        writer_queue_size.set_value(qos.writer_queue_size.get_value(), fuzzy_level);
+    }
+
+    if (writer_queue_overflow_policy.get_level() < fuzzy_level && qos.writer_queue_overflow_policy.is_set())
+    {
+        writer_queue_overflow_policy.set_value(qos.writer_queue_overflow_policy.get_value(), fuzzy_level);
+    }
+
+    if (inline_transmission.get_level() < fuzzy_level && qos.inline_transmission.is_set())
+    {
+        inline_transmission.set_value(qos.inline_transmission.get_value(), fuzzy_level);
+    }
+
+    if (conflation_threshold.get_level() < fuzzy_level && qos.conflation_threshold.is_set())
+    {
+        conflation_threshold.set_value(qos.conflation_threshold.get_value(), fuzzy_level);
+    }
+
+    if (max_forward_latency.get_level() < fuzzy_level && qos.max_forward_latency.is_set())
+    {
+        max_forward_latency.set_value(qos.max_forward_latency.get_value(), fuzzy_level);
+    }
+
     if (endpoint_profile_name.get_level() < fuzzy_level && qos.endpoint_profile_name.is_set())
     {
         endpoint_profile_name.set_value(qos.endpoint_profile_name.get_value(), fuzzy_level);
@@ -151,6 +200,16 @@ void TopicQoS::set_default_qos() noexcept
     this->max_tx_rate.set_value(DEFAULT_MAX_TX_RATE, utils::FuzzyLevelValues::fuzzy_level_default);
     this->max_rx_rate.set_value(DEFAULT_MAX_RX_RATE, utils::FuzzyLevelValues::fuzzy_level_default);
     this->downsampling.set_value(DEFAULT_DOWNSAMPLING, utils::FuzzyLevelValues::fuzzy_level_default);
+    this->transmission_quantum_samples.set_value(
+        DEFAULT_TRANSMISSION_QUANTUM_SAMPLES, utils::FuzzyLevelValues::fuzzy_level_default);
+    this->transmission_quantum_time.set_value(
+        DEFAULT_TRANSMISSION_QUANTUM_TIME, utils::FuzzyLevelValues::fuzzy_level_default);
+    this->writer_queue_size.set_value(DEFAULT_WRITER_QUEUE_SIZE, utils::FuzzyLevelValues::fuzzy_level_default);
+    this->writer_queue_overflow_policy.set_value(
+        DEFAULT_WRITER_QUEUE_OVERFLOW_POLICY, utils::FuzzyLevelValues::fuzzy_level_default);
+    this->inline_transmission.set_value(DEFAULT_INLINE_TRANSMISSION, utils::FuzzyLevelValues::fuzzy_level_default);
+    this->conflation_threshold.set_value(DEFAULT_CONFLATION_THRESHOLD, utils::FuzzyLevelValues::fuzzy_level_default);
+    this->max_forward_latency.set_value(DEFAULT_MAX_FORWARD_LATENCY, utils::FuzzyLevelValues::fuzzy_level_default);
 }
 
 std::ostream& operator <<(
@@ -251,6 +310,40 @@ std::ostream& operator <<(
     return os;
 }
 
+std::ostream& operator <<(
+        std::ostream& os,
+        const WriterQueueOverflowPolicy& policy)
+{
+    switch (policy)
+    {
+        case WriterQueueOverflowPolicy::drop_oldest:
+            os << "DROP_OLDEST";
+            break;
+
+        case WriterQueueOverflowPolicy::drop_newest:
+            os << "DROP_NEWEST";
+            break;
+
+        case WriterQueueOverflowPolicy::block:
+            os << "BLOCK";
+            break;
+
+        default:
+            utils::tsnh(utils::Formatter() << "Invalid Writer Queue Overflow Policy.");
+            break;
+    }
+
+    return os;
+}
+
+std::ostream& operator <<(
+        std::ostream& os,
+        const utils::Fuzzy<WriterQueueOverflowPolicy>& policy)
+{
+    os << "Fuzzy{Level(" << policy.get_level_as_str() << ") " << policy.get_reference() << "}";
+    return os;
+}
+
 std::ostream& operator <<(
         std::ostream& os,
         const TopicQoS& qos)
@@ -265,6 +358,13 @@ std::ostream& operator <<(
        << ";max_tx_rate(" << qos.max_tx_rate << ")"
        << ";max_rx_rate(" << qos.max_rx_rate << ")"
        << ";downsampling(" << qos.downsampling << ")"
+       << ";transmission_quantum_samples(" << qos.transmission_quantum_samples << ")"
+       << ";transmission_quantum_time(" << qos.transmission_quantum_time << ")"
+       << ";writer_queue_size(" << qos.writer_queue_size << ")"
+       << ";writer_queue_overflow_policy(" << qos.writer_queue_overflow_policy << ")"
+       << (qos.inline_transmission ? ";inline_transmission" : "")
+       << ";conflation_threshold(" << qos.conflation_threshold << ")"
+       << ";max_forward_latency(" << qos.max_forward_latency << ")"
        << (qos.endpoint_profile_name.is_set() ? ";endpoint_profile_name(" + qos.endpoint_profile_name.get_value() +
     ")" : "")
        << "}";
@@ -186,6 +186,36 @@ void register_DdsTopicData_type_identifier(
             CompleteStructMember member_msg_rx_rate = TypeObjectUtils::build_complete_struct_member(common_msg_rx_rate, detail_msg_rx_rate);
             TypeObjectUtils::add_complete_struct_member(member_seq_DdsTopicData, member_msg_rx_rate);
         }
+        {
+            TypeIdentifierPair type_ids_msgs_dropped;
+            ReturnCode_t return_code_msgs_dropped {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_msgs_dropped =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_uint32_t", type_ids_msgs_dropped);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_msgs_dropped)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "msgs_dropped Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_msgs_dropped = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_msgs_dropped = 0x00000004;
+            bool common_msgs_dropped_ec {false};
+            CommonStructMember common_msgs_dropped {TypeObjectUtils::build_common_struct_member(member_id_msgs_dropped, member_flags_msgs_dropped, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_msgs_dropped, common_msgs_dropped_ec))};
+            if (!common_msgs_dropped_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure msgs_dropped member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_msgs_dropped = "msgs_dropped";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_msgs_dropped;
+            ann_custom_DdsTopicData.reset();
+            CompleteMemberDetail detail_msgs_dropped = TypeObjectUtils::build_complete_member_detail(name_msgs_dropped, member_ann_builtin_msgs_dropped, ann_custom_DdsTopicData);
+            CompleteStructMember member_msgs_dropped = TypeObjectUtils::build_complete_struct_member(common_msgs_dropped, detail_msgs_dropped);
+            TypeObjectUtils::add_complete_struct_member(member_seq_DdsTopicData, member_msgs_dropped);
+        }
         CompleteStructType struct_type_DdsTopicData = TypeObjectUtils::build_complete_struct_type(struct_flags_DdsTopicData, header_DdsTopicData, member_seq_DdsTopicData);
         if (eprosima::fastdds::dds::RETCODE_BAD_PARAMETER ==
                 TypeObjectUtils::build_and_register_struct_type_object(struct_type_DdsTopicData, type_name_DdsTopicData.to_string(), type_ids_DdsTopicData))
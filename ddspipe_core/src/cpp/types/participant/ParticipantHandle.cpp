@@ -0,0 +1,111 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ParticipantHandle.cpp
+ *
+ */
+
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include <ddspipe_core/types/participant/ParticipantHandle.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+namespace types {
+
+namespace {
+
+//! Participant ids interned, indexed by their handle
+struct ParticipantIdTable
+{
+    ParticipantIdTable()
+    {
+        ids.emplace_back(DEFAULT_PARTICIPANT_ID);
+        handles.emplace(ids.back(), DEFAULT_PARTICIPANT_HANDLE);
+    }
+
+    //! Ids indexed by handle. A deque does not move its elements, so references to them stay valid.
+    std::deque<ParticipantId> ids;
+
+    //! Handle of each id
+    std::unordered_map<ParticipantId, ParticipantHandle> handles;
+
+    //! Mutex guarding the table. Ids are only added, so most calls only read it.
+    std::shared_timed_mutex mutex;
+};
+
+ParticipantIdTable& participant_id_table()
+{
+    // Never destroyed, so handles can be used while static objects are destroyed
+    static ParticipantIdTable* table = new ParticipantIdTable();
+    return *table;
+}
+
+} /* namespace */
+
+ParticipantHandle intern_participant_id(
+        const ParticipantId& participant_id) noexcept
+{
+    auto& table = participant_id_table();
+
+    {
+        std::shared_lock<std::shared_timed_mutex> lock(table.mutex);
+
+        auto it = table.handles.find(participant_id);
+        if (it != table.handles.end())
+        {
+            return it->second;
+        }
+    }
+
+    std::unique_lock<std::shared_timed_mutex> lock(table.mutex);
+
+    // Another thread may have interned it meanwhile
+    auto it = table.handles.find(participant_id);
+    if (it != table.handles.end())
+    {
+        return it->second;
+    }
+
+    const ParticipantHandle handle = static_cast<ParticipantHandle>(table.ids.size());
+    table.ids.push_back(participant_id);
+    table.handles.emplace(participant_id, handle);
+
+    return handle;
+}
+
+const ParticipantId& interned_participant_id(
+        const ParticipantHandle handle) noexcept
+{
+    auto& table = participant_id_table();
+
+    std::shared_lock<std::shared_timed_mutex> lock(table.mutex);
+
+    if (handle >= table.ids.size())
+    {
+        return table.ids[DEFAULT_PARTICIPANT_HANDLE];
+    }
+
+    return table.ids[handle];
+}
+
+} /* namespace types */
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,183 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file FilterTopicIndex.cpp
+ *
+ */
+
+#include <cpp_utils/types/cast.hpp>
+
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+#include <ddspipe_core/types/topic/filter/FilterTopicIndex.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+namespace types {
+
+FilterTopicIndex::FilterTopicIndex()
+    : prefix_trie_(1)
+    , size_(0)
+{
+}
+
+FilterTopicIndex::FilterTopicIndex(
+        const std::set<utils::Heritable<IFilterTopic>>& filters)
+    : FilterTopicIndex()
+{
+    for (const auto& filter : filters)
+    {
+        if (utils::can_cast<WildcardDdsFilterTopic>(filter.get_reference()))
+        {
+            add_wildcard_filter_(filter);
+        }
+        else
+        {
+            generic_filters_.push_back(filter);
+        }
+    }
+
+    size_ = filters.size();
+}
+
+bool FilterTopicIndex::matches(
+        const ITopic& topic) const noexcept
+{
+    for (const auto& filter : generic_filters_)
+    {
+        if (filter->matches(topic))
+        {
+            return true;
+        }
+    }
+
+    // Wildcard filters only match DDS Topics
+    if (!utils::can_cast<DdsTopic>(topic))
+    {
+        return false;
+    }
+
+    const std::string& topic_name = static_cast<const DdsTopic&>(topic).m_topic_name;
+
+    // Filters with the exact topic name
+    auto it = literal_filters_.find(topic_name);
+    if (it != literal_filters_.end())
+    {
+        for (const auto& filter : it->second)
+        {
+            if (filter->matches(topic))
+            {
+                return true;
+            }
+        }
+    }
+
+    // Filters whose literal prefix is a prefix of the topic name
+    std::size_t node = 0;
+    std::size_t depth = 0;
+
+    while (true)
+    {
+        for (const auto& filter : prefix_trie_[node].filters)
+        {
+            if (filter->matches(topic))
+            {
+                return true;
+            }
+        }
+
+        if (depth == topic_name.size())
+        {
+            break;
+        }
+
+        auto child = prefix_trie_[node].children.find(topic_name[depth]);
+        if (child == prefix_trie_[node].children.end())
+        {
+            break;
+        }
+
+        node = child->second;
+        ++depth;
+    }
+
+    return false;
+}
+
+bool FilterTopicIndex::empty() const noexcept
+{
+    return size_ == 0;
+}
+
+bool FilterTopicIndex::only_names_matched() const noexcept
+{
+    return generic_filters_.empty();
+}
+
+void FilterTopicIndex::add_wildcard_filter_(
+        const utils::Heritable<IFilterTopic>& filter)
+{
+    const auto& wildcard_filter = static_cast<const WildcardDdsFilterTopic&>(filter.get_reference());
+    std::string prefix;
+
+    if (wildcard_filter.topic_name.is_set())
+    {
+        const std::string& pattern = wildcard_filter.topic_name.get_reference();
+        prefix = literal_prefix_(pattern);
+
+        if (prefix.size() == pattern.size())
+        {
+            literal_filters_[pattern].push_back(filter);
+            return;
+        }
+    }
+
+    // Walk the trie creating the nodes of the prefix that do not exist yet
+    std::size_t node = 0;
+
+    for (char c : prefix)
+    {
+        auto child = prefix_trie_[node].children.find(c);
+        if (child != prefix_trie_[node].children.end())
+        {
+            node = child->second;
+        }
+        else
+        {
+            prefix_trie_.emplace_back();
+            prefix_trie_[node].children[c] = prefix_trie_.size() - 1;
+            node = prefix_trie_.size() - 1;
+        }
+    }
+
+    prefix_trie_[node].filters.push_back(filter);
+}
+
+std::string FilterTopicIndex::literal_prefix_(
+        const std::string& pattern) noexcept
+{
+#if defined(_WIN32)
+    // Patterns are matched case insensitively in Windows, so they cannot be indexed by their characters
+    static_cast<void>(pattern);
+    return std::string();
+#else
+    return pattern.substr(0, pattern.find_first_of("*?[\\"));
+#endif // if defined(_WIN32)
+}
+
+} /* namespace types */
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -12,6 +12,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <string>
+#include <vector>
+
 #include <cpp_utils/types/cast.hpp>
 #include <cpp_utils/utils.hpp>
 
@@ -29,9 +32,19 @@ bool WildcardDdsFilterTopic::contains(
     {
         return false;
     }
-    // TODO: implement
-    static_cast<void> (other);
-    return false;
+
+    const auto& other_filter = static_cast<const WildcardDdsFilterTopic&>(other);
+
+    // A name not set matches every name
+    const std::string topic_name_pattern = this->topic_name.is_set() ? this->topic_name.get_reference() : "*";
+    const std::string type_name_pattern = this->type_name.is_set() ? this->type_name.get_reference() : "*";
+    const std::string other_topic_name_pattern =
+            other_filter.topic_name.is_set() ? other_filter.topic_name.get_reference() : "*";
+    const std::string other_type_name_pattern =
+            other_filter.type_name.is_set() ? other_filter.type_name.get_reference() : "*";
+
+    return pattern_contains_(topic_name_pattern, other_topic_name_pattern) &&
+           pattern_contains_(type_name_pattern, other_type_name_pattern);
 }
 
 bool WildcardDdsFilterTopic::matches(
@@ -87,6 +100,48 @@ bool WildcardDdsFilterTopic::matches_(
     return true;
 }
 
+bool WildcardDdsFilterTopic::pattern_contains_(
+        const std::string& pattern,
+        const std::string& other)
+{
+    // Character classes and escaped characters are not supported, so only equal patterns are contained
+    if (pattern.find_first_of("[\\") != std::string::npos || other.find_first_of("[\\") != std::string::npos)
+    {
+        return pattern == other;
+    }
+
+    // contained[i][j] <=> pattern from i contains other from j
+    // A * in pattern can consume any part of other (wildcards included), a ? any character or ? in other,
+    // and any other character only the same character.
+    std::vector<std::vector<bool>> contained(pattern.size() + 1, std::vector<bool>(other.size() + 1, false));
+    contained[pattern.size()][other.size()] = true;
+
+    for (std::size_t i = pattern.size(); i-- > 0;)
+    {
+        for (std::size_t j = other.size() + 1; j-- > 0;)
+        {
+            if (pattern[i] == '*')
+            {
+                contained[i][j] = contained[i + 1][j] || (j < other.size() && contained[i][j + 1]);
+            }
+            else if (j == other.size())
+            {
+                contained[i][j] = false;
+            }
+            else if (pattern[i] == '?')
+            {
+                contained[i][j] = other[j] != '*' && contained[i + 1][j + 1];
+            }
+            else
+            {
+                contained[i][j] = other[j] == pattern[i] && contained[i + 1][j + 1];
+            }
+        }
+    }
+
+    return contained[0][0];
+}
+
 } /* namespace types */
 } /* namespace core */
 } /* namespace ddspipe */
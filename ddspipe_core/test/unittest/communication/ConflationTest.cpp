@@ -0,0 +1,123 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/communication/dds/conflation.hpp>
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+
+using namespace eprosima::ddspipe::core;
+using namespace eprosima::ddspipe::core::types;
+
+namespace test {
+
+//! Sample of the instance \c instance (0 <=> no instance) of kind \c kind
+std::unique_ptr<IRoutingData> new_sample(
+        unsigned char instance,
+        ChangeKind kind = ChangeKind::ALIVE)
+{
+    std::unique_ptr<RtpsPayloadData> data(new RtpsPayloadData());
+
+    if (instance != 0)
+    {
+        data->instanceHandle.value[0] = instance;
+    }
+
+    data->kind = kind;
+
+    return std::unique_ptr<IRoutingData>(std::move(data));
+}
+
+//! Addresses of the samples, to check which ones are kept
+std::vector<const IRoutingData*> addresses(
+        const std::vector<std::unique_ptr<IRoutingData>>& data)
+{
+    std::vector<const IRoutingData*> result;
+
+    for (const auto& sample : data)
+    {
+        result.push_back(sample.get());
+    }
+
+    return result;
+}
+
+} // namespace test
+
+/**
+ * Test that only the latest sample of each instance is kept, in the order they were received
+ */
+TEST(ConflationTest, latest_sample_per_instance)
+{
+    std::vector<std::unique_ptr<IRoutingData>> data;
+    data.push_back(test::new_sample(1));
+    data.push_back(test::new_sample(2));
+    data.push_back(test::new_sample(1));
+    data.push_back(test::new_sample(2));
+    data.push_back(test::new_sample(1));
+
+    const auto original = test::addresses(data);
+
+    ASSERT_EQ(conflate_instances(data), 3u);
+    ASSERT_EQ(test::addresses(data), (std::vector<const IRoutingData*>{original[3], original[4]}));
+}
+
+/**
+ * Test that disposals and samples without instance are never dropped
+ */
+TEST(ConflationTest, lifecycle_samples_kept)
+{
+    std::vector<std::unique_ptr<IRoutingData>> data;
+    data.push_back(test::new_sample(1));
+    data.push_back(test::new_sample(1, ChangeKind::NOT_ALIVE_DISPOSED));
+    data.push_back(test::new_sample(0));
+    data.push_back(test::new_sample(1));
+    data.push_back(test::new_sample(0));
+
+    const auto original = test::addresses(data);
+
+    ASSERT_EQ(conflate_instances(data), 1u);
+    ASSERT_EQ(test::addresses(data),
+            (std::vector<const IRoutingData*>{original[1], original[2], original[3], original[4]}));
+}
+
+/**
+ * Test that nothing is dropped when every sample belongs to a different instance
+ */
+TEST(ConflationTest, distinct_instances_kept)
+{
+    std::vector<std::unique_ptr<IRoutingData>> data;
+
+    for (unsigned char i = 1; i <= 10; ++i)
+    {
+        data.push_back(test::new_sample(i));
+    }
+
+    const auto original = test::addresses(data);
+
+    ASSERT_EQ(conflate_instances(data), 0u);
+    ASSERT_EQ(test::addresses(data), original);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
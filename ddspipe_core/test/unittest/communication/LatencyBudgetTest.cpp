@@ -0,0 +1,108 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/communication/dds/latency_budget.hpp>
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+
+using namespace eprosima::ddspipe::core;
+using namespace eprosima::ddspipe::core::types;
+
+namespace test {
+
+//! Time used as now in every test
+const std::chrono::system_clock::time_point NOW{std::chrono::seconds(1000)};
+
+//! Latency budget used in every test
+constexpr const std::chrono::milliseconds MAX_LATENCY{100};
+
+//! Sample published \c age before \c NOW
+std::unique_ptr<IRoutingData> new_sample(
+        const std::chrono::milliseconds& age)
+{
+    const auto published = std::chrono::duration_cast<std::chrono::nanoseconds>(NOW.time_since_epoch() - age);
+
+    std::unique_ptr<RtpsPayloadData> data(new RtpsPayloadData());
+    data->source_timestamp = DataTime(
+        static_cast<int32_t>(published.count() / 1000000000),
+        static_cast<uint32_t>(published.count() % 1000000000));
+
+    return std::unique_ptr<IRoutingData>(std::move(data));
+}
+
+} // namespace test
+
+/**
+ * Test that only the samples published earlier than the budget are dropped, keeping the order of the others
+ */
+TEST(LatencyBudgetTest, stale_samples_dropped)
+{
+    std::vector<std::unique_ptr<IRoutingData>> data;
+    data.push_back(test::new_sample(std::chrono::milliseconds(500)));
+    data.push_back(test::new_sample(std::chrono::milliseconds(10)));
+    data.push_back(test::new_sample(std::chrono::milliseconds(101)));
+    data.push_back(test::new_sample(std::chrono::milliseconds(99)));
+
+    const IRoutingData* fresh_1 = data[1].get();
+    const IRoutingData* fresh_2 = data[3].get();
+
+    ASSERT_EQ(drop_stale_samples(data, test::MAX_LATENCY, test::NOW), 2u);
+    ASSERT_EQ(data.size(), 2u);
+    ASSERT_EQ(data[0].get(), fresh_1);
+    ASSERT_EQ(data[1].get(), fresh_2);
+}
+
+/**
+ * Test that the samples whose publisher did not set the source timestamp are never dropped
+ */
+TEST(LatencyBudgetTest, samples_without_timestamp_kept)
+{
+    std::vector<std::unique_ptr<IRoutingData>> data;
+    data.push_back(std::unique_ptr<IRoutingData>(new RtpsPayloadData()));
+
+    ASSERT_EQ(drop_stale_samples(data, test::MAX_LATENCY, test::NOW), 0u);
+    ASSERT_EQ(data.size(), 1u);
+}
+
+/**
+ * Test that the samples with an invalid or infinite source timestamp are never dropped
+ */
+TEST(LatencyBudgetTest, samples_with_invalid_timestamp_kept)
+{
+    std::vector<std::unique_ptr<IRoutingData>> data;
+
+    for (const auto& timestamp : {DataTime(-1, 0xffffffff), DataTime(-5, 0), DataTime(0x7fffffff, 0xffffffff)})
+    {
+        std::unique_ptr<RtpsPayloadData> sample(new RtpsPayloadData());
+        sample->source_timestamp = timestamp;
+        data.push_back(std::unique_ptr<IRoutingData>(std::move(sample)));
+    }
+
+    ASSERT_EQ(drop_stale_samples(data, test::MAX_LATENCY, test::NOW), 0u);
+    ASSERT_EQ(data.size(), 3u);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,167 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <map>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/communication/dds/RouteTable.hpp>
+
+using namespace eprosima::ddspipe::core;
+using namespace eprosima::ddspipe::core::types;
+
+namespace test {
+
+//! Index of a participant in the table, failing the test if it is not there
+std::size_t index_of(
+        const RouteTable& table,
+        const ParticipantId& id)
+{
+    std::size_t index = table.size();
+    EXPECT_TRUE(table.find_index(id, index));
+    return index;
+}
+
+//! Ids of the participants in a bitset of the table
+std::vector<ParticipantId> ids_of(
+        const RouteTable& table,
+        const ParticipantBitset& bitset)
+{
+    std::vector<ParticipantId> ids;
+
+    for (const auto index : bitset.indexes())
+    {
+        ids.push_back(table.participant_id(index));
+    }
+
+    return ids;
+}
+
+} // namespace test
+
+/**
+ * Test the set operations of ParticipantBitset, with more participants than bits in a word
+ */
+TEST(RouteTableTest, participant_bitset)
+{
+    constexpr const std::size_t SIZE = 130;
+
+    ParticipantBitset bitset(SIZE);
+    ASSERT_FALSE(bitset.any());
+
+    bitset.set(0);
+    bitset.set(63);
+    bitset.set(64);
+    bitset.set(129);
+    ASSERT_TRUE(bitset.any());
+    ASSERT_TRUE(bitset.test(63));
+    ASSERT_FALSE(bitset.test(62));
+    ASSERT_EQ(bitset.indexes(), (std::vector<std::size_t>{0, 63, 64, 129}));
+
+    ParticipantBitset other(SIZE);
+    other.set(64);
+    other.set(100);
+    ASSERT_EQ((bitset & other).indexes(), (std::vector<std::size_t>{64}));
+
+    bitset |= other;
+    ASSERT_EQ(bitset.indexes(), (std::vector<std::size_t>{0, 63, 64, 100, 129}));
+
+    bitset.reset(63);
+    bitset.reset(129);
+    ASSERT_EQ(bitset.indexes(), (std::vector<std::size_t>{0, 64, 100}));
+}
+
+/**
+ * Test that, without routes, every reader is forwarded to every other writer
+ */
+TEST(RouteTableTest, no_routes)
+{
+    RouteTable table({}, {{"A", false}, {"B", false}, {"C", false}});
+
+    ASSERT_EQ(table.size(), 3u);
+
+    const auto a = test::index_of(table, "A");
+    ASSERT_EQ(test::ids_of(table, table.writers_of(a)), (std::vector<ParticipantId>{"B", "C"}));
+    ASSERT_EQ(test::ids_of(table, table.readers_of(a)), (std::vector<ParticipantId>{"B", "C"}));
+    ASSERT_EQ(test::ids_of(table, table.routed_writers()), (std::vector<ParticipantId>{"A", "B", "C"}));
+}
+
+/**
+ * Test that the data of a repeater is also forwarded to its own writer
+ */
+TEST(RouteTableTest, repeater)
+{
+    RouteTable table({}, {{"A", true}, {"B", false}});
+
+    const auto a = test::index_of(table, "A");
+    const auto b = test::index_of(table, "B");
+
+    ASSERT_EQ(test::ids_of(table, table.writers_of(a)), (std::vector<ParticipantId>{"A", "B"}));
+    ASSERT_EQ(test::ids_of(table, table.writers_of(b)), (std::vector<ParticipantId>{"A"}));
+    ASSERT_EQ(test::ids_of(table, table.readers_of(a)), (std::vector<ParticipantId>{"A", "B"}));
+}
+
+/**
+ * Test that the readers with a route are only forwarded to the writers in it
+ */
+TEST(RouteTableTest, explicit_routes)
+{
+    RouteTable table(
+        {{"A", {"B"}}, {"B", {}}},
+        {{"A", false}, {"B", false}, {"C", false}});
+
+    const auto a = test::index_of(table, "A");
+    const auto b = test::index_of(table, "B");
+    const auto c = test::index_of(table, "C");
+
+    ASSERT_EQ(test::ids_of(table, table.writers_of(a)), (std::vector<ParticipantId>{"B"}));
+    ASSERT_FALSE(table.writers_of(b).any());
+    ASSERT_EQ(test::ids_of(table, table.writers_of(c)), (std::vector<ParticipantId>{"A", "B"}));
+
+    ASSERT_EQ(test::ids_of(table, table.readers_of(a)), (std::vector<ParticipantId>{"C"}));
+    ASSERT_EQ(test::ids_of(table, table.readers_of(b)), (std::vector<ParticipantId>{"A", "C"}));
+    ASSERT_FALSE(table.readers_of(c).any());
+
+    // Nobody forwards its data to C, so its writer is not needed
+    ASSERT_EQ(test::ids_of(table, table.routed_writers()), (std::vector<ParticipantId>{"A", "B"}));
+}
+
+/**
+ * Test that the participants of the routes that do not exist are ignored
+ */
+TEST(RouteTableTest, unknown_participants_ignored)
+{
+    RouteTable table(
+        {{"A", {"B", "X"}}, {"Y", {"A"}}},
+        {{"A", false}, {"B", false}});
+
+    ASSERT_EQ(table.size(), 2u);
+
+    std::size_t index;
+    ASSERT_FALSE(table.find_index("X", index));
+    ASSERT_FALSE(table.find_index("Y", index));
+
+    const auto a = test::index_of(table, "A");
+    ASSERT_EQ(test::ids_of(table, table.writers_of(a)), (std::vector<ParticipantId>{"B"}));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
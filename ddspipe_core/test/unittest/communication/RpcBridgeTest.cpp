@@ -0,0 +1,454 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/communication/rpc/RpcBridge.hpp>
+#include <ddspipe_core/dynamic/ParticipantsDatabase.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddspipe::core;
+using namespace eprosima::ddspipe::core::types;
+
+namespace test {
+
+//! Service of every bridge
+const RpcTopic SERVICE("service", DdsTopic(), DdsTopic());
+
+//! Participant that receives the requests
+const ParticipantHandle RECEIVER = intern_participant_id("receiver");
+
+//! Participants the requests can be forwarded to, in the order the bridge keeps them
+const ParticipantHandle SERVER_1 = intern_participant_id("server_1");
+const ParticipantHandle SERVER_2 = intern_participant_id("server_2");
+const ParticipantHandle SERVER_3 = intern_participant_id("server_3");
+
+//! Request writer of a proxy client that counts the requests written
+class MockRequestWriter : public IWriter
+{
+public:
+
+    void enable() noexcept override
+    {
+    }
+
+    void disable() noexcept override
+    {
+    }
+
+    utils::ReturnCode write(
+            IRoutingData& data) noexcept override
+    {
+        if (fail)
+        {
+            return utils::ReturnCode::RETCODE_ERROR;
+        }
+
+        // Each request written gets its own sequence number, as the RTPS writers do
+        dynamic_cast<RpcPayloadData&>(data).sent_sequence_number = SequenceNumber(0, ++written);
+
+        return utils::ReturnCode::RETCODE_OK;
+    }
+
+    void update_partitions(
+            const std::set<std::string>&) override
+    {
+    }
+
+    void update_topic_partitions(
+            const std::map<std::string, std::string>&) override
+    {
+    }
+
+    //! Whether the writes must fail
+    bool fail = false;
+
+    //! Number of requests written
+    unsigned int written = 0;
+};
+
+//! Reply reader of a proxy client, only used for its guid
+class MockReplyReader : public IReader
+{
+public:
+
+    MockReplyReader(
+            const Guid& guid)
+        : guid_(guid)
+    {
+    }
+
+    void enable() noexcept override
+    {
+    }
+
+    void disable() noexcept override
+    {
+    }
+
+    void set_on_data_available_callback(
+            std::function<void()>) noexcept override
+    {
+    }
+
+    void unset_on_data_available_callback() noexcept override
+    {
+    }
+
+    utils::ReturnCode take(
+            std::unique_ptr<IRoutingData>&) noexcept override
+    {
+        return utils::ReturnCode::RETCODE_NO_DATA;
+    }
+
+    utils::ReturnCode take_batch(
+            std::vector<std::unique_ptr<IRoutingData>>&,
+            std::size_t) noexcept override
+    {
+        return utils::ReturnCode::RETCODE_NO_DATA;
+    }
+
+    Guid guid() const override
+    {
+        return guid_;
+    }
+
+    fastdds::RecursiveTimedMutex& get_rtps_mutex() const override
+    {
+        return mutex_;
+    }
+
+    uint64_t get_unread_count() const override
+    {
+        return 0;
+    }
+
+    DdsTopic topic() const override
+    {
+        return SERVICE.reply_topic();
+    }
+
+    void update_partitions(
+            const std::set<std::string>&) override
+    {
+    }
+
+    void update_content_topic_filter(
+            const std::string&) override
+    {
+    }
+
+    ParticipantId participant_id() const override
+    {
+        return ParticipantId();
+    }
+
+protected:
+
+    const Guid guid_;
+
+    mutable fastdds::RecursiveTimedMutex mutex_;
+};
+
+//! RpcBridge whose proxy clients are mocks, so the requests can be forwarded without creating any endpoint
+class RpcBridgeTester : public RpcBridge
+{
+public:
+
+    RpcBridgeTester(
+            const RpcDispatchPolicy dispatch_policy)
+        : RpcBridge(
+            SERVICE,
+            std::make_shared<ParticipantsDatabase>(),
+            nullptr,
+            nullptr,
+            ServiceRegistry::DEFAULT_CAPACITY,
+            std::chrono::milliseconds(0),
+            dispatch_policy)
+    {
+    }
+
+    //! Add the proxy client of a participant, with servers in it or not
+    void add_proxy_client(
+            const ParticipantHandle participant,
+            const bool with_servers,
+            const bool repeater = false)
+    {
+        Guid reply_reader_guid;
+        reply_reader_guid.entityId.value[3] = static_cast<fastdds::rtps::octet>(participant);
+
+        request_writers_[participant] = std::make_shared<MockRequestWriter>();
+        reply_readers_[participant] = std::make_shared<MockReplyReader>(reply_reader_guid);
+
+        service_registries_[participant] = std::make_shared<ServiceRegistry>(
+            SERVICE,
+            interned_participant_id(participant));
+
+        service_registries_[participant]->enable();
+
+        if (with_servers)
+        {
+            current_servers_[participant].emplace(GuidPrefix());
+        }
+
+        if (repeater)
+        {
+            repeater_participants_.insert(participant);
+        }
+    }
+
+    //! Request writer of the proxy client of a participant
+    MockRequestWriter& request_writer(
+            const ParticipantHandle participant)
+    {
+        return dynamic_cast<MockRequestWriter&>(*request_writers_.at(participant));
+    }
+
+    //! Service registry of the proxy client of a participant
+    ServiceRegistry& service_registry(
+            const ParticipantHandle participant)
+    {
+        return *service_registries_.at(participant);
+    }
+
+    //! Participants a request received by \c participant_receiver is forwarded to
+    std::vector<ParticipantHandle> dispatch_targets(
+            const ParticipantHandle participant_receiver)
+    {
+        std::vector<ParticipantHandle> targets;
+        dispatch_targets_(participant_receiver, targets);
+        return targets;
+    }
+
+    //! Forward a request received by \c participant_receiver
+    void forward_request(
+            const ParticipantHandle participant_receiver)
+    {
+        RpcPayloadData request;
+        request.participant_receiver = participant_receiver;
+
+        SampleIdentity identity;
+        identity.sequence_number(SequenceNumber(0, ++requests_));
+
+        forward_request_(request, identity, targets_);
+    }
+
+protected:
+
+    //! Buffer of the targets, reused by every request as the bridge does
+    std::vector<ParticipantHandle> targets_;
+
+    //! Number of requests forwarded
+    unsigned int requests_ = 0;
+};
+
+//! Number of requests written by each server participant
+std::map<ParticipantHandle, unsigned int> written_requests(
+        RpcBridgeTester& bridge)
+{
+    return {
+        {SERVER_1, bridge.request_writer(SERVER_1).written},
+        {SERVER_2, bridge.request_writer(SERVER_2).written},
+        {SERVER_3, bridge.request_writer(SERVER_3).written}};
+}
+
+//! Add the receiver and three server participants to \c bridge
+void add_participants(
+        RpcBridgeTester& bridge)
+{
+    bridge.add_proxy_client(RECEIVER, true);
+    bridge.add_proxy_client(SERVER_1, true);
+    bridge.add_proxy_client(SERVER_2, true);
+    bridge.add_proxy_client(SERVER_3, true);
+}
+
+} // namespace test
+
+/**
+ * Test that with BROADCAST policy every request is forwarded through every other participant, and an entry is added
+ * to each of their registries
+ */
+TEST(RpcBridgeTest, broadcast)
+{
+    test::RpcBridgeTester bridge(RpcDispatchPolicy::BROADCAST);
+    test::add_participants(bridge);
+
+    bridge.forward_request(test::RECEIVER);
+    bridge.forward_request(test::RECEIVER);
+
+    ASSERT_EQ(test::written_requests(bridge), (std::map<ParticipantHandle, unsigned int>{
+        {test::SERVER_1, 2}, {test::SERVER_2, 2}, {test::SERVER_3, 2}}));
+
+    ASSERT_EQ(bridge.request_writer(test::RECEIVER).written, 0u);
+    ASSERT_EQ(bridge.service_registry(test::SERVER_1).size(), 2u);
+    ASSERT_EQ(bridge.service_registry(test::SERVER_2).size(), 2u);
+    ASSERT_EQ(bridge.service_registry(test::SERVER_3).size(), 2u);
+    ASSERT_EQ(bridge.service_registry(test::RECEIVER).size(), 0u);
+}
+
+/**
+ * Test that with FIRST_AVAILABLE policy every request is forwarded through the first participant with servers
+ */
+TEST(RpcBridgeTest, first_available)
+{
+    test::RpcBridgeTester bridge(RpcDispatchPolicy::FIRST_AVAILABLE);
+    test::add_participants(bridge);
+
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+        bridge.forward_request(test::RECEIVER);
+    }
+
+    ASSERT_EQ(test::written_requests(bridge), (std::map<ParticipantHandle, unsigned int>{
+        {test::SERVER_1, 3}, {test::SERVER_2, 0}, {test::SERVER_3, 0}}));
+
+    ASSERT_EQ(bridge.service_registry(test::SERVER_1).size(), 3u);
+}
+
+/**
+ * Test that with ROUND_ROBIN policy the requests are forwarded through each participant with servers in turns
+ */
+TEST(RpcBridgeTest, round_robin)
+{
+    test::RpcBridgeTester bridge(RpcDispatchPolicy::ROUND_ROBIN);
+    test::add_participants(bridge);
+
+    for (unsigned int i = 0; i < 6; ++i)
+    {
+        bridge.forward_request(test::RECEIVER);
+    }
+
+    ASSERT_EQ(test::written_requests(bridge), (std::map<ParticipantHandle, unsigned int>{
+        {test::SERVER_1, 2}, {test::SERVER_2, 2}, {test::SERVER_3, 2}}));
+
+    // The others are kept in order after the preferred one, to be used as fallback
+    const auto targets = bridge.dispatch_targets(test::RECEIVER);
+    ASSERT_EQ(targets.size(), 3u);
+    ASSERT_EQ(std::set<ParticipantHandle>(targets.begin(), targets.end()),
+            (std::set<ParticipantHandle>{test::SERVER_1, test::SERVER_2, test::SERVER_3}));
+}
+
+/**
+ * Test that with LEAST_OUTSTANDING policy every request is forwarded through the participant with fewer requests
+ * waiting for their reply
+ */
+TEST(RpcBridgeTest, least_outstanding)
+{
+    test::RpcBridgeTester bridge(RpcDispatchPolicy::LEAST_OUTSTANDING);
+    test::add_participants(bridge);
+
+    // Requests are never replied, so each one goes to the participant with fewer requests pending
+    for (unsigned int i = 0; i < 6; ++i)
+    {
+        bridge.forward_request(test::RECEIVER);
+    }
+
+    ASSERT_EQ(test::written_requests(bridge), (std::map<ParticipantHandle, unsigned int>{
+        {test::SERVER_1, 2}, {test::SERVER_2, 2}, {test::SERVER_3, 2}}));
+
+    // Reply the requests of one participant, so it has the fewest pending
+    bridge.service_registry(test::SERVER_2).erase(SequenceNumber(0, 1));
+    bridge.service_registry(test::SERVER_2).erase(SequenceNumber(0, 2));
+
+    bridge.forward_request(test::RECEIVER);
+    bridge.forward_request(test::RECEIVER);
+
+    ASSERT_EQ(bridge.request_writer(test::SERVER_2).written, 4u);
+    ASSERT_EQ(bridge.service_registry(test::SERVER_2).size(), 2u);
+}
+
+/**
+ * Test that a request is forwarded through the next participant when writing it in the preferred one fails, and
+ * that no entry is added to the registry of the one that failed
+ */
+TEST(RpcBridgeTest, write_failure_fallback)
+{
+    test::RpcBridgeTester bridge(RpcDispatchPolicy::FIRST_AVAILABLE);
+    test::add_participants(bridge);
+
+    bridge.request_writer(test::SERVER_1).fail = true;
+
+    bridge.forward_request(test::RECEIVER);
+
+    ASSERT_EQ(test::written_requests(bridge), (std::map<ParticipantHandle, unsigned int>{
+        {test::SERVER_1, 0}, {test::SERVER_2, 1}, {test::SERVER_3, 0}}));
+
+    ASSERT_EQ(bridge.service_registry(test::SERVER_1).size(), 0u);
+    ASSERT_EQ(bridge.service_registry(test::SERVER_2).size(), 1u);
+
+    // Once it does not fail, it is the preferred one again
+    bridge.request_writer(test::SERVER_1).fail = false;
+
+    bridge.forward_request(test::RECEIVER);
+
+    ASSERT_EQ(bridge.request_writer(test::SERVER_1).written, 1u);
+    ASSERT_EQ(bridge.request_writer(test::SERVER_2).written, 1u);
+}
+
+/**
+ * Test that participants without servers are skipped by every policy but BROADCAST, as well as the participant that
+ * received the request unless it is a repeater
+ */
+TEST(RpcBridgeTest, skip_participants_without_servers)
+{
+    for (const auto policy : {RpcDispatchPolicy::FIRST_AVAILABLE, RpcDispatchPolicy::ROUND_ROBIN,
+                              RpcDispatchPolicy::LEAST_OUTSTANDING})
+    {
+        test::RpcBridgeTester bridge(policy);
+        bridge.add_proxy_client(test::RECEIVER, true);
+        bridge.add_proxy_client(test::SERVER_1, false);
+        bridge.add_proxy_client(test::SERVER_2, true);
+        bridge.add_proxy_client(test::SERVER_3, false);
+
+        for (unsigned int i = 0; i < 4; ++i)
+        {
+            bridge.forward_request(test::RECEIVER);
+        }
+
+        ASSERT_EQ(test::written_requests(bridge), (std::map<ParticipantHandle, unsigned int>{
+            {test::SERVER_1, 0}, {test::SERVER_2, 4}, {test::SERVER_3, 0}}));
+
+        ASSERT_EQ(bridge.dispatch_targets(test::RECEIVER), std::vector<ParticipantHandle>{test::SERVER_2});
+    }
+
+    // With BROADCAST, every enabled registry is used
+    test::RpcBridgeTester bridge(RpcDispatchPolicy::BROADCAST);
+    bridge.add_proxy_client(test::RECEIVER, true);
+    bridge.add_proxy_client(test::SERVER_1, false);
+    bridge.add_proxy_client(test::SERVER_2, true);
+
+    ASSERT_EQ(bridge.dispatch_targets(test::RECEIVER),
+            (std::vector<ParticipantHandle>{test::SERVER_1, test::SERVER_2}));
+
+    // A repeater forwards the requests it receives through itself as well
+    test::RpcBridgeTester repeater_bridge(RpcDispatchPolicy::FIRST_AVAILABLE);
+    repeater_bridge.add_proxy_client(test::RECEIVER, true, true);
+
+    ASSERT_EQ(repeater_bridge.dispatch_targets(test::RECEIVER), std::vector<ParticipantHandle>{test::RECEIVER});
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,186 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/communication/rpc/ServiceRegistry.hpp>
+
+using namespace eprosima::ddspipe::core;
+using namespace eprosima::ddspipe::core::types;
+
+namespace test {
+
+//! Service of every registry
+const RpcTopic SERVICE("service", DdsTopic(), DdsTopic());
+
+//! Participant that received the requests
+const ParticipantId PARTICIPANT("participant");
+
+//! Handle of the participant that received the requests
+const ParticipantHandle PARTICIPANT_HANDLE = intern_participant_id(PARTICIPANT);
+
+//! Sequence number built from a 64 bits value
+SequenceNumber sequence_number(
+        std::uint64_t value)
+{
+    return SequenceNumber(static_cast<int32_t>(value >> 32), static_cast<uint32_t>(value));
+}
+
+//! Identity of the request with sequence number \c value
+SampleIdentity sample_identity(
+        std::uint64_t value)
+{
+    SampleIdentity identity;
+    identity.sequence_number(sequence_number(value));
+    return identity;
+}
+
+//! Add to \c registry the request with sequence number \c value
+void add_request(
+        ServiceRegistry& registry,
+        std::uint64_t value)
+{
+    registry.add(sequence_number(value), {PARTICIPANT_HANDLE, sample_identity(value)});
+}
+
+//! Whether \c registry holds the request with sequence number \c value
+bool has_request(
+        ServiceRegistry& registry,
+        std::uint64_t value)
+{
+    const auto entry = registry.get(sequence_number(value));
+    return entry.first == PARTICIPANT_HANDLE && entry.second == sample_identity(value);
+}
+
+} // namespace test
+
+/**
+ * Test that the entries added can be retrieved until they are erased
+ */
+TEST(ServiceRegistryTest, add_get_erase)
+{
+    ServiceRegistry registry(test::SERVICE, test::PARTICIPANT);
+
+    ASSERT_FALSE(test::has_request(registry, 1));
+
+    test::add_request(registry, 1);
+    test::add_request(registry, 2);
+
+    ASSERT_EQ(registry.size(), 2u);
+    ASSERT_TRUE(test::has_request(registry, 1));
+    ASSERT_TRUE(test::has_request(registry, 2));
+
+    registry.erase(test::sequence_number(1));
+
+    ASSERT_EQ(registry.size(), 1u);
+    ASSERT_FALSE(test::has_request(registry, 1));
+    ASSERT_TRUE(test::has_request(registry, 2));
+
+    // Erasing an entry not present does nothing
+    registry.erase(test::sequence_number(1));
+    ASSERT_EQ(registry.size(), 1u);
+}
+
+/**
+ * Test that erasing entries does not hide the ones sharing their probe sequence, filling the registry
+ * with sequence numbers far apart from each other
+ */
+TEST(ServiceRegistryTest, erase_keeps_other_entries)
+{
+    constexpr const unsigned int CAPACITY = 1000;
+
+    ServiceRegistry registry(test::SERVICE, test::PARTICIPANT, CAPACITY);
+
+    for (std::uint64_t i = 0; i < CAPACITY; ++i)
+    {
+        test::add_request(registry, i * 0x100000001ull);
+    }
+
+    for (std::uint64_t i = 0; i < CAPACITY; i += 2)
+    {
+        registry.erase(test::sequence_number(i * 0x100000001ull));
+    }
+
+    ASSERT_EQ(registry.size(), CAPACITY / 2);
+
+    for (std::uint64_t i = 0; i < CAPACITY; ++i)
+    {
+        ASSERT_EQ(test::has_request(registry, i * 0x100000001ull), i % 2 == 1);
+    }
+
+    ASSERT_EQ(registry.evicted_requests(), 0u);
+}
+
+/**
+ * Test that the oldest entry is evicted when adding to a full registry
+ */
+TEST(ServiceRegistryTest, oldest_evicted_when_full)
+{
+    ServiceRegistry registry(test::SERVICE, test::PARTICIPANT, 3);
+
+    for (std::uint64_t i = 1; i <= 4; ++i)
+    {
+        test::add_request(registry, i);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    ASSERT_EQ(registry.size(), 3u);
+    ASSERT_EQ(registry.evicted_requests(), 1u);
+    ASSERT_FALSE(test::has_request(registry, 1));
+    ASSERT_TRUE(test::has_request(registry, 2));
+    ASSERT_TRUE(test::has_request(registry, 3));
+    ASSERT_TRUE(test::has_request(registry, 4));
+}
+
+/**
+ * Test that the entries not replied within the timeout are removed and counted as expired
+ */
+TEST(ServiceRegistryTest, expired_requests_removed)
+{
+    ServiceRegistry registry(test::SERVICE, test::PARTICIPANT, 10, std::chrono::milliseconds(20));
+
+    test::add_request(registry, 1);
+    test::add_request(registry, 2);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    test::add_request(registry, 3);
+
+    // The expired requests are removed when adding, while the new one is kept
+    ASSERT_EQ(registry.size(), 1u);
+    ASSERT_EQ(registry.expired_requests(), 2u);
+    ASSERT_FALSE(test::has_request(registry, 1));
+    ASSERT_TRUE(test::has_request(registry, 3));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    // A reply received after the timeout is not forwarded
+    ASSERT_FALSE(test::has_request(registry, 3));
+    ASSERT_EQ(registry.expired_requests(), 3u);
+    ASSERT_EQ(registry.size(), 0u);
+    ASSERT_EQ(registry.evicted_requests(), 0u);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -12,6 +12,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <chrono>
+#include <cstdio>
+#include <string>
+
 #include <cpp_utils/testing/gtest_aux.hpp>
 #include <gtest/gtest.h>
 
@@ -19,7 +23,9 @@
 
 #include <ddspipe_core/configuration/DdsPipeConfiguration.hpp>
 #include <ddspipe_core/core/DdsPipe.hpp>
+#include <ddspipe_core/dynamic/TopologyCache.hpp>
 #include <ddspipe_core/efficiency/payload/FastPayloadPool.hpp>
+#include <ddspipe_core/testing/random_values.hpp>
 #include <ddspipe_core/types/topic/filter/WildcardDdsFilterTopic.hpp>
 
 using namespace eprosima::ddspipe::core;
@@ -28,6 +34,12 @@ namespace test {
 
 constexpr const unsigned int N_THREADS = 2;
 
+//! Number of topics discovered at once
+constexpr const unsigned int N_TOPICS = 50;
+
+//! Max time waiting for the bridges to be created
+constexpr const unsigned int MAX_WAIT_MS = 5000;
+
 struct DdsPipe : public eprosima::ddspipe::core::DdsPipe
 {
     using eprosima::ddspipe::core::DdsPipe::DdsPipe;
@@ -90,8 +102,30 @@ struct DdsPipe : public eprosima::ddspipe::core::DdsPipe
         return rpc_bridges_.find(service) != rpc_bridges_.end();
     }
 
+    bool is_bridge_pending(
+            const eprosima::utils::Heritable<types::DistributedTopic>& topic) const
+    {
+        std::lock_guard<std::mutex> _(mutex_);
+        return pending_bridges_.find(topic) != pending_bridges_.end();
+    }
+
 };
 
+types::DdsTopic new_topic(
+        unsigned int index)
+{
+    types::DdsTopic topic;
+    topic.m_topic_name = "topic" + std::to_string(index);
+    topic.type_name = "type";
+    return topic;
+}
+
+eprosima::utils::Heritable<types::DistributedTopic> new_htopic(
+        unsigned int index)
+{
+    return eprosima::utils::Heritable<types::DdsTopic>::make_heritable(new_topic(index));
+}
+
 } // test
 
 /**
@@ -393,6 +427,183 @@ TEST(DdsPipeTest, allowed_blocked_topics)
     }
 }
 
+/**
+ * Test the creation of bridges in the threads of the bridge builder
+ *
+ * STEPS:
+ * - discover several topics at once with the DdsPipe enabled
+ * - wait for their bridges to be created out of the discovery thread
+ * - verify none is pending and every bridge has its metrics
+ * - disable and enable the DdsPipe and verify the bridges are kept
+ */
+TEST(DdsPipeTest, async_bridge_creation)
+{
+    DdsPipeConfiguration ddspipe_configuration;
+    ddspipe_configuration.init_enabled = true;
+    ddspipe_configuration.bridge_builder_threads = test::N_THREADS;
+
+    auto discovery_database = std::make_shared<DiscoveryDatabase>();
+
+    test::DdsPipe ddspipe(
+        ddspipe_configuration,
+        discovery_database,
+        std::make_shared<FastPayloadPool>(),
+        std::make_shared<ParticipantsDatabase>(),
+        std::make_shared<eprosima::utils::SlotThreadPool>(test::N_THREADS)
+        );
+
+    for (unsigned int i = 0; i < test::N_TOPICS; ++i)
+    {
+        types::Endpoint endpoint;
+        endpoint.kind = types::EndpointKind::reader;
+        endpoint.topic = test::new_topic(i);
+        endpoint.guid = eprosima::ddspipe::core::testing::random_guid(i + 1);
+
+        discovery_database->add_endpoint(endpoint);
+    }
+
+    // Wait for every bridge to be created
+    for (unsigned int waited_ms = 0; waited_ms < test::MAX_WAIT_MS; waited_ms += 10)
+    {
+        if (ddspipe.bridges_metrics().size() == test::N_TOPICS)
+        {
+            break;
+        }
+
+        eprosima::utils::sleep_for(10u);
+    }
+
+    const auto metrics = ddspipe.bridges_metrics();
+    ASSERT_EQ(metrics.size(), test::N_TOPICS);
+
+    for (unsigned int i = 0; i < test::N_TOPICS; ++i)
+    {
+        const auto topic = test::new_htopic(i);
+
+        ASSERT_TRUE(ddspipe.is_topic_active(topic));
+        ASSERT_TRUE(ddspipe.is_bridge_created(topic));
+        ASSERT_FALSE(ddspipe.is_bridge_pending(topic));
+
+        // No data has been forwarded without participants
+        ASSERT_GE(metrics.at(topic).creation_latency.count(), 0);
+        ASSERT_FALSE(metrics.at(topic).forwarded);
+    }
+
+    ddspipe.disable();
+    ddspipe.enable();
+
+    for (unsigned int i = 0; i < test::N_TOPICS; ++i)
+    {
+        ASSERT_TRUE(ddspipe.is_topic_active(test::new_htopic(i)));
+        ASSERT_TRUE(ddspipe.is_bridge_created(test::new_htopic(i)));
+    }
+}
+
+/**
+ * Test that the topics discovered are stored in the topology cache and their bridges created in the next execution
+ *
+ * STEPS:
+ * - discover a topic in a DdsPipe with a topology cache and destroy it
+ * - create a new DdsPipe with the same topology cache
+ * - verify the topic and its bridge exist before it is discovered again
+ */
+TEST(DdsPipeTest, topology_cache)
+{
+    const std::string cache_file = "DdsPipeTest_topology_cache.txt";
+    std::remove(cache_file.c_str());
+
+    DdsPipeConfiguration ddspipe_configuration;
+    ddspipe_configuration.init_enabled = true;
+    ddspipe_configuration.topology_cache_file = cache_file;
+
+    const auto htopic_1 = test::new_htopic(1);
+
+    {
+        auto discovery_database = std::make_shared<DiscoveryDatabase>();
+
+        test::DdsPipe ddspipe(
+            ddspipe_configuration,
+            discovery_database,
+            std::make_shared<FastPayloadPool>(),
+            std::make_shared<ParticipantsDatabase>(),
+            std::make_shared<eprosima::utils::SlotThreadPool>(test::N_THREADS)
+            );
+
+        types::Endpoint endpoint_1;
+        endpoint_1.kind = types::EndpointKind::reader;
+        endpoint_1.topic = test::new_topic(1);
+
+        discovery_database->add_endpoint(endpoint_1);
+
+        // Wait a bit for callback to arrive
+        eprosima::utils::sleep_for(10u);
+
+        ASSERT_TRUE(ddspipe.is_bridge_created(htopic_1));
+    }
+
+    {
+        test::DdsPipe ddspipe(
+            ddspipe_configuration,
+            std::make_shared<DiscoveryDatabase>(),
+            std::make_shared<FastPayloadPool>(),
+            std::make_shared<ParticipantsDatabase>(),
+            std::make_shared<eprosima::utils::SlotThreadPool>(test::N_THREADS)
+            );
+
+        ASSERT_TRUE(ddspipe.is_topic_discovered(htopic_1));
+        ASSERT_TRUE(ddspipe.is_topic_active(htopic_1));
+        ASSERT_TRUE(ddspipe.is_bridge_created(htopic_1));
+        ASSERT_FALSE(ddspipe.is_topic_discovered(test::new_htopic(2)));
+    }
+
+    std::remove(cache_file.c_str());
+}
+
+/**
+ * Test that a topology cache naming a participant that does not exist creates the bridge of its topic
+ *
+ * STEPS:
+ * - store a topic discovered by an unknown participant in the topology cache
+ * - create a DdsPipe that removes unused entities with that topology cache
+ * - verify the topic and its bridge exist
+ */
+TEST(DdsPipeTest, topology_cache_unknown_participant)
+{
+    const std::string cache_file = "DdsPipeTest_topology_cache_unknown_participant.txt";
+    std::remove(cache_file.c_str());
+
+    auto topic_1 = test::new_topic(1);
+    topic_1.m_topic_discoverer = "unknown_participant";
+
+    TopologyCache::Topology topology;
+    topology[topic_1] = std::chrono::system_clock::now();
+
+    ASSERT_TRUE(TopologyCache(cache_file).save(topology));
+
+    DdsPipeConfiguration ddspipe_configuration;
+    ddspipe_configuration.init_enabled = true;
+    ddspipe_configuration.remove_unused_entities = true;
+    ddspipe_configuration.topology_cache_file = cache_file;
+
+    {
+        test::DdsPipe ddspipe(
+            ddspipe_configuration,
+            std::make_shared<DiscoveryDatabase>(),
+            std::make_shared<FastPayloadPool>(),
+            std::make_shared<ParticipantsDatabase>(),
+            std::make_shared<eprosima::utils::SlotThreadPool>(test::N_THREADS)
+            );
+
+        const auto htopic_1 = test::new_htopic(1);
+
+        ASSERT_TRUE(ddspipe.is_topic_discovered(htopic_1));
+        ASSERT_TRUE(ddspipe.is_topic_active(htopic_1));
+        ASSERT_TRUE(ddspipe.is_bridge_created(htopic_1));
+    }
+
+    std::remove(cache_file.c_str());
+}
+
 int main(
         int argc,
         char** argv)
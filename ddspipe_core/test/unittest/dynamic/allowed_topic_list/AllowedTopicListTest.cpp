@@ -12,6 +12,11 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
 #include <cpp_utils/testing/gtest_aux.hpp>
 #include <gtest/gtest.h>
 
@@ -112,6 +117,120 @@ void generic_test(
     }
 }
 
+/*
+ * Whether \c topic is allowed by the lists checking every filter, as the AllowedTopicList did before compiling them
+ */
+bool is_topic_allowed_linear(
+        const std::set<utils::Heritable<IFilterTopic>>& allowlist,
+        const std::set<utils::Heritable<IFilterTopic>>& blocklist,
+        const DdsTopic& topic)
+{
+    bool accepted = allowlist.empty();
+
+    for (const auto& filter : allowlist)
+    {
+        if (filter->matches(topic))
+        {
+            accepted = true;
+            break;
+        }
+    }
+
+    if (!accepted)
+    {
+        return false;
+    }
+
+    for (const auto& filter : blocklist)
+    {
+        if (filter->matches(topic))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*
+ * Filters of every kind indexed by the AllowedTopicList: literal names, literal prefixes with wildcards, and patterns
+ * starting with a wildcard
+ */
+std::vector<pair_topic_type> generate_patterns(
+        unsigned int n_patterns)
+{
+    std::vector<pair_topic_type> patterns;
+
+    for (unsigned int i = 0; i < n_patterns; ++i)
+    {
+        const std::string index = std::to_string(i);
+
+        switch (i % 4)
+        {
+            case 0:
+                patterns.push_back({"rt/topic_" + index, "*"});
+                break;
+
+            case 1:
+                patterns.push_back({"rt/topic_" + index + "*", "type_*"});
+                break;
+
+            case 2:
+                patterns.push_back({"rt/group_" + index + "/?ub", "*"});
+                break;
+
+            default:
+                patterns.push_back({"*_" + index + "/private", "type_" + index});
+                break;
+        }
+    }
+
+    return patterns;
+}
+
+/*
+ * Topics that match the patterns of \c generate_patterns and topics that do not
+ */
+std::vector<DdsTopic> generate_topics(
+        unsigned int n_topics)
+{
+    std::vector<DdsTopic> topics;
+
+    for (unsigned int i = 0; i < n_topics; ++i)
+    {
+        const std::string index = std::to_string(i);
+        DdsTopic topic;
+
+        switch (i % 5)
+        {
+            case 0:
+                topic.m_topic_name = "rt/topic_" + index;
+                break;
+
+            case 1:
+                topic.m_topic_name = "rt/topic_" + index + "/state";
+                break;
+
+            case 2:
+                topic.m_topic_name = "rt/group_" + index + "/pub";
+                break;
+
+            case 3:
+                topic.m_topic_name = "node_" + index + "/private";
+                break;
+
+            default:
+                topic.m_topic_name = "other_" + index;
+                break;
+        }
+
+        topic.type_name = "type_" + std::to_string(i % 7);
+        topics.push_back(topic);
+    }
+
+    return topics;
+}
+
 } // test
 
 /**
@@ -504,6 +623,147 @@ TEST(AllowedTopicListTest, is_topic_allowed__complex_allowlist_and_blocklist_ent
         real_topics_negative);
 }
 
+/**
+ * Test \c AllowedTopicList \c is_topic_allowed method
+ *
+ * Case checking that compiling the lists does not change the decisions, even when they are memoized
+ */
+TEST(AllowedTopicListTest, is_topic_allowed__compiled_lists)
+{
+    std::set<utils::Heritable<IFilterTopic>> allowlist;
+    std::set<utils::Heritable<IFilterTopic>> blocklist;
+
+    test::add_topics_to_list(allowlist, test::generate_patterns(200));
+    test::add_topics_to_list(blocklist, {{"rt/topic_1*", "*"}, {"*/private", "type_3"}, {"", "*"}});
+
+    AllowedTopicList atl(allowlist, blocklist);
+
+    // Check twice so the second time the decisions are memoized
+    for (unsigned int i = 0; i < 2; ++i)
+    {
+        for (const auto& topic : test::generate_topics(1000))
+        {
+            ASSERT_EQ(atl.is_topic_allowed(topic), test::is_topic_allowed_linear(allowlist, blocklist, topic));
+        }
+    }
+}
+
+/**
+ * Test \c AllowedTopicList \c is_topic_allowed method
+ *
+ * Case checking that memoized decisions are forgotten when the lists change
+ */
+TEST(AllowedTopicListTest, is_topic_allowed__reassigned_lists)
+{
+    std::set<utils::Heritable<IFilterTopic>> allowlist;
+    std::set<utils::Heritable<IFilterTopic>> blocklist;
+
+    test::add_topic_to_list(allowlist, {"topic*", "*"});
+
+    AllowedTopicList atl(allowlist, blocklist);
+
+    DdsTopic topic;
+    topic.m_topic_name = "topic1";
+    topic.type_name = "type1";
+
+    ASSERT_TRUE(atl.is_topic_allowed(topic));
+
+    // Block the topic
+    test::add_topic_to_list(blocklist, {"topic1", "*"});
+    atl = AllowedTopicList(allowlist, blocklist);
+
+    ASSERT_FALSE(atl.is_topic_allowed(topic));
+
+    // Remove every filter
+    atl.clear();
+
+    ASSERT_TRUE(atl.is_topic_allowed(topic));
+}
+
+/**
+ * Test that filters contained by other filters of the same list are removed
+ */
+TEST(AllowedTopicListTest, redundant_filters_removed)
+{
+    std::set<utils::Heritable<IFilterTopic>> allowlist;
+    std::set<utils::Heritable<IFilterTopic>> blocklist;
+    test::add_topics_to_list(allowlist, {{"rt/*", "*"}, {"rt/camera/*", "*"}, {"rt/camera/front", "sensor_msgs"}});
+    test::add_topics_to_list(blocklist, {{"rt/camera/back", "*"}, {"rt/camera/back", "sensor_msgs"}});
+
+    std::set<utils::Heritable<IFilterTopic>> expected_allowlist;
+    std::set<utils::Heritable<IFilterTopic>> expected_blocklist;
+    test::add_topics_to_list(expected_allowlist, {{"rt/*", "*"}});
+    test::add_topics_to_list(expected_blocklist, {{"rt/camera/back", "*"}});
+
+    ASSERT_EQ(AllowedTopicList(allowlist, blocklist), AllowedTopicList(expected_allowlist, expected_blocklist));
+}
+
+/**
+ * Measure the time to decide whether 10k topics are allowed by an allowlist of 2k patterns, compared with checking
+ * every filter for each topic
+ *
+ * The times are recorded as test properties, as they depend on the machine. The decisions, compiled, memoized and
+ * linear, must be the same, and the topics must be both allowed and rejected so the comparison is not trivial.
+ */
+TEST(AllowedTopicListTest, benchmark_topics_patterns)
+{
+    constexpr const unsigned int N_TOPICS = 10000;
+    constexpr const unsigned int N_PATTERNS = 2000;
+
+    std::set<utils::Heritable<IFilterTopic>> allowlist;
+    std::set<utils::Heritable<IFilterTopic>> blocklist;
+
+    test::add_topics_to_list(allowlist, test::generate_patterns(N_PATTERNS));
+
+    auto start = std::chrono::steady_clock::now();
+    AllowedTopicList atl(allowlist, blocklist);
+    auto compile_time = std::chrono::steady_clock::now() - start;
+
+    const auto topics = test::generate_topics(N_TOPICS);
+    std::vector<bool> decisions;
+    std::vector<bool> linear_decisions;
+
+    start = std::chrono::steady_clock::now();
+    for (const auto& topic : topics)
+    {
+        decisions.push_back(atl.is_topic_allowed(topic));
+    }
+    auto compiled_time = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (const auto& topic : topics)
+    {
+        linear_decisions.push_back(test::is_topic_allowed_linear(allowlist, blocklist, topic));
+    }
+    auto linear_time = std::chrono::steady_clock::now() - start;
+
+    // Decide again, now from the memoized decisions
+    std::vector<bool> memoized_decisions;
+
+    start = std::chrono::steady_clock::now();
+    for (const auto& topic : topics)
+    {
+        memoized_decisions.push_back(atl.is_topic_allowed(topic));
+    }
+    auto memoized_time = std::chrono::steady_clock::now() - start;
+
+    ASSERT_EQ(decisions, linear_decisions);
+    ASSERT_EQ(memoized_decisions, linear_decisions);
+
+    const auto n_allowed = static_cast<unsigned int>(std::count(decisions.begin(), decisions.end(), true));
+    ASSERT_GT(n_allowed, 0u);
+    ASSERT_LT(n_allowed, N_TOPICS);
+
+    ::testing::Test::RecordProperty("compile_us",
+            std::to_string(std::chrono::duration_cast<std::chrono::microseconds>(compile_time).count()));
+    ::testing::Test::RecordProperty("compiled_us",
+            std::to_string(std::chrono::duration_cast<std::chrono::microseconds>(compiled_time).count()));
+    ::testing::Test::RecordProperty("memoized_us",
+            std::to_string(std::chrono::duration_cast<std::chrono::microseconds>(memoized_time).count()));
+    ::testing::Test::RecordProperty("linear_us",
+            std::to_string(std::chrono::duration_cast<std::chrono::microseconds>(linear_time).count()));
+}
+
 int main(
         int argc,
         char** argv)
@@ -217,6 +217,83 @@ TEST(DiscoveryDatabaseTest, stop_clears_stored_endpoints)
     EXPECT_TRUE(test::get_all_endpoints(discovery_database).empty());
 }
 
+/**
+ * Test that the indexes by topic and by active endpoint follow the operations in the database
+ *
+ * STEPS:
+ * - add two active readers and one writer in the same topic and participant, and one reader in another participant
+ * - verify topic existence and active endpoint counts
+ * - erase one reader and update the other one as inactive
+ * - verify counts decrease and the topic remains while other endpoints use it
+ * - erase every endpoint left and verify the topic does not exist anymore
+ */
+TEST(DiscoveryDatabaseTest, active_endpoints_index)
+{
+    DiscoveryDatabase discovery_database;
+    discovery_database.start();
+
+    const auto topic = random_dds_topic(3);
+    const auto participant_id = random_participant_id(1);
+    const auto other_participant_id = random_participant_id(2);
+
+    auto new_endpoint = [&](
+        unsigned int seed,
+        types::EndpointKind kind,
+        const types::ParticipantId& discoverer_participant_id)
+            {
+                auto endpoint = random_endpoint(seed);
+                endpoint.guid = random_guid(seed);
+                endpoint.kind = kind;
+                endpoint.topic = topic;
+                endpoint.active = true;
+                endpoint.discoverer_participant_id = discoverer_participant_id;
+                return endpoint;
+            };
+
+    auto reader_1 = new_endpoint(21, types::EndpointKind::reader, participant_id);
+    auto reader_2 = new_endpoint(22, types::EndpointKind::reader, participant_id);
+    auto writer = new_endpoint(23, types::EndpointKind::writer, participant_id);
+    auto other_reader = new_endpoint(24, types::EndpointKind::reader, other_participant_id);
+
+    ASSERT_FALSE(discovery_database.topic_exists(topic));
+
+    discovery_database.add_endpoint(reader_1);
+    discovery_database.add_endpoint(reader_2);
+    discovery_database.add_endpoint(writer);
+    discovery_database.add_endpoint(other_reader);
+    eprosima::utils::sleep_for(test::WAIT_TIME_MS);
+
+    ASSERT_TRUE(discovery_database.topic_exists(topic));
+    ASSERT_FALSE(discovery_database.topic_exists(random_dds_topic(4)));
+    EXPECT_EQ(discovery_database.active_endpoints_count(topic, participant_id, types::EndpointKind::reader), 2u);
+    EXPECT_EQ(discovery_database.active_endpoints_count(topic, participant_id, types::EndpointKind::writer), 1u);
+    EXPECT_EQ(discovery_database.active_endpoints_count(topic, other_participant_id, types::EndpointKind::reader), 1u);
+    EXPECT_EQ(discovery_database.active_endpoints_count(topic, other_participant_id, types::EndpointKind::writer), 0u);
+    EXPECT_TRUE(discovery_database.is_endpoint_active(reader_1));
+    EXPECT_TRUE(discovery_database.is_endpoint_active(other_reader));
+
+    discovery_database.erase_endpoint(reader_1);
+    reader_2.active = false;
+    discovery_database.update_endpoint(reader_2);
+    eprosima::utils::sleep_for(test::WAIT_TIME_MS);
+
+    EXPECT_TRUE(discovery_database.topic_exists(topic));
+    EXPECT_EQ(discovery_database.active_endpoints_count(topic, participant_id, types::EndpointKind::reader), 0u);
+    EXPECT_EQ(discovery_database.active_endpoints_count(topic, participant_id, types::EndpointKind::writer), 1u);
+    EXPECT_FALSE(discovery_database.is_endpoint_active(reader_1));
+    EXPECT_FALSE(discovery_database.is_endpoint_active(reader_2));
+
+    discovery_database.erase_endpoint(writer);
+    discovery_database.erase_endpoint(other_reader);
+    eprosima::utils::sleep_for(test::WAIT_TIME_MS);
+
+    EXPECT_FALSE(discovery_database.topic_exists(topic));
+    EXPECT_EQ(discovery_database.active_endpoints_count(topic, participant_id, types::EndpointKind::writer), 0u);
+    EXPECT_EQ(discovery_database.active_endpoints_count(topic, other_participant_id, types::EndpointKind::reader), 0u);
+
+    discovery_database.stop();
+}
+
 int main(
         int argc,
         char** argv)
@@ -0,0 +1,157 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/efficiency/queue/BoundedQueue.hpp>
+
+using namespace eprosima::ddspipe::core;
+
+namespace test {
+
+constexpr const unsigned int N_THREADS = 4;
+constexpr const unsigned int N_VALUES_PER_THREAD = 100000;
+
+} // namespace test
+
+/**
+ * Test that the values are popped in the order they were pushed, also after wrapping around the ring
+ */
+TEST(BoundedQueueTest, push_pop_in_order)
+{
+    BoundedQueue<std::string> queue(4);
+    std::string value;
+
+    for (int lap = 0; lap < 3; ++lap)
+    {
+        for (int i = 0; i < 3; ++i)
+        {
+            ASSERT_TRUE(queue.try_push(std::to_string(lap * 10 + i)));
+        }
+
+        for (int i = 0; i < 3; ++i)
+        {
+            ASSERT_TRUE(queue.try_pop(value));
+            ASSERT_EQ(value, std::to_string(lap * 10 + i));
+        }
+    }
+}
+
+/**
+ * Test that pushing in a full queue and popping from an empty one fail
+ */
+TEST(BoundedQueueTest, full_and_empty)
+{
+    BoundedQueue<int> queue(2);
+    int value = 0;
+
+    ASSERT_FALSE(queue.try_pop(value));
+
+    ASSERT_TRUE(queue.try_push(1));
+    ASSERT_TRUE(queue.try_push(2));
+    ASSERT_EQ(queue.size(), 2u);
+    ASSERT_FALSE(queue.try_push(3));
+
+    ASSERT_TRUE(queue.try_pop(value));
+    ASSERT_EQ(value, 1);
+    ASSERT_TRUE(queue.try_push(3));
+
+    ASSERT_TRUE(queue.try_pop(value));
+    ASSERT_EQ(value, 2);
+    ASSERT_TRUE(queue.try_pop(value));
+    ASSERT_EQ(value, 3);
+    ASSERT_FALSE(queue.try_pop(value));
+    ASSERT_EQ(queue.size(), 0u);
+}
+
+/**
+ * Test that the capacity is rounded up to a power of two
+ */
+TEST(BoundedQueueTest, capacity_rounded_up)
+{
+    ASSERT_EQ(BoundedQueue<int>(0).capacity(), 2u);
+    ASSERT_EQ(BoundedQueue<int>(2).capacity(), 2u);
+    ASSERT_EQ(BoundedQueue<int>(5).capacity(), 8u);
+    ASSERT_EQ(BoundedQueue<int>(1024).capacity(), 1024u);
+}
+
+/**
+ * Test that every value pushed by several threads is popped exactly once by several other threads
+ */
+TEST(BoundedQueueTest, concurrent_push_pop)
+{
+    BoundedQueue<std::uint64_t> queue(64);
+
+    std::atomic<std::uint64_t> popped_count(0);
+    std::atomic<std::uint64_t> popped_sum(0);
+
+    std::vector<std::thread> threads;
+
+    for (unsigned int t = 0; t < test::N_THREADS; ++t)
+    {
+        threads.emplace_back([&queue, t]()
+                {
+                    for (std::uint64_t i = 1; i <= test::N_VALUES_PER_THREAD; ++i)
+                    {
+                        while (!queue.try_push(t * test::N_VALUES_PER_THREAD + i))
+                        {
+                            std::this_thread::yield();
+                        }
+                    }
+                });
+
+        threads.emplace_back([&queue, &popped_count, &popped_sum]()
+                {
+                    std::uint64_t value;
+
+                    while (popped_count.load() < test::N_THREADS * test::N_VALUES_PER_THREAD)
+                    {
+                        if (queue.try_pop(value))
+                        {
+                            popped_sum.fetch_add(value);
+                            popped_count.fetch_add(1);
+                        }
+                        else
+                        {
+                            std::this_thread::yield();
+                        }
+                    }
+                });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    const std::uint64_t n = test::N_THREADS * test::N_VALUES_PER_THREAD;
+
+    ASSERT_EQ(popped_count.load(), n);
+    ASSERT_EQ(popped_sum.load(), n * (n + 1) / 2);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,213 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/efficiency/data/DataBlockPool.hpp>
+#include <ddspipe_core/interface/IRoutingData.hpp>
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+
+using namespace eprosima::ddspipe::core;
+
+namespace test {
+
+constexpr const std::size_t BLOCK_SIZE = 64;
+
+} // namespace test
+
+/**
+ * Test that a released block is reused by the next allocation
+ */
+TEST(DataBlockPoolTest, recycle_block)
+{
+    DataBlockPool pool(test::BLOCK_SIZE);
+
+    void* block = pool.allocate(test::BLOCK_SIZE);
+    ASSERT_NE(block, nullptr);
+    ASSERT_EQ(pool.free_blocks(), 0u);
+
+    pool.deallocate(block, test::BLOCK_SIZE);
+    ASSERT_EQ(pool.free_blocks(), 1u);
+
+    // Smaller sizes also use the blocks of the pool
+    void* reused_block = pool.allocate(test::BLOCK_SIZE / 2);
+    ASSERT_EQ(reused_block, block);
+    ASSERT_EQ(pool.free_blocks(), 0u);
+
+    pool.deallocate(reused_block, test::BLOCK_SIZE / 2);
+    ASSERT_EQ(pool.free_blocks(), 1u);
+}
+
+/**
+ * Test that blocks bigger than the block size of the pool are not kept
+ */
+TEST(DataBlockPoolTest, bigger_block_not_recycled)
+{
+    DataBlockPool pool(test::BLOCK_SIZE);
+
+    void* block = pool.allocate(test::BLOCK_SIZE * 2);
+    ASSERT_NE(block, nullptr);
+
+    pool.deallocate(block, test::BLOCK_SIZE * 2);
+    ASSERT_EQ(pool.free_blocks(), 0u);
+}
+
+/**
+ * Test that the pool does not keep more than max_free_blocks blocks
+ */
+TEST(DataBlockPoolTest, max_free_blocks)
+{
+    constexpr const std::size_t MAX_FREE_BLOCKS = 4;
+    DataBlockPool pool(test::BLOCK_SIZE, MAX_FREE_BLOCKS);
+
+    std::vector<void*> blocks;
+    for (std::size_t i = 0; i < MAX_FREE_BLOCKS * 2; ++i)
+    {
+        blocks.push_back(pool.allocate(test::BLOCK_SIZE));
+    }
+
+    for (auto* block : blocks)
+    {
+        pool.deallocate(block, test::BLOCK_SIZE);
+    }
+
+    ASSERT_EQ(pool.free_blocks(), MAX_FREE_BLOCKS);
+}
+
+/**
+ * Test that blocks can be allocated in some threads and released in others, as readers and Tracks do
+ */
+TEST(DataBlockPoolTest, concurrent_allocate_deallocate)
+{
+    constexpr const unsigned int N_THREADS = 8;
+    constexpr const unsigned int N_BLOCKS = 1000;
+
+    DataBlockPool pool(test::BLOCK_SIZE);
+
+    std::vector<std::vector<void*>> blocks(N_THREADS);
+    std::vector<std::thread> threads;
+
+    // Allocate in every thread
+    for (unsigned int i = 0; i < N_THREADS; ++i)
+    {
+        threads.emplace_back(
+            [&pool, &blocks, i]()
+            {
+                for (unsigned int j = 0; j < N_BLOCKS; ++j)
+                {
+                    blocks[i].push_back(pool.allocate(test::BLOCK_SIZE));
+                }
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    threads.clear();
+
+    // Release in a different thread than the one that allocated them
+    for (unsigned int i = 0; i < N_THREADS; ++i)
+    {
+        threads.emplace_back(
+            [&pool, &blocks, i]()
+            {
+                for (auto* block : blocks[(i + 1) % N_THREADS])
+                {
+                    pool.deallocate(block, test::BLOCK_SIZE);
+                }
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(pool.free_blocks(), std::min<std::size_t>(N_THREADS * N_BLOCKS, DataBlockPool::DEFAULT_MAX_FREE_BLOCKS));
+}
+
+/**
+ * Test that blocks released in a thread are reused by the allocations of another one through the depot
+ */
+TEST(DataBlockPoolTest, recycle_block_other_thread)
+{
+    constexpr const std::size_t N_BLOCKS = DataBlockPool::SHARD_CAPACITY * 10;
+
+    DataBlockPool pool(test::BLOCK_SIZE);
+
+    std::vector<void*> blocks;
+    for (std::size_t i = 0; i < N_BLOCKS; ++i)
+    {
+        blocks.push_back(pool.allocate(test::BLOCK_SIZE));
+    }
+
+    std::thread releaser(
+        [&pool, &blocks]()
+        {
+            for (auto* block : blocks)
+            {
+                pool.deallocate(block, test::BLOCK_SIZE);
+            }
+        });
+    releaser.join();
+
+    ASSERT_EQ(pool.free_blocks(), N_BLOCKS);
+
+    // Only the blocks that stay in the shard of the other thread are not reachable from this one
+    for (std::size_t i = 0; i < N_BLOCKS; ++i)
+    {
+        blocks[i] = pool.allocate(test::BLOCK_SIZE);
+    }
+
+    ASSERT_LE(pool.free_blocks(), DataBlockPool::SHARD_CAPACITY);
+
+    for (auto* block : blocks)
+    {
+        pool.deallocate(block, test::BLOCK_SIZE);
+    }
+}
+
+/**
+ * Test that the memory of routing data destroyed through an IRoutingData unique_ptr is reused by the next data
+ */
+TEST(DataBlockPoolTest, recycle_routing_data)
+{
+    auto& pool = types::RtpsPayloadData::block_pool();
+
+    std::unique_ptr<IRoutingData> data(new types::RtpsPayloadData());
+    const void* address = data.get();
+    const std::size_t free_blocks = pool.free_blocks();
+
+    data.reset();
+    ASSERT_EQ(pool.free_blocks(), free_blocks + 1);
+
+    data.reset(new types::RtpsPayloadData());
+    ASSERT_EQ(static_cast<const void*>(data.get()), address);
+    ASSERT_EQ(pool.free_blocks(), free_blocks);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
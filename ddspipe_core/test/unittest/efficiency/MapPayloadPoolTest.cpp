@@ -12,6 +12,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <mutex>
+#include <vector>
+
 #include <cpp_utils/testing/gtest_aux.hpp>
 #include <gtest/gtest.h>
 
@@ -22,6 +25,7 @@
 
 #include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
 #include <ddspipe_core/efficiency/payload/MapPayloadPool.hpp>
+#include <ddspipe_core/efficiency/payload/ShardedPayloadPool.hpp>
 
 using namespace eprosima::ddspipe;
 using namespace eprosima::ddspipe::core;
@@ -67,11 +71,67 @@ public:
 
 };
 
+/**
+ * @brief Mock over ShardedPayloadPool implementing public access to private variables.
+ *
+ */
+class MockShardedPayloadPool : public ShardedPayloadPool
+{
+public:
+
+    using ShardedPayloadPool::ShardedPayloadPool;
+
+    uint64_t pointers_stored()
+    {
+        uint64_t stored = 0;
+
+        for (auto& shard : shards_)
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            stored += shard.size;
+        }
+
+        return stored;
+    }
+
+    uint64_t reference_count(
+            const Payload& payload)
+    {
+        auto& shard = shard_(payload.data);
+
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto entry = find_nts_(shard, payload.data);
+
+        return entry == nullptr ? 0 : entry->references;
+    }
+
+    void clean_all(
+            std::vector<Payload>& payloads)
+    {
+        for (Payload& payload : payloads)
+        {
+            release_payload(payload);
+        }
+    }
+
+};
+
 } /* namespace test */
 } /* namespace core */
 } /* namespace ddspipe */
 } /* namespace eprosima */
 
+/**
+ * Every pool that keeps a reference counter for each data reserved must pass these tests.
+ */
+template <typename Pool>
+class MapPayloadPoolTest : public ::testing::Test
+{
+};
+
+using MapPayloadPoolTypes = ::testing::Types<test::MockMapPayloadPool, test::MockShardedPayloadPool>;
+TYPED_TEST_SUITE(MapPayloadPoolTest, MapPayloadPoolTypes);
+
 /*
  * This tests does not check the methods calling cacheChange, this is tested in generic PayloadPool test.
  */
@@ -83,11 +143,11 @@ public:
  *  Get N different pointers
  *  fail reserve memory
  */
-TEST(MapPayloadPoolTest, get_payload)
+TYPED_TEST(MapPayloadPoolTest, get_payload)
 {
     // Get N different pointers
     {
-        test::MockMapPayloadPool pool;
+        TypeParam pool;
         std::vector<Payload> payloads(TEST_NUMBER);
 
         for (unsigned int i = 0; i < TEST_NUMBER; i++)
@@ -109,7 +169,7 @@ TEST(MapPayloadPoolTest, get_payload)
 
     // fail reserve memory
     {
-        test::MockMapPayloadPool pool;
+        TypeParam pool;
         Payload payload;
 
         ASSERT_FALSE(pool.get_payload(0, payload));
@@ -133,10 +193,10 @@ TEST(MapPayloadPoolTest, get_payload)
  *  get payload5 from src payload4
  *  release all
  */
-TEST(MapPayloadPoolTest, get_payload_from_src)
+TYPED_TEST(MapPayloadPoolTest, get_payload_from_src)
 {
-    eprosima::fastdds::rtps::IPayloadPool* pool = new test::MockMapPayloadPool();
-    test::MockMapPayloadPool* pool_ = static_cast<test::MockMapPayloadPool*>(pool);
+    eprosima::fastdds::rtps::IPayloadPool* pool = new TypeParam();
+    TypeParam* pool_ = static_cast<TypeParam*>(pool);
 
     Payload payload0;
     Payload payload1;
@@ -213,14 +273,14 @@ TEST(MapPayloadPoolTest, get_payload_from_src)
  *  release payload aux from pool aux
  *  release payload
  */
-TEST(MapPayloadPoolTest, get_payload_from_src_no_owner)
+TYPED_TEST(MapPayloadPoolTest, get_payload_from_src_no_owner)
 {
     // Each pool has a IPayloadPool and a MockMapPayloadPool so it can be called to get_payload from source
     // and specific methods from mock
-    eprosima::fastdds::rtps::IPayloadPool* pool = new test::MockMapPayloadPool(); // Requires to be ptr to pass it to get_payload
-    test::MockMapPayloadPool* pool_ = static_cast<test::MockMapPayloadPool*>(pool);
-    eprosima::fastdds::rtps::IPayloadPool* pool_aux = new test::MockMapPayloadPool(); // Requires to be ptr to pass it to get_payload
-    test::MockMapPayloadPool* pool_aux_ = static_cast<test::MockMapPayloadPool*>(pool_aux);
+    eprosima::fastdds::rtps::IPayloadPool* pool = new TypeParam(); // Requires to be ptr to pass it to get_payload
+    TypeParam* pool_ = static_cast<TypeParam*>(pool);
+    eprosima::fastdds::rtps::IPayloadPool* pool_aux = new TypeParam(); // Requires to be ptr to pass it to get_payload
+    TypeParam* pool_aux_ = static_cast<TypeParam*>(pool_aux);
 
     Payload payload_src;
     Payload payload_target;
@@ -253,12 +313,12 @@ TEST(MapPayloadPoolTest, get_payload_from_src_no_owner)
  * CASES:
  *  Source has size 0 and different owner
  */
-TEST(MapPayloadPoolTest, get_payload_from_src_negative)
+TYPED_TEST(MapPayloadPoolTest, get_payload_from_src_negative)
 {
     // Source has size 0 and different owner
     {
-        eprosima::fastdds::rtps::IPayloadPool* pool = new test::MockMapPayloadPool(); // Requires to be ptr to pass it to get_payload
-        test::MockMapPayloadPool* pool_ = static_cast<test::MockMapPayloadPool*>(pool);
+        eprosima::fastdds::rtps::IPayloadPool* pool = new TypeParam(); // Requires to be ptr to pass it to get_payload
+        TypeParam* pool_ = static_cast<TypeParam*>(pool);
 
         Payload payload_src;
         Payload payload_target;
@@ -286,10 +346,10 @@ TEST(MapPayloadPoolTest, get_payload_from_src_negative)
  *  get N-2 more payloads from first
  *  release N payloads
  */
-TEST(MapPayloadPoolTest, release_payload)
+TYPED_TEST(MapPayloadPoolTest, release_payload)
 {
-    eprosima::fastdds::rtps::IPayloadPool* pool = new test::MockMapPayloadPool(); // Requires to be ptr to pass it to get_payload
-    test::MockMapPayloadPool* pool_ = static_cast<test::MockMapPayloadPool*>(pool);
+    eprosima::fastdds::rtps::IPayloadPool* pool = new TypeParam(); // Requires to be ptr to pass it to get_payload
+    TypeParam* pool_ = static_cast<TypeParam*>(pool);
     std::vector<Payload> payloads(TEST_NUMBER);
 
     // get first payload
@@ -336,13 +396,13 @@ TEST(MapPayloadPoolTest, release_payload)
 /**
  * Check release a payload that has been get from a different payload pool
  */
-TEST(MapPayloadPoolTest, release_payload_negative)
+TYPED_TEST(MapPayloadPoolTest, release_payload_negative)
 {
     // 1 log error expected
     INSTANTIATE_LOG_TESTER(eprosima::utils::Log::Kind::Error, 1, 1);
 
-    test::MockMapPayloadPool pool;
-    test::MockMapPayloadPool pool_aux;
+    TypeParam pool;
+    TypeParam pool_aux;
     Payload payload;
 
     pool_aux.get_payload(DEFAULT_SIZE, payload);
@@ -0,0 +1,212 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <fastdds/rtps/common/CacheChange.hpp>
+
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+#include <ddspipe_core/efficiency/payload/MapPayloadPool.hpp>
+#include <ddspipe_core/efficiency/payload/ShardedPayloadPool.hpp>
+
+using namespace eprosima::ddspipe;
+using namespace eprosima::ddspipe::core;
+using namespace eprosima::ddspipe::core::types;
+
+const constexpr size_t DEFAULT_SIZE = sizeof(PayloadUnit);
+
+const constexpr unsigned int CONTENTION_THREADS = 16;
+const constexpr unsigned int CONTENTION_ITERATIONS = 20000;
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+namespace test {
+
+/**
+ * @brief Mock over ShardedPayloadPool implementing public access to private variables.
+ *
+ */
+class MockShardedPayloadPool : public ShardedPayloadPool
+{
+public:
+
+    using ShardedPayloadPool::ShardedPayloadPool;
+
+    uint64_t pointers_stored()
+    {
+        uint64_t stored = 0;
+
+        for (auto& shard : shards_)
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            stored += shard.size;
+        }
+
+        return stored;
+    }
+
+    uint64_t reference_count(
+            const Payload& payload)
+    {
+        auto& shard = shard_(payload.data);
+
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto entry = find_nts_(shard, payload.data);
+
+        return entry == nullptr ? 0 : entry->references;
+    }
+
+    void clean_all(
+            std::vector<Payload>& payloads)
+    {
+        for (Payload& payload : payloads)
+        {
+            release_payload(payload);
+        }
+    }
+
+};
+
+//! Get payloads, share them and release them \c iterations times
+void reserve_share_release(
+        PayloadPool& pool,
+        unsigned int iterations)
+{
+    for (unsigned int i = 0; i < iterations; i++)
+    {
+        Payload payload;
+        Payload shared_payload;
+
+        ASSERT_TRUE(pool.get_payload(DEFAULT_SIZE, payload));
+        ASSERT_TRUE(pool.get_payload(payload, shared_payload));
+
+        ASSERT_TRUE(pool.release_payload(payload));
+        ASSERT_TRUE(pool.release_payload(shared_payload));
+    }
+}
+
+//! Run \c reserve_share_release in \c pool from \c CONTENTION_THREADS threads and return the time it took
+std::chrono::microseconds contention_benchmark(
+        PayloadPool& pool)
+{
+    std::vector<std::thread> threads;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (unsigned int i = 0; i < CONTENTION_THREADS; i++)
+    {
+        threads.emplace_back(reserve_share_release, std::ref(pool), CONTENTION_ITERATIONS);
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_TRUE(pool.is_clean());
+
+    return std::chrono::duration_cast<std::chrono::microseconds>(elapsed);
+}
+
+} /* namespace test */
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
+
+/**
+ * Get payloads in a pool big enough for its shards to grow, and release them in a different order.
+ */
+TEST(ShardedPayloadPoolTest, grow_and_release_unordered)
+{
+    test::MockShardedPayloadPool pool;
+    std::vector<Payload> payloads(ShardedPayloadPool::N_SHARDS * ShardedPayloadPool::INITIAL_SHARD_SLOTS * 4);
+
+    for (unsigned int i = 0; i < payloads.size(); i++)
+    {
+        ASSERT_TRUE(pool.get_payload(DEFAULT_SIZE, payloads[i]));
+        ASSERT_EQ(pool.pointers_stored(), i + 1u);
+    }
+
+    // Release the even payloads first, so the clusters of the tables are broken
+    for (unsigned int i = 0; i < payloads.size(); i += 2)
+    {
+        ASSERT_TRUE(pool.release_payload(payloads[i]));
+    }
+
+    // The odd payloads must still be found
+    for (unsigned int i = 1; i < payloads.size(); i += 2)
+    {
+        ASSERT_EQ(pool.reference_count(payloads[i]), 1u) << i;
+    }
+
+    for (unsigned int i = 1; i < payloads.size(); i += 2)
+    {
+        ASSERT_TRUE(pool.release_payload(payloads[i]));
+    }
+
+    ASSERT_TRUE(pool.is_clean());
+    ASSERT_EQ(pool.pointers_stored(), 0u);
+}
+
+/**
+ * Get, share and release payloads from \c CONTENTION_THREADS threads at the same time.
+ */
+TEST(ShardedPayloadPoolTest, concurrent_reserve_share_release)
+{
+    test::MockShardedPayloadPool pool;
+
+    test::contention_benchmark(pool);
+
+    ASSERT_TRUE(pool.is_clean());
+    ASSERT_EQ(pool.pointers_stored(), 0u);
+}
+
+/**
+ * Run the same workload from \c CONTENTION_THREADS threads in a \c MapPayloadPool and in a \c ShardedPayloadPool ,
+ * and report the time each of them took.
+ *
+ * The times are recorded as test properties, so they appear in the test report. Only the correctness of each pool is
+ * checked, as times depend on the machine: every payload reserved must have been released.
+ */
+TEST(ShardedPayloadPoolTest, benchmark_contention)
+{
+    MapPayloadPool map_pool;
+    test::MockShardedPayloadPool sharded_pool;
+
+    ::testing::Test::RecordProperty("map_pool_us", std::to_string(test::contention_benchmark(map_pool).count()));
+    ASSERT_TRUE(map_pool.is_clean());
+
+    ::testing::Test::RecordProperty("sharded_pool_us",
+            std::to_string(test::contention_benchmark(sharded_pool).count()));
+    ASSERT_TRUE(sharded_pool.is_clean());
+    ASSERT_EQ(sharded_pool.pointers_stored(), 0u);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
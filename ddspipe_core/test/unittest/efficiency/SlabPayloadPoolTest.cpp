@@ -0,0 +1,496 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <fastdds/rtps/common/CacheChange.hpp>
+
+#include <ddspipe_core/efficiency/payload/CopyPayloadPool.hpp>
+#include <ddspipe_core/efficiency/payload/FastPayloadPool.hpp>
+#include <ddspipe_core/efficiency/payload/MapPayloadPool.hpp>
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+#include <ddspipe_core/efficiency/payload/SlabPayloadPool.hpp>
+
+using namespace eprosima::ddspipe;
+using namespace eprosima::ddspipe::core;
+using namespace eprosima::ddspipe::core::types;
+
+const constexpr unsigned int TEST_NUMBER = 5;
+const constexpr size_t DEFAULT_SIZE = sizeof(PayloadUnit);
+
+const constexpr unsigned int STRESS_THREADS = 8;
+const constexpr unsigned int STRESS_ITERATIONS = 2000;
+const constexpr unsigned int BENCHMARK_ITERATIONS = 20000;
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+namespace test {
+
+/**
+ * @brief Mock over SlabPayloadPool implementing public access to private variables.
+ *
+ */
+class MockSlabPayloadPool : public SlabPayloadPool
+{
+public:
+
+    using SlabPayloadPool::SlabPayloadPool;
+
+    uint64_t pointers_stored()
+    {
+        return reserve_count_ - release_count_;
+    }
+
+    void release_all(
+            std::vector<Payload>& payloads)
+    {
+        for (auto& payload : payloads)
+        {
+            release_payload(payload);
+        }
+    }
+
+};
+
+void release(
+        SlabPayloadPool& pool,
+        Payload& payload)
+{
+    ASSERT_TRUE(pool.release_payload(payload));
+}
+
+/**
+ * Reserve payloads of different sizes, share them as a Track does with its writers and release them.
+ *
+ * The payloads of each iteration are released in a different order than reserved, so blocks are not always reused in
+ * the same order.
+ */
+void reserve_share_release(
+        PayloadPool& pool,
+        unsigned int iterations)
+{
+    const std::vector<uint32_t> sizes = {16, 100, 500, 1000, 4000, 10000, 60000};
+
+    for (unsigned int i = 0; i < iterations; i++)
+    {
+        Payload payload;
+        Payload shared_payload_1;
+        Payload shared_payload_2;
+
+        ASSERT_TRUE(pool.get_payload(sizes[i % sizes.size()], payload));
+        std::memset(payload.data, 0, payload.max_size);
+        payload.length = payload.max_size;
+        ASSERT_TRUE(pool.get_payload(payload, shared_payload_1));
+        ASSERT_TRUE(pool.get_payload(payload, shared_payload_2));
+
+        ASSERT_TRUE(pool.release_payload(shared_payload_1));
+        ASSERT_TRUE(pool.release_payload(payload));
+        ASSERT_TRUE(pool.release_payload(shared_payload_2));
+    }
+}
+
+//! Run \c reserve_share_release in \c pool , check it is clean afterwards, and return the time it took
+std::chrono::microseconds benchmark(
+        PayloadPool& pool)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    reserve_share_release(pool, BENCHMARK_ITERATIONS);
+
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_TRUE(pool.is_clean());
+
+    return std::chrono::duration_cast<std::chrono::microseconds>(elapsed);
+}
+
+} /* namespace test */
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
+
+/*
+ * This tests does not check the methods calling cacheChange, this is tested in generic PayloadPool test.
+ * Reference counting is inherited from FastPayloadPool, so only the cases that involve reserve and release are tested.
+ */
+
+/**
+ * Test get_payload method for new changes
+ *
+ * CASES:
+ *  Get N different pointers
+ *  fail reserve memory
+ */
+TEST(SlabPayloadPoolTest, get_payload)
+{
+    // Get N different pointers
+    {
+        test::MockSlabPayloadPool pool;
+        std::vector<Payload> payloads(TEST_NUMBER);
+
+        for (unsigned int i = 0; i < TEST_NUMBER; i++)
+        {
+            pool.get_payload(DEFAULT_SIZE, payloads[i]);
+
+            ASSERT_EQ(payloads[i].max_size, DEFAULT_SIZE);
+            ASSERT_EQ(pool.pointers_stored(), i + 1);
+
+            for (unsigned int j = 0; j < i; j++)
+            {
+                ASSERT_NE(payloads[i].data, payloads[j].data);
+            }
+        }
+
+        // END : Clean all remaining payloads
+        pool.release_all(payloads);
+        ASSERT_TRUE(pool.is_clean());
+    }
+
+    // fail reserve memory
+    {
+        test::MockSlabPayloadPool pool;
+        Payload payload;
+
+        ASSERT_FALSE(pool.get_payload(0, payload));
+    }
+}
+
+/**
+ * Check to get_payload from a source that has been created in same pool increase references.
+ *
+ * STEPS:
+ *  get payload0
+ *  get payload1 from src payload0
+ *  release payload0
+ *  get payload2 (block of payload0 is still in use)
+ *  release all
+ */
+TEST(SlabPayloadPoolTest, get_payload_from_src)
+{
+    eprosima::fastdds::rtps::IPayloadPool* pool = new test::MockSlabPayloadPool(); // Requires to be ptr to pass it to get_payload
+    test::MockSlabPayloadPool* pool_ = static_cast<test::MockSlabPayloadPool*>(pool);
+
+    Payload payload0;
+    Payload payload1;
+    Payload payload2;
+
+    // get payload0
+    ASSERT_TRUE(pool_->get_payload(DEFAULT_SIZE, payload0));
+    ASSERT_EQ(pool_->pointers_stored(), 1u);
+
+    // get payload1 from src payload0
+    ASSERT_TRUE(pool_->get_payload(payload0, payload1));
+    ASSERT_EQ(pool_->pointers_stored(), 1u);
+    ASSERT_EQ(payload1.max_size, payload0.max_size);
+    ASSERT_EQ(payload1.data, payload0.data);
+
+    // release payload0
+    ASSERT_TRUE(pool_->release_payload(payload0));
+    ASSERT_EQ(pool_->pointers_stored(), 1u);
+    ASSERT_EQ(pool_->retained_memory(), 0u);
+
+    // get payload2 (block of payload0 is still in use)
+    ASSERT_TRUE(pool_->get_payload(DEFAULT_SIZE, payload2));
+    ASSERT_EQ(pool_->pointers_stored(), 2u);
+    ASSERT_NE(payload2.data, payload1.data);
+
+    // release all
+    ASSERT_TRUE(pool_->release_payload(payload1));
+    ASSERT_TRUE(pool_->release_payload(payload2));
+
+    // Check payload pool is empty
+    ASSERT_TRUE(pool_->is_clean());
+    ASSERT_EQ(pool_->pointers_stored(), 0u);
+
+    delete pool;
+}
+
+/**
+ * Check to get_payload from a source that has been created in a different pool
+ *
+ * STEPS:
+ *  get payload aux from a FastPayloadPool
+ *  get payload from src payload aux
+ *  release payload aux from pool aux
+ *  release payload
+ */
+TEST(SlabPayloadPoolTest, get_payload_from_src_no_owner)
+{
+    eprosima::fastdds::rtps::IPayloadPool* pool = new test::MockSlabPayloadPool(); // Requires to be ptr to pass it to get_payload
+    test::MockSlabPayloadPool* pool_ = static_cast<test::MockSlabPayloadPool*>(pool);
+    FastPayloadPool pool_aux;
+
+    Payload payload_src;
+    Payload payload_target;
+
+    // get payload aux from pool aux
+    pool_aux.get_payload(DEFAULT_SIZE, payload_src);
+    payload_src.length = DEFAULT_SIZE;
+
+    // get payload from src payload aux
+    ASSERT_TRUE(pool_->get_payload(payload_src, payload_target));
+    ASSERT_EQ(pool_->pointers_stored(), 1u);
+    ASSERT_NE(payload_target.data, payload_src.data);
+
+    // release payload aux from pool aux
+    pool_aux.release_payload(payload_src);
+    ASSERT_TRUE(pool_aux.is_clean());
+    ASSERT_EQ(pool_->pointers_stored(), 1u);
+
+    // release payload
+    pool_->release_payload(payload_target);
+    ASSERT_EQ(pool_->pointers_stored(), 0u);
+
+    delete pool;
+}
+
+/**
+ * Get some payloads from pool from src and release each of them separatly checking reference count
+ *
+ * STEPS:
+ *  get first payload
+ *  get N-1 payloads from first
+ *  release N-1 payloads
+ *  release first payload
+ */
+TEST(SlabPayloadPoolTest, release_payload)
+{
+    eprosima::fastdds::rtps::IPayloadPool* pool = new test::MockSlabPayloadPool(); // Requires to be ptr to pass it to get_payload
+    test::MockSlabPayloadPool* pool_ = static_cast<test::MockSlabPayloadPool*>(pool);
+    std::vector<Payload> payloads(TEST_NUMBER);
+
+    // get first payload
+    pool_->get_payload(DEFAULT_SIZE, payloads[0]);
+
+    // get N-1 payloads from first
+    for (unsigned int i = 1; i < TEST_NUMBER; i++)
+    {
+        pool_->get_payload(payloads[0], payloads[i]);
+    }
+
+    // release N-1 payloads
+    for (unsigned int i = 1; i < TEST_NUMBER; i++)
+    {
+        ASSERT_TRUE(pool_->release_payload(payloads[i]));
+        ASSERT_EQ(pool_->pointers_stored(), 1u);
+        ASSERT_EQ(pool_->retained_memory(), 0u);
+    }
+
+    // release first payload
+    ASSERT_TRUE(pool_->release_payload(payloads[0]));
+    ASSERT_EQ(pool_->pointers_stored(), 0u);
+    ASSERT_GT(pool_->retained_memory(), 0u);
+
+    // Check payload pool is empty
+    ASSERT_TRUE(pool_->is_clean());
+
+    delete pool;
+}
+
+/**
+ * Check that the block of a released payload is reused by the next payload of the same size class
+ *
+ * STEPS:
+ *  get and release payload
+ *  get payload of same size class: same block
+ *  get payload of different size class: different block
+ *  release all: both blocks retained
+ */
+TEST(SlabPayloadPoolTest, recycle_payload)
+{
+    test::MockSlabPayloadPool pool;
+
+    Payload payload0;
+    Payload payload1;
+    Payload payload2;
+
+    // get and release payload
+    ASSERT_TRUE(pool.get_payload(100, payload0));
+    auto* data = payload0.data;
+    ASSERT_TRUE(pool.release_payload(payload0));
+    ASSERT_EQ(pool.retained_memory(), 128u);
+
+    // get payload of same size class: same block
+    ASSERT_TRUE(pool.get_payload(120, payload1));
+    ASSERT_EQ(payload1.data, data);
+    ASSERT_EQ(payload1.max_size, 120u);
+    ASSERT_EQ(pool.retained_memory(), 0u);
+
+    // get payload of different size class: different block
+    ASSERT_TRUE(pool.get_payload(1000, payload2));
+    ASSERT_NE(payload2.data, data);
+
+    // release all: both blocks retained
+    ASSERT_TRUE(pool.release_payload(payload1));
+    ASSERT_TRUE(pool.release_payload(payload2));
+    ASSERT_EQ(pool.retained_memory(), 128u + 1024u);
+
+    ASSERT_TRUE(pool.is_clean());
+}
+
+/**
+ * Check that the memory retained never exceeds the max retained memory
+ *
+ * CASES:
+ *  No memory retained
+ *  Memory retained till the limit
+ *  Payload bigger than the biggest size class
+ */
+TEST(SlabPayloadPoolTest, retained_memory_limit)
+{
+    // No memory retained
+    {
+        test::MockSlabPayloadPool pool(0);
+        Payload payload;
+
+        ASSERT_TRUE(pool.get_payload(DEFAULT_SIZE, payload));
+        ASSERT_TRUE(pool.release_payload(payload));
+        ASSERT_EQ(pool.retained_memory(), 0u);
+        ASSERT_TRUE(pool.is_clean());
+    }
+
+    // Memory retained till the limit
+    {
+        // Room for 2 blocks of 1 KiB
+        test::MockSlabPayloadPool pool(2048);
+        std::vector<Payload> payloads(TEST_NUMBER);
+
+        for (auto& payload : payloads)
+        {
+            ASSERT_TRUE(pool.get_payload(1000, payload));
+        }
+
+        pool.release_all(payloads);
+        ASSERT_EQ(pool.retained_memory(), 2048u);
+        ASSERT_TRUE(pool.is_clean());
+    }
+
+    // Payload bigger than the biggest size class
+    {
+        test::MockSlabPayloadPool pool;
+        Payload payload;
+
+        const uint32_t size = (1u << SlabPayloadPool::MAX_SIZE_CLASS_BITS) + 1;
+
+        ASSERT_TRUE(pool.get_payload(size, payload));
+        ASSERT_EQ(payload.max_size, size);
+        ASSERT_TRUE(pool.release_payload(payload));
+        ASSERT_EQ(pool.retained_memory(), 0u);
+        ASSERT_TRUE(pool.is_clean());
+    }
+}
+
+/**
+ * Check that, when the payload reference counter is 1, concurrent release payload operations are thread safe (verified
+ * when executed with TSAN).
+ *
+ * STEPS:
+ *  reserve payload
+ *  get payload (increase reference counter to 2)
+ *  concurrently release payload from two threads (should release resources from the thread performing the second call)
+ */
+TEST(SlabPayloadPoolTest, concurrent_release)
+{
+    // Repeat the test several times, as the detection of a data race is not deterministic
+    const unsigned int NUM_ITERATIONS = 50;
+
+    for (unsigned int i = 0; i < NUM_ITERATIONS; i++)
+    {
+        SlabPayloadPool pool;
+        Payload payload;
+
+        ASSERT_TRUE(pool.get_payload(DEFAULT_SIZE, payload));
+
+        Payload dst_payload;
+        ASSERT_TRUE(pool.get_payload(payload, dst_payload));
+
+        std::thread t1(test::release, std::ref(pool), std::ref(dst_payload));
+
+        ASSERT_TRUE(pool.release_payload(payload));
+
+        t1.join();
+    }
+}
+
+/**
+ * Reserve, share and release payloads of different sizes from several threads at the same time, so blocks move between
+ * shards and the depot (verified when executed with TSAN).
+ *
+ * The retained memory is smaller than the memory in use, so blocks are also freed.
+ */
+TEST(SlabPayloadPoolTest, concurrent_stress)
+{
+    test::MockSlabPayloadPool pool(64 * 1024);
+    std::vector<std::thread> threads;
+
+    for (unsigned int i = 0; i < STRESS_THREADS; i++)
+    {
+        threads.emplace_back(test::reserve_share_release, std::ref(pool), STRESS_ITERATIONS);
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_TRUE(pool.is_clean());
+    ASSERT_EQ(pool.pointers_stored(), 0u);
+    ASSERT_LE(pool.retained_memory(), 64u * 1024u);
+}
+
+/**
+ * Run the same workload in every payload pool and report the time each of them took.
+ *
+ * The times are recorded as test properties, so they appear in the test report. Only the correctness of each pool is
+ * checked, as times depend on the machine: every payload reserved must have been released, and the slab pool must
+ * keep the blocks released to reuse them.
+ */
+TEST(SlabPayloadPoolTest, benchmark_payload_pools)
+{
+    CopyPayloadPool copy_pool;
+    MapPayloadPool map_pool;
+    FastPayloadPool fast_pool;
+    test::MockSlabPayloadPool slab_pool;
+
+    ::testing::Test::RecordProperty("copy_pool_us", std::to_string(test::benchmark(copy_pool).count()));
+    ASSERT_TRUE(copy_pool.is_clean());
+
+    ::testing::Test::RecordProperty("map_pool_us", std::to_string(test::benchmark(map_pool).count()));
+    ASSERT_TRUE(map_pool.is_clean());
+
+    ::testing::Test::RecordProperty("fast_pool_us", std::to_string(test::benchmark(fast_pool).count()));
+    ASSERT_TRUE(fast_pool.is_clean());
+
+    ::testing::Test::RecordProperty("slab_pool_us", std::to_string(test::benchmark(slab_pool).count()));
+    ASSERT_TRUE(slab_pool.is_clean());
+    ASSERT_EQ(slab_pool.pointers_stored(), 0u);
+    ASSERT_GT(slab_pool.retained_memory(), 0u);
+    ASSERT_LE(slab_pool.retained_memory(), SlabPayloadPool::DEFAULT_MAX_RETAINED_MEMORY);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -13,6 +13,9 @@
 // limitations under the License.
 
 #include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
 #include <thread>
 
 #include <cpp_utils/testing/gtest_aux.hpp>
@@ -43,6 +46,34 @@
 using namespace eprosima;
 using namespace eprosima::fastdds::dds;
 
+namespace test {
+
+//! Max number of log entries waiting to be published. A power of two, so the queue is not rounded up.
+constexpr const std::size_t PUBLISH_QUEUE_SIZE = 4;
+
+//! Number of log entries consumed at once, more than fit in the publishing queue
+constexpr const unsigned int N_QUEUED_ENTRIES = 10;
+
+//! Message of the log entry \c index
+std::string entry_message(
+        unsigned int index)
+{
+    return "LOG_CONSUMER_TEST | Entry " + std::to_string(index);
+}
+
+//! Warning log entry \c index of the test category
+utils::Log::Entry log_entry(
+        unsigned int index)
+{
+    utils::Log::Entry entry;
+    entry.message = entry_message(index);
+    entry.context = {nullptr, -1, nullptr, "DDSPIPE_TEST"};
+    entry.kind = utils::Log::Kind::Warning;
+    return entry;
+}
+
+} // namespace test
+
 class DdsLogConsumerTest : public testing::Test
 {
 public:
@@ -72,8 +103,12 @@ public:
 
         ASSERT_NE(topic, nullptr);
 
-        // Create the reader
-        reader_ = subscriber->create_datareader(topic, DATAREADER_QOS_DEFAULT);
+        // Create the reader, keeping every entry as some tests publish several of them at once
+        DataReaderQos rqos = DATAREADER_QOS_DEFAULT;
+        rqos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+        rqos.history().kind = KEEP_ALL_HISTORY_QOS;
+
+        reader_ = subscriber->create_datareader(topic, rqos);
 
         ASSERT_NE(reader_, nullptr);
     }
@@ -89,6 +124,54 @@ public:
 
 protected:
 
+    /**
+     * Consume \c N_QUEUED_ENTRIES in a DdsLogConsumer whose publishing thread only wakes up when it is destroyed,
+     * check that none of them is published meanwhile, and destroy it.
+     *
+     * @param overflow_policy: What the consumer does with an entry when its publishing queue is full
+     * @param dropped_entries: Filled with the entries the consumer dropped before being destroyed
+     */
+    void consume_queued_entries(
+            const ddspipe::core::LogQueueOverflowPolicy overflow_policy,
+            std::uint64_t& dropped_entries)
+    {
+        // Configure the Log
+        ddspipe::core::DdsPipeLogConfiguration log_configuration;
+        log_configuration.publish.enable = true;
+        log_configuration.publish.domain = test::logging::DOMAIN;
+        log_configuration.publish.topic_name = test::logging::TOPIC_NAME;
+
+        log_configuration.verbosity = utils::VerbosityKind::Info;
+        log_configuration.filter[utils::VerbosityKind::Info].set_value("DDSPIPE_TEST");
+        log_configuration.filter[utils::VerbosityKind::Warning].set_value("DDSPIPE_TEST");
+        log_configuration.filter[utils::VerbosityKind::Error].set_value("DDSPIPE_TEST");
+
+        // Neither the batch size nor the batch period is reached, so the entries stay queued
+        log_configuration.publish_queue_size = test::PUBLISH_QUEUE_SIZE;
+        log_configuration.publish_queue_overflow_policy = overflow_policy;
+        log_configuration.publish_batch_size = test::PUBLISH_QUEUE_SIZE * 2;
+        log_configuration.publish_batch_period = 3600 * 1000;
+
+        auto consumer = std::make_unique<ddspipe::core::DdsLogConsumer>(&log_configuration);
+
+        // Wait for the publisher and the subscriber to match
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        for (unsigned int i = 0; i < test::N_QUEUED_ENTRIES; i++)
+        {
+            consumer->Consume(test::log_entry(i));
+        }
+
+        LogEntry entry;
+        SampleInfo info;
+        ASSERT_EQ(reader_->take_next_sample(&entry, &info), RETCODE_NO_DATA);
+
+        dropped_entries = consumer->dropped_entries();
+
+        // Destroying the consumer publishes the entries queued
+        consumer.reset();
+    }
+
     DomainParticipant* participant_ = nullptr;
     DataReader* reader_ = nullptr;
 };
@@ -263,6 +346,68 @@ TEST_F(DdsLogConsumerTest, dont_publish_logs)
     utils::Log::ClearConsumers();
 }
 
+/**
+ * Test that the DdsLogConsumer drops the oldest entries when its publishing queue is full, and publishes the entries
+ * queued when it is destroyed.
+ *
+ * STEPS:
+ * - consume more entries than fit in the queue without waking up the publishing thread.
+ * - check that the entries that did not fit are counted as dropped.
+ * - destroy the consumer and check that the last entries consumed are published in order.
+ */
+TEST_F(DdsLogConsumerTest, publish_queue_drop_oldest)
+{
+    std::uint64_t dropped_entries = 0;
+    ASSERT_NO_FATAL_FAILURE(consume_queued_entries(ddspipe::core::LogQueueOverflowPolicy::drop_oldest,
+            dropped_entries));
+
+    ASSERT_EQ(dropped_entries, test::N_QUEUED_ENTRIES - test::PUBLISH_QUEUE_SIZE);
+
+    LogEntry entry;
+    SampleInfo info;
+
+    for (unsigned int i = test::N_QUEUED_ENTRIES - test::PUBLISH_QUEUE_SIZE; i < test::N_QUEUED_ENTRIES; i++)
+    {
+        ASSERT_TRUE(reader_->wait_for_unread_message(test::logging::MAX_WAITING_TIME));
+        ASSERT_EQ(reader_->take_next_sample(&entry, &info), RETCODE_OK);
+        ASSERT_EQ(entry.kind(), Kind::Warning);
+        ASSERT_EQ(entry.message(), test::entry_message(i));
+    }
+
+    ASSERT_EQ(reader_->take_next_sample(&entry, &info), RETCODE_NO_DATA);
+}
+
+/**
+ * Test that the DdsLogConsumer drops the new entries when its publishing queue is full, and publishes the entries
+ * queued when it is destroyed.
+ *
+ * STEPS:
+ * - consume more entries than fit in the queue without waking up the publishing thread.
+ * - check that the entries that did not fit are counted as dropped.
+ * - destroy the consumer and check that the first entries consumed are published in order.
+ */
+TEST_F(DdsLogConsumerTest, publish_queue_drop_newest)
+{
+    std::uint64_t dropped_entries = 0;
+    ASSERT_NO_FATAL_FAILURE(consume_queued_entries(ddspipe::core::LogQueueOverflowPolicy::drop_newest,
+            dropped_entries));
+
+    ASSERT_EQ(dropped_entries, test::N_QUEUED_ENTRIES - test::PUBLISH_QUEUE_SIZE);
+
+    LogEntry entry;
+    SampleInfo info;
+
+    for (unsigned int i = 0; i < test::PUBLISH_QUEUE_SIZE; i++)
+    {
+        ASSERT_TRUE(reader_->wait_for_unread_message(test::logging::MAX_WAITING_TIME));
+        ASSERT_EQ(reader_->take_next_sample(&entry, &info), RETCODE_OK);
+        ASSERT_EQ(entry.kind(), Kind::Warning);
+        ASSERT_EQ(entry.message(), test::entry_message(i));
+    }
+
+    ASSERT_EQ(reader_->take_next_sample(&entry, &info), RETCODE_NO_DATA);
+}
+
 int main(
         int argc,
         char** argv)
@@ -0,0 +1,206 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <cpp_utils/Log.hpp>
+#include <cpp_utils/testing/LogChecker.hpp>
+
+#include <ddspipe_core/logging/LogThrottle.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddspipe::core;
+
+namespace test {
+
+//! Window long enough to never expire during a test
+constexpr const std::chrono::hours LONG_WINDOW{1};
+
+//! Window short enough to expire by sleeping
+constexpr const std::chrono::milliseconds SHORT_WINDOW{10};
+
+//! Times the message of a throttled call site has been formatted
+unsigned int formatted = 0;
+
+//! Message of a throttled call site that counts its formatting
+std::string format_message()
+{
+    ++formatted;
+    return "Message";
+}
+
+//! Throttled call site, so every call of a test goes through the same throttle
+void log_warning_throttled()
+{
+    DDSPIPE_LOG_WARNING_THROTTLED(DDSPIPE_TEST, "Message");
+}
+
+} // namespace test
+
+/**
+ * Test that only the first occurrences of each window are logged
+ */
+TEST(LogThrottleTest, first_occurrences_logged)
+{
+    LogThrottle::configure(3, test::LONG_WINDOW);
+
+    LogThrottle throttle;
+    std::uint64_t suppressed = 0;
+
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+        ASSERT_TRUE(throttle.should_log(suppressed));
+        ASSERT_EQ(suppressed, 0u);
+    }
+
+    for (unsigned int i = 0; i < 5; ++i)
+    {
+        ASSERT_FALSE(throttle.should_log(suppressed));
+    }
+
+    // Other call sites are not throttled by this one
+    LogThrottle other_throttle;
+    ASSERT_TRUE(other_throttle.should_log(suppressed));
+}
+
+/**
+ * Test that the first occurrence logged in the next window reports the occurrences suppressed
+ */
+TEST(LogThrottleTest, suppressed_reported_next_window)
+{
+    LogThrottle::configure(1, test::SHORT_WINDOW);
+
+    LogThrottle throttle;
+    std::uint64_t suppressed = 0;
+
+    ASSERT_TRUE(throttle.should_log(suppressed));
+    ASSERT_FALSE(throttle.should_log(suppressed));
+    ASSERT_FALSE(throttle.should_log(suppressed));
+
+    std::this_thread::sleep_for(test::SHORT_WINDOW * 2);
+
+    ASSERT_TRUE(throttle.should_log(suppressed));
+    ASSERT_EQ(suppressed, 2u);
+}
+
+/**
+ * Test that only the first occurrence of each window reports the occurrences suppressed before it
+ */
+TEST(LogThrottleTest, suppressed_reported_once_per_window)
+{
+    LogThrottle::configure(1, test::SHORT_WINDOW);
+
+    LogThrottle throttle;
+    std::uint64_t suppressed = 0;
+
+    ASSERT_TRUE(throttle.should_log(suppressed));
+    ASSERT_FALSE(throttle.should_log(suppressed));
+    ASSERT_FALSE(throttle.should_log(suppressed));
+
+    std::this_thread::sleep_for(test::SHORT_WINDOW * 2);
+
+    ASSERT_TRUE(throttle.should_log(suppressed));
+    ASSERT_EQ(suppressed, 2u);
+
+    // The occurrences suppressed in this window are reported in the next one, not by the next occurrence
+    ASSERT_FALSE(throttle.should_log(suppressed));
+    ASSERT_EQ(suppressed, 0u);
+
+    std::this_thread::sleep_for(test::SHORT_WINDOW * 2);
+
+    ASSERT_TRUE(throttle.should_log(suppressed));
+    ASSERT_EQ(suppressed, 1u);
+
+    // Nothing has been suppressed in the last window
+    std::this_thread::sleep_for(test::SHORT_WINDOW * 2);
+
+    ASSERT_TRUE(throttle.should_log(suppressed));
+    ASSERT_EQ(suppressed, 0u);
+}
+
+/**
+ * Test that the throttled macros log the first occurrence of a window, reporting the occurrences suppressed before
+ */
+TEST(LogThrottleTest, summary_logged_on_window_rollover)
+{
+    utils::Log::ClearConsumers();
+    utils::Log::SetVerbosity(utils::VerbosityKind::Warning);
+
+    // 2 log warnings expected: the first occurrence of each window
+    INSTANTIATE_LOG_TESTER(eprosima::utils::Log::Kind::Warning, 2, 2);
+
+    LogThrottle::configure(1, test::SHORT_WINDOW);
+
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+        test::log_warning_throttled();
+    }
+
+    std::this_thread::sleep_for(test::SHORT_WINDOW * 2);
+
+    test::log_warning_throttled();
+
+    utils::Log::Flush();
+}
+
+/**
+ * Test that no occurrence is suppressed when the max occurrences is 0
+ */
+TEST(LogThrottleTest, never_throttle)
+{
+    LogThrottle::configure(0, test::LONG_WINDOW);
+
+    LogThrottle throttle;
+    std::uint64_t suppressed = 0;
+
+    for (unsigned int i = 0; i < 100; ++i)
+    {
+        ASSERT_TRUE(throttle.should_log(suppressed));
+        ASSERT_EQ(suppressed, 0u);
+    }
+}
+
+/**
+ * Test that the messages of the occurrences suppressed are not formatted
+ */
+TEST(LogThrottleTest, suppressed_not_formatted)
+{
+    utils::Log::ClearConsumers();
+    utils::Log::SetVerbosity(utils::VerbosityKind::Warning);
+
+    LogThrottle::configure(2, test::LONG_WINDOW);
+
+    for (unsigned int i = 0; i < 10; ++i)
+    {
+        DDSPIPE_LOG_WARNING_THROTTLED(DDSPIPE_TEST, test::format_message());
+    }
+
+    utils::Log::Flush();
+
+    ASSERT_EQ(test::formatted, 2u);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
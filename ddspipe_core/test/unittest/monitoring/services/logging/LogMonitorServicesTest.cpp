@@ -0,0 +1,160 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <thread>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <cpp_utils/Log.hpp>
+#include <cpp_utils/logging/BaseLogConfiguration.hpp>
+#include <cpp_utils/logging/StdLogConsumer.hpp>
+
+#include <ddspipe_core/configuration/MonitorConfiguration.hpp>
+#include <ddspipe_core/monitoring/Monitor.hpp>
+#include <ddspipe_core/monitoring/producers/ServicesMonitorProducer.hpp>
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+
+#include "../../constants.hpp"
+
+using namespace eprosima;
+
+
+
+class LogMonitorServicesTest : public testing::Test
+{
+public:
+
+    void SetUp() override
+    {
+        // Initialize the Log
+        utils::Log::ClearConsumers();
+
+        utils::BaseLogConfiguration log_conf;
+        log_conf.verbosity = utils::VerbosityKind::Info;
+        log_conf.filter[utils::VerbosityKind::Info].set_value("MONITOR_DATA");
+
+        utils::Log::SetVerbosity(log_conf.verbosity);
+
+        utils::Log::RegisterConsumer(
+            std::make_unique<utils::StdLogConsumer>(&log_conf));
+
+        // Initialize the Monitor
+        ddspipe::core::MonitorConfiguration configuration;
+        configuration.producers[ddspipe::core::SERVICES_MONITOR_PRODUCER_ID].enabled = true;
+        configuration.producers[ddspipe::core::SERVICES_MONITOR_PRODUCER_ID].period = test::monitor::PERIOD_MS;
+
+        utils::Formatter error_msg;
+        ASSERT_TRUE(configuration.is_valid(error_msg));
+
+        monitor_ = std::make_unique<ddspipe::core::Monitor>(configuration);
+
+        if (configuration.producers[ddspipe::core::SERVICES_MONITOR_PRODUCER_ID].enabled)
+        {
+            monitor_->monitor_services();
+        }
+
+        // Initialize the Participant ID
+        participant_id_ = test::monitor::MOCK_PARTICIPANT_ID;
+    }
+
+    void TearDown() override
+    {
+        utils::Log::ClearConsumers();
+
+        monitor_.reset(nullptr);
+    }
+
+protected:
+
+    bool contains_(
+            const std::string& str,
+            const std::string& substr)
+    {
+        return str.find(substr) != std::string::npos;
+    }
+
+    std::unique_ptr<ddspipe::core::Monitor> monitor_{nullptr};
+
+    ddspipe::core::types::ParticipantId participant_id_;
+};
+
+/**
+ * Test that the Monitor monitors the requests and replies forwarded correctly.
+ *
+ * CASES:
+ * - check that the Monitor logs the requests, replies and their latency correctly.
+ */
+TEST_F(LogMonitorServicesTest, requests_and_replies)
+{
+    auto counters = monitor_service_counters("MonitoredService", participant_id_);
+
+    // Get the counters of the same service and participant
+    ASSERT_EQ(counters, monitor_service_counters("MonitoredService", participant_id_));
+
+    // Mock two requests replied after 3 and 30 ms
+    monitor_service_request(counters);
+    monitor_service_request(counters);
+    monitor_service_reply(counters, std::chrono::milliseconds(3));
+    monitor_service_reply(counters, std::chrono::milliseconds(30));
+
+    testing::internal::CaptureStdout();
+
+    // Wait for the monitor to print the message
+    std::this_thread::sleep_for(std::chrono::milliseconds(test::monitor::PERIOD_MS*3));
+    utils::Log::Flush();
+
+    ASSERT_TRUE(contains_(testing::internal::GetCapturedStdout(),
+            "Monitoring Services: [Service Name: MonitoredService, Data: [Participant ID: MonitoredParticipant, "
+            "Requests: 2, Replies: 2, Requests Expired: 0, Requests Evicted: 0, Replies Discarded: 0, "
+            "Requests Pending: 0, Mean Latency (ms): 16.5, Max Latency (ms): 30, Latency Histogram: [<=1ms: 0; "
+            "<=2ms: 0; <=5ms: 1; <=10ms: 0; <=20ms: 0; <=50ms: 1; <=100ms: 0;"));
+}
+
+/**
+ * Test that the Monitor monitors the requests not replied correctly.
+ *
+ * CASES:
+ * - check that the Monitor logs the requests expired, evicted and pending, and the replies discarded correctly.
+ */
+TEST_F(LogMonitorServicesTest, requests_lost)
+{
+    auto counters = monitor_service_counters("LostService", participant_id_);
+
+    // Mock the requests lost
+    monitor_service_requests_expired(counters, 2);
+    monitor_service_request_evicted(counters);
+    monitor_service_reply_discarded(counters);
+    monitor_service_requests_pending(counters, 3);
+
+    testing::internal::CaptureStdout();
+
+    // Wait for the monitor to print the message
+    std::this_thread::sleep_for(std::chrono::milliseconds(test::monitor::PERIOD_MS*3));
+    utils::Log::Flush();
+
+    ASSERT_TRUE(contains_(testing::internal::GetCapturedStdout(),
+            "Monitoring Services: [Service Name: LostService, Data: [Participant ID: MonitoredParticipant, "
+            "Requests: 0, Replies: 0, Requests Expired: 2, Requests Evicted: 1, Replies Discarded: 1, "
+            "Requests Pending: 3, Mean Latency (ms): 0, Max Latency (ms): 0, Latency Histogram: ["));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
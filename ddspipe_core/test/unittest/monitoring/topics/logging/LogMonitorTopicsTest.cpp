@@ -117,7 +117,7 @@ TEST_F(LogMonitorTopicsTest, msgs_received)
     ASSERT_TRUE(contains_(testing::internal::GetCapturedStdout(),
             "Monitoring Topics: [Topic Name: MonitoredTopic, Type Name: MonitoredTopicType, Type Discovered: "
             "false, Type Mismatch: false, QoS Mismatch: false, Data: [Participant ID: MonitoredParticipant, "
-            "Messages Received: 1, Messages Lost: 0, Message Reception Rate: 2; ]; ]"));
+            "Messages Received: 1, Messages Lost: 0, Messages Dropped: 0, Message Reception Rate: 2; ]; ]"));
 }
 
 /**
@@ -140,7 +140,64 @@ TEST_F(LogMonitorTopicsTest, msgs_lost)
     ASSERT_TRUE(contains_(testing::internal::GetCapturedStdout(),
             "Monitoring Topics: [Topic Name: MonitoredTopic, Type Name: MonitoredTopicType, Type Discovered: "
             "false, Type Mismatch: false, QoS Mismatch: false, Data: [Participant ID: MonitoredParticipant, "
-            "Messages Received: 0, Messages Lost: 1, Message Reception Rate: 0; ]; ]"));
+            "Messages Received: 0, Messages Lost: 1, Messages Dropped: 0, Message Reception Rate: 0; ]; ]"));
+}
+
+/**
+ * Test that the Monitor gathers the messages notified in the counters of a topic and participant.
+ *
+ * CASES:
+ * - check that the Monitor logs the msgs_received and msgs_lost added in the counters.
+ * - check that the counters are the same for the same topic and participant.
+ */
+TEST_F(LogMonitorTopicsTest, msgs_counters)
+{
+    auto counters = monitor_counters(topic_, participant_id_);
+
+    // Get the counters of the same topic and participant
+    ASSERT_EQ(counters, monitor_counters(topic_, participant_id_));
+
+    // Mock the messages received and lost
+    monitor_counters_msg_rx(counters);
+    monitor_counters_msgs_rx(counters, 2);
+    monitor_counters_msg_lost(counters);
+
+    testing::internal::CaptureStdout();
+
+    // Wait for the monitor to print the message
+    std::this_thread::sleep_for(std::chrono::milliseconds(test::monitor::PERIOD_MS*3));
+    utils::Log::Flush();
+
+    ASSERT_TRUE(contains_(testing::internal::GetCapturedStdout(),
+            "Monitoring Topics: [Topic Name: MonitoredTopic, Type Name: MonitoredTopicType, Type Discovered: "
+            "false, Type Mismatch: false, QoS Mismatch: false, Data: [Participant ID: MonitoredParticipant, "
+            "Messages Received: 3, Messages Lost: 1, Messages Dropped: 0, Message Reception Rate: 6; ]; ]"));
+}
+
+/**
+ * Test that the Monitor reports the messages dropped apart from the messages lost.
+ *
+ * CASES:
+ * - check that the Monitor logs the msgs_dropped added in the counters without counting them as lost.
+ */
+TEST_F(LogMonitorTopicsTest, msgs_dropped)
+{
+    auto counters = monitor_counters(topic_, participant_id_);
+
+    // Mock the messages received and dropped
+    monitor_counters_msgs_rx(counters, 3);
+    monitor_counters_msgs_dropped(counters, 2);
+
+    testing::internal::CaptureStdout();
+
+    // Wait for the monitor to print the message
+    std::this_thread::sleep_for(std::chrono::milliseconds(test::monitor::PERIOD_MS*3));
+    utils::Log::Flush();
+
+    ASSERT_TRUE(contains_(testing::internal::GetCapturedStdout(),
+            "Monitoring Topics: [Topic Name: MonitoredTopic, Type Name: MonitoredTopicType, Type Discovered: "
+            "false, Type Mismatch: false, QoS Mismatch: false, Data: [Participant ID: MonitoredParticipant, "
+            "Messages Received: 3, Messages Lost: 0, Messages Dropped: 2, Message Reception Rate: 6; ]; ]"));
 }
 
 /**
@@ -166,7 +223,7 @@ TEST_F(LogMonitorTopicsTest, type_discovered)
     ASSERT_TRUE(contains_(testing::internal::GetCapturedStdout(),
             "Monitoring Topics: [Topic Name: MonitoredTopic, Type Name: MonitoredTopicType, Type Discovered: "
             "true, Type Mismatch: false, QoS Mismatch: false, Data: [Participant ID: MonitoredParticipant, "
-            "Messages Received: 0, Messages Lost: 1, Message Reception Rate: 0; ]; ]"));
+            "Messages Received: 0, Messages Lost: 1, Messages Dropped: 0, Message Reception Rate: 0; ]; ]"));
 }
 
 /**
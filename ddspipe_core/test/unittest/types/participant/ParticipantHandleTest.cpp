@@ -0,0 +1,102 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/types/participant/ParticipantHandle.hpp>
+
+using namespace eprosima::ddspipe::core::types;
+
+namespace test {
+
+constexpr const unsigned int N_THREADS = 8;
+constexpr const unsigned int N_IDS = 100;
+
+} // namespace test
+
+/**
+ * Test that every id gets a different handle, which is kept in later calls and gives back the id
+ */
+TEST(ParticipantHandleTest, intern_participant_id)
+{
+    const ParticipantHandle handle_1 = intern_participant_id("participant_1");
+    const ParticipantHandle handle_2 = intern_participant_id("participant_2");
+
+    ASSERT_NE(handle_1, handle_2);
+    ASSERT_EQ(intern_participant_id("participant_1"), handle_1);
+    ASSERT_EQ(intern_participant_id("participant_2"), handle_2);
+
+    ASSERT_EQ(interned_participant_id(handle_1), "participant_1");
+    ASSERT_EQ(interned_participant_id(handle_2), "participant_2");
+}
+
+/**
+ * Test that the default participant id has the default handle, and unknown handles give the default id
+ */
+TEST(ParticipantHandleTest, default_participant_handle)
+{
+    ASSERT_EQ(intern_participant_id(DEFAULT_PARTICIPANT_ID), DEFAULT_PARTICIPANT_HANDLE);
+    ASSERT_EQ(interned_participant_id(DEFAULT_PARTICIPANT_HANDLE), DEFAULT_PARTICIPANT_ID);
+
+    ASSERT_EQ(interned_participant_id(static_cast<ParticipantHandle>(-1)), DEFAULT_PARTICIPANT_ID);
+}
+
+/**
+ * Test that interning the same ids from several threads at the same time gives the same handles
+ */
+TEST(ParticipantHandleTest, concurrent_intern)
+{
+    std::vector<std::vector<ParticipantHandle>> handles(test::N_THREADS);
+    std::vector<std::thread> threads;
+
+    for (unsigned int i = 0; i < test::N_THREADS; ++i)
+    {
+        threads.emplace_back(
+            [&handles, i]()
+            {
+                for (unsigned int j = 0; j < test::N_IDS; ++j)
+                {
+                    handles[i].push_back(intern_participant_id("concurrent_participant_" + std::to_string(j)));
+                }
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (unsigned int i = 1; i < test::N_THREADS; ++i)
+    {
+        ASSERT_EQ(handles[i], handles[0]);
+    }
+
+    for (unsigned int j = 0; j < test::N_IDS; ++j)
+    {
+        ASSERT_EQ(interned_participant_id(handles[0][j]), "concurrent_participant_" + std::to_string(j));
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -38,6 +38,7 @@
 
 #include <ddspipe_participants/configuration/SimpleParticipantConfiguration.hpp>
 #include <ddspipe_participants/library/library_dll.h>
+#include <ddspipe_participants/reader/auxiliar/WriterQoSCache.hpp>
 
 namespace eprosima {
 namespace ddspipe {
@@ -316,6 +317,13 @@ protected:
     //! DDS Router shared Discovery Database
     const std::shared_ptr<core::DiscoveryDatabase> discovery_database_;
 
+    /**
+     * QoS of the remote writers, shared by the readers that require it.
+     *
+     * It is created with the participant, so its callbacks are never added to the database from a database callback.
+     */
+    const std::shared_ptr<WriterQoSCache> writer_qos_cache_;
+
     //! <Topics <Writer_guid, Partitions set>>
     std::map<std::string, std::map<std::string, std::string>> partition_names;
 
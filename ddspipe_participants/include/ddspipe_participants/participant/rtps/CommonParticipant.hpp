@@ -35,6 +35,7 @@
 
 #include <ddspipe_participants/configuration/ParticipantConfiguration.hpp>
 #include <ddspipe_participants/library/library_dll.h>
+#include <ddspipe_participants/reader/auxiliar/WriterQoSCache.hpp>
 #include <ddspipe_participants/types/address/Address.hpp>
 
 namespace eprosima {
@@ -310,6 +311,13 @@ protected:
     //! DDS Router shared Discovery Database
     const std::shared_ptr<core::DiscoveryDatabase> discovery_database_;
 
+    /**
+     * QoS of the remote writers, shared by the readers that require it.
+     *
+     * It is created with the participant, so its callbacks are never added to the database from a database callback.
+     */
+    const std::shared_ptr<WriterQoSCache> writer_qos_cache_;
+
     //! Internal RTPS Participant
     eprosima::fastdds::rtps::RTPSParticipant* rtps_participant_{nullptr};
 
@@ -16,9 +16,11 @@
 
 #include <atomic>
 #include <mutex>
+#include <vector>
 
 #include <cpp_utils/time/time_utils.hpp>
 
+#include <ddspipe_core/types/participant/ParticipantHandle.hpp>
 #include <ddspipe_core/types/participant/ParticipantId.hpp>
 #include <ddspipe_core/interface/IReader.hpp>
 #include <ddspipe_core/interface/ITopic.hpp>
@@ -117,6 +119,19 @@ public:
     utils::ReturnCode take(
             std::unique_ptr<core::IRoutingData>& data) noexcept override;
 
+    /**
+     * @brief Override take_batch() IReader method
+     *
+     * This method calls the protected method \c take_batch_nts_ to make the actual take function.
+     * It only manages the enable/disable status.
+     *
+     * Thread safe with mutex \c mutex_ , that is taken only once for the whole batch.
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    utils::ReturnCode take_batch(
+            std::vector<std::unique_ptr<core::IRoutingData>>& data,
+            std::size_t max_samples) noexcept override;
+
     /////////////////////////
     // AUXILIARY METHODS
     /////////////////////////
@@ -214,6 +229,17 @@ protected:
     virtual utils::ReturnCode take_nts_(
             std::unique_ptr<core::IRoutingData>& data) noexcept = 0;
 
+    /**
+     * @brief Take up to \c max_samples samples at once
+     *
+     * Default implementation calls \c take_nts_ until \c max_samples have been taken or there is no more data.
+     * Override this method in inherited Reader classes that can take several samples more efficiently.
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    virtual utils::ReturnCode take_batch_nts_(
+            std::vector<std::unique_ptr<core::IRoutingData>>& data,
+            std::size_t max_samples) noexcept;
+
     /**
      * @brief Check the \c max_rx_rate and the \c downsampling to decide whether a sample should be processed.
      *
@@ -229,6 +255,9 @@ protected:
     //! Participant parent ID
     const core::types::ParticipantId participant_id_;
 
+    //! Handle of \c participant_id_ , set in the data received
+    const core::types::ParticipantHandle participant_handle_;
+
     //! Max reception rate
     float max_rx_rate_;
 
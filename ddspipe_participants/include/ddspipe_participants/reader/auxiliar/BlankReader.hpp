@@ -53,6 +53,12 @@ public:
     utils::ReturnCode take(
             std::unique_ptr<core::IRoutingData>& data) noexcept override;
 
+    //! Override take_batch() IReader method
+    DDSPIPE_PARTICIPANTS_DllAPI
+    utils::ReturnCode take_batch(
+            std::vector<std::unique_ptr<core::IRoutingData>>& data,
+            std::size_t max_samples) noexcept override;
+
     /////////////////////////
     // RPC REQUIRED METHODS
     /////////////////////////
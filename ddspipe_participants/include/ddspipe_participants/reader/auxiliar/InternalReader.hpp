@@ -89,6 +89,21 @@ protected:
     utils::ReturnCode take_nts_(
             std::unique_ptr<core::IRoutingData>& data) noexcept override;
 
+    /**
+     * @brief Take batch specific method
+     *
+     * Move up to \c max_samples data from \c data_to_send_ locking the queue only once.
+     *
+     * @param data : vector where the oldest data are appended
+     * @param max_samples : maximum number of data to take
+     * @return \c RETCODE_OK if at least one data has been correctly taken
+     * @return \c RETCODE_NO_DATA if \c data_to_send_ is empty
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    utils::ReturnCode take_batch_nts_(
+            std::vector<std::unique_ptr<core::IRoutingData>>& data,
+            std::size_t max_samples) noexcept override;
+
     //! Stores the data that must be retrieved with \c take() method
     using DataReceivedType = utils::Atomicable<std::queue<std::unique_ptr<core::IRoutingData>>>;
     DataReceivedType data_to_send_;
@@ -0,0 +1,120 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include <ddspipe_core/dynamic/DiscoveryDatabase.hpp>
+#include <ddspipe_core/types/dds/Endpoint.hpp>
+#include <ddspipe_core/types/dds/Guid.hpp>
+#include <ddspipe_core/types/dds/SpecificEndpointQoS.hpp>
+
+#include <ddspipe_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+/**
+ * Cache of the \c SpecificEndpointQoS of the writers whose data the readers of a participant receive.
+ *
+ * The QoS of a writer is looked up in the \c DiscoveryDatabase the first time it is required, and then kept in a hash
+ * map by guid. The cache listens to the database, so a writer updated or erased in the database is updated or
+ * erased in the cache as well.
+ *
+ * The database calls its callbacks with its callbacks mutex taken, so a cache must not be created nor destroyed
+ * within a database callback. Thus, each participant creates a single cache and shares it with its readers.
+ */
+class WriterQoSCache
+{
+public:
+
+    /**
+     * @brief Construct a cache and register its callbacks in the database.
+     *
+     * @param discovery_database Database of endpoints to look the QoS up in.
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    WriterQoSCache(
+            const std::shared_ptr<core::DiscoveryDatabase>& discovery_database);
+
+    /**
+     * @brief Destroy the cache, removing its callbacks from the database.
+     *
+     * Once destroyed, the database does not call the cache anymore.
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    ~WriterQoSCache();
+
+    /**
+     * @brief Get the QoS of a writer.
+     *
+     * The QoS returned is never modified, so it can be read without the mutex of the cache.
+     *
+     * @param writer_guid guid of the writer.
+     *
+     * @return QoS of the writer, or nullptr if the writer is no longer available in the database.
+     *
+     * Thread safe
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    std::shared_ptr<const core::types::SpecificEndpointQoS> get(
+            const core::types::Guid& writer_guid) const noexcept;
+
+protected:
+
+    //! Update the QoS of an endpoint if it is cached
+    void update_(
+            const core::types::Endpoint& endpoint) noexcept;
+
+    //! Remove an endpoint from the cache
+    void erase_(
+            const core::types::Endpoint& endpoint) noexcept;
+
+    //! Reference to the \c DiscoveryDatabase .
+    std::shared_ptr<core::DiscoveryDatabase> discovery_database_;
+
+    //! QoS of the writers looked up, by guid. A QoS updated is replaced, so the ones already returned do not change.
+    mutable std::unordered_map<core::types::Guid, std::shared_ptr<const core::types::SpecificEndpointQoS>,
+            std::hash<fastdds::rtps::GUID_t>> cache_;
+
+    /**
+     * Mutex that protects \c cache_ and \c version_ .
+     *
+     * Readers only take it shared to find a writer. It is not held while looking a writer up in the database.
+     */
+    mutable std::shared_timed_mutex mutex_;
+
+    /**
+     * Number of endpoints updated or erased in the database.
+     *
+     * A writer looked up in the database is only cached if no endpoint has changed meanwhile, as the value looked up
+     * may be older than the one in the callback.
+     */
+    uint64_t version_ {0};
+
+    //! Ids of the callbacks registered in \c discovery_database_
+    core::DiscoveryDatabase::CallbackId discovered_callback_id_;
+    core::DiscoveryDatabase::CallbackId updated_callback_id_;
+    core::DiscoveryDatabase::CallbackId erased_callback_id_;
+};
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
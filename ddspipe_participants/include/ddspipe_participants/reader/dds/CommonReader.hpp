@@ -27,6 +27,7 @@
 #include <fastdds/dds/topic/Topic.hpp>
 #include <fastdds/dds/topic/TopicListener.hpp>
 
+#include <ddspipe_core/monitoring/producers/TopicsMonitorProducer.hpp>
 #include <ddspipe_core/types/data/RtpsPayloadData.hpp>
 #include <ddspipe_core/types/dds/Guid.hpp>
 #include <ddspipe_core/types/participant/ParticipantId.hpp>
@@ -149,6 +150,34 @@ protected:
     virtual utils::ReturnCode take_nts_(
             std::unique_ptr<core::IRoutingData>& data) noexcept override;
 
+    /**
+     * @brief Take batch specific method
+     *
+     * Take up to \c max_samples accepted samples, as \c take_nts_ would do one by one.
+     *
+     * The samples are loaned from the DataReader at once, and the rejected ones are discarded without creating
+     * their data. The accepted ones reference the payload of the loaned sample, so it is not copied.
+     *
+     * @param data : vector where the oldest data are appended
+     * @param max_samples : maximum number of data to take
+     * @return \c RETCODE_OK if at least one data has been correctly taken
+     * @return \c RETCODE_NO_DATA if there is no data to send
+     * @return \c RETCODE_ERROR if there has been an error reading the first data
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    virtual utils::ReturnCode take_batch_nts_(
+            std::vector<std::unique_ptr<core::IRoutingData>>& data,
+            std::size_t max_samples) noexcept override;
+
+    /**
+     * @brief Take the next sample that passes \c should_accept_sample_ , discarding the rejected ones.
+     *
+     * Used by \c take_nts_ .
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    utils::ReturnCode take_next_sample_nts_(
+            std::unique_ptr<core::IRoutingData>& data) noexcept;
+
     DDSPIPE_PARTICIPANTS_DllAPI
     virtual void enable_nts_() noexcept override;
 
@@ -193,6 +222,9 @@ protected:
 
     fastdds::dds::Subscriber* dds_subscriber_;
     fastdds::dds::DataReader* reader_;
+
+    //! Monitor counters of the messages of \c topic_ in this participant
+    std::shared_ptr<core::TopicsMonitorProducer::MessageCounters> monitor_counters_;
 };
 
 } /* namespace dds */
@@ -14,9 +14,10 @@
 
 #pragma once
 
-#include <ddspipe_core/dynamic/DiscoveryDatabase.hpp>
+#include <memory>
 
 #include <ddspipe_participants/library/library_dll.h>
+#include <ddspipe_participants/reader/auxiliar/WriterQoSCache.hpp>
 #include <ddspipe_participants/reader/dds/CommonReader.hpp>
 
 namespace eprosima {
@@ -28,7 +29,7 @@ namespace dds {
  * DDS DataReader with specific QoS implements abstract CommonReader.
  *
  * This class fills the data receive information with the QoS of the Writer that has sent the data.
- * In order to access this QoS it has a reference to the DiscoveryDatabase.
+ * In order to access this QoS it shares the cache of the QoS of each Writer of its Participant.
  */
 class SpecificQoSReader : public CommonReader
 {
@@ -44,6 +45,7 @@ public:
      * @param payload_pool      Shared Payload Pool to received data and take it.
      * @param subscriber  DDS Subscriber
      * @param topic_entity  DDS Topic
+     * @param writer_qos_cache  Cache of the QoS of the Writers of the Participant
      *
      * @throw \c InitializationException in case any creation has failed
      */
@@ -54,7 +56,7 @@ public:
             const std::shared_ptr<core::PayloadPool>& payload_pool,
             fastdds::dds::DomainParticipant* participant,
             fastdds::dds::Topic* topic_entity,
-            const std::shared_ptr<core::DiscoveryDatabase>& discovery_database,
+            const std::shared_ptr<WriterQoSCache>& writer_qos_cache,
             const bool yaml_qos_override = true,
             const bool xml_lookup_enabled = false);
 
@@ -67,8 +69,8 @@ protected:
             const fastdds::dds::SampleInfo& info,
             core::types::RtpsPayloadData& data_to_fill) const noexcept override;
 
-    //! Reference to the \c DiscoveryDatabase .
-    std::shared_ptr<core::DiscoveryDatabase> discovery_database_;
+    //! QoS of the writers, looked up in the \c DiscoveryDatabase only the first time
+    std::shared_ptr<WriterQoSCache> writer_qos_cache_;
 
 };
 
@@ -28,6 +28,7 @@
 #include <fastdds/rtps/reader/RTPSReader.hpp>
 #include <fastdds/utils/TimedMutex.hpp>
 
+#include <ddspipe_core/monitoring/producers/TopicsMonitorProducer.hpp>
 #include <ddspipe_core/types/dds/Guid.hpp>
 #include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
 #include <ddspipe_core/types/participant/ParticipantId.hpp>
@@ -261,6 +262,36 @@ protected:
     virtual utils::ReturnCode take_nts_(
             std::unique_ptr<core::IRoutingData>& data) noexcept override;
 
+    /**
+     * @brief Take batch specific method
+     *
+     * Lock the internal RTPS Reader and check the number of unread changes only once for the whole batch.
+     * Then take up to \c max_samples changes, as \c take_nts_ would do one by one.
+     * Erroneous changes are removed from the History and skipped.
+     *
+     * @note guard by mutex \c rtps_mutex_
+     *
+     * @param data : vector where the oldest data are appended
+     * @param max_samples : maximum number of data to take
+     * @return \c RETCODE_OK if at least one data has been correctly taken
+     * @return \c RETCODE_NO_DATA if there is no data to send
+     * @return \c RETCODE_ERROR if every change available was erroneous
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    virtual utils::ReturnCode take_batch_nts_(
+            std::vector<std::unique_ptr<core::IRoutingData>>& data,
+            std::size_t max_samples) noexcept override;
+
+    /**
+     * @brief Take the next untaken change, that is known to exist
+     *
+     * Common part of \c take_nts_ and \c take_batch_nts_ .
+     * The change is removed from the History whether it is correct or not.
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    utils::ReturnCode take_next_change_nts_(
+            std::unique_ptr<core::IRoutingData>& data) noexcept;
+
     DDSPIPE_PARTICIPANTS_DllAPI
     virtual void enable_nts_() noexcept override;
 
@@ -343,6 +374,9 @@ protected:
 
     //! Reader QoS to create the internal RTPS Reader.
     fastdds::dds::ReaderQos reader_qos_;
+
+    //! Monitor counters of the messages of \c topic_ in this participant
+    std::shared_ptr<core::TopicsMonitorProducer::MessageCounters> monitor_counters_;
 };
 
 } /* namespace rtps */
@@ -14,9 +14,10 @@
 
 #pragma once
 
-#include <ddspipe_core/dynamic/DiscoveryDatabase.hpp>
+#include <memory>
 
 #include <ddspipe_participants/library/library_dll.h>
+#include <ddspipe_participants/reader/auxiliar/WriterQoSCache.hpp>
 #include <ddspipe_participants/reader/rtps/CommonReader.hpp>
 
 namespace eprosima {
@@ -28,7 +29,7 @@ namespace rtps {
  * RTPS Reader with specific QoS implements abstract CommonReader.
  *
  * This class fills the data receive information with the QoS of the Writer that has sent the data.
- * In order to access this QoS it has a reference to the DiscoveryDatabase.
+ * In order to access this QoS it shares the cache of the QoS of each Writer of its Participant.
  */
 class SpecificQoSReader : public CommonReader
 {
@@ -43,7 +44,7 @@ public:
      * @param topic                     Topic that this SpecificQoSReader subscribes to.
      * @param payload_pool              Shared Payload Pool to received data and take it.
      * @param rtps_participant          RTPS Participant pointer (this is not stored).
-     * @param discovery_database        Database of enpoints.
+     * @param writer_qos_cache          Cache of the QoS of the Writers of the Participant.
      *
      * @throw \c InitializationException in case any creation has failed
      */
@@ -53,7 +54,7 @@ public:
             const core::types::DdsTopic& topic,
             const std::shared_ptr<core::PayloadPool>& payload_pool,
             fastdds::rtps::RTPSParticipant* rtps_participant,
-            const std::shared_ptr<core::DiscoveryDatabase>& discovery_database);
+            const std::shared_ptr<WriterQoSCache>& writer_qos_cache);
 
 protected:
 
@@ -65,8 +66,8 @@ protected:
             core::types::RtpsPayloadData& data_to_fill) const noexcept override;
 
 
-    //! Reference to the \c DiscoveryDatabase .
-    std::shared_ptr<core::DiscoveryDatabase> discovery_database_;
+    //! QoS of the writers, looked up in the \c DiscoveryDatabase only the first time
+    std::shared_ptr<WriterQoSCache> writer_qos_cache_;
 
 };
 
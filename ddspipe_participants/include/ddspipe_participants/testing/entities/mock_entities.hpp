@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <condition_variable>
 #include <mutex>
 #include <queue>
 
@@ -152,10 +153,31 @@ public:
     DDSPIPE_PARTICIPANTS_DllAPI
     std::size_t n_to_send_data();
 
+    //! Make the following writes wait until \c release_writes is called
+    DDSPIPE_PARTICIPANTS_DllAPI
+    void hold_writes();
+
+    //! Wait until a write is waiting because of \c hold_writes
+    DDSPIPE_PARTICIPANTS_DllAPI
+    void wait_held_write();
+
+    //! Let the writes waiting and the following ones continue
+    DDSPIPE_PARTICIPANTS_DllAPI
+    void release_writes();
+
 protected:
 
     utils::event::CounterWaitHandler waiter_{0, 0, true};
     utils::Atomicable<std::queue<MockRoutingData>> data_queue_;
+
+    //! Whether writes must wait. Protected by \c hold_mutex_ .
+    bool hold_ = false;
+
+    //! Number of writes waiting. Protected by \c hold_mutex_ .
+    std::size_t held_writes_ = 0;
+
+    std::mutex hold_mutex_;
+    std::condition_variable hold_cv_;
 };
 
 class MockTopic : public core::types::DistributedTopic
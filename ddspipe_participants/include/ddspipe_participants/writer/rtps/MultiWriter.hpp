@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <unordered_map>
+
 #include <cpp_utils/types/Atomicable.hpp>
 
 #include <ddspipe_core/types/participant/ParticipantId.hpp>
@@ -69,6 +71,18 @@ public:
     DDSPIPE_PARTICIPANTS_DllAPI
     virtual ~MultiWriter();
 
+    /**
+     * @brief Override write() BaseWriter method
+     *
+     * Unlike \c BaseWriter , \c mutex_ is not held while writing, so several Tracks can write through this
+     * MultiWriter at the same time. Each internal writer serializes its own writes.
+     *
+     * Thread safe with mutex \c mutex_ (only to check \c max_tx_rate ) and the lock of \c writers_map_ .
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    virtual utils::ReturnCode write(
+            core::IRoutingData& data) noexcept override;
+
 protected:
 
     //! Override specific enable to call enable in internal writers.
@@ -93,6 +107,13 @@ protected:
 
     bool exist_partition_(
             const core::types::SpecificEndpointQoS& data_qos);
+
+    /**
+     * @brief Get the writer for \c data_qos , creating it if it does not exist yet.
+     *
+     * The writer is looked up with a shared lock, so Tracks writing at the same time do not block each other.
+     * The unique lock is only taken when the writer must be created.
+     */
     QoSSpecificWriter* get_writer_or_create_(
             const core::types::SpecificEndpointQoS& data_qos);
     QoSSpecificWriter* create_writer_nts_(
@@ -102,7 +123,8 @@ protected:
     // INTERNAL VARIABLES
     /////////////////////////
 
-    using WritersMapType = utils::SharedAtomicable<std::map<core::types::SpecificEndpointQoS, QoSSpecificWriter*>>;
+    using WritersMapType =
+            utils::SharedAtomicable<std::unordered_map<core::types::SpecificEndpointQoS, QoSSpecificWriter*>>;
     //! Map of writer indexed by Specific QoS of each.
     WritersMapType writers_map_;
 
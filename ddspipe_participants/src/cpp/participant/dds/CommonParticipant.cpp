@@ -221,7 +221,7 @@ std::shared_ptr<core::IReader> CommonParticipant::create_reader(
             this->payload_pool_,
             dds_participant_,
             fastdds_topic,
-            discovery_database_,
+            writer_qos_cache_,
             endpoint_qos_mode_(),
             xml_lookup_enabled_());
         // Add the filters data structures
@@ -429,6 +429,7 @@ CommonParticipant::CommonParticipant(
     : configuration_(participant_configuration)
     , payload_pool_(payload_pool)
     , discovery_database_(discovery_database)
+    , writer_qos_cache_(std::make_shared<WriterQoSCache>(discovery_database))
 {
     // Do nothing
 }
@@ -58,6 +58,7 @@ CommonParticipant::CommonParticipant(
     : configuration_(participant_configuration)
     , payload_pool_(payload_pool)
     , discovery_database_(discovery_database)
+    , writer_qos_cache_(std::make_shared<WriterQoSCache>(discovery_database))
     , domain_id_(domain_id)
 {
     // Do nothing
@@ -502,7 +503,7 @@ std::shared_ptr<core::IReader> CommonParticipant::create_reader(
                 dds_topic,
                 this->payload_pool_,
                 rtps_participant_,
-                discovery_database_);
+                writer_qos_cache_);
 
             // Add the filters data structures
             // if these filters are empty, the filters are not applied.
@@ -35,6 +35,7 @@ BaseReader::BaseReader(
         const float max_rx_rate /* = 0 */,
         const unsigned int downsampling /* = 1 */)
     : participant_id_(participant_id)
+    , participant_handle_(core::types::intern_participant_id(participant_id))
     , max_rx_rate_(max_rx_rate)
     , downsampling_(downsampling)
     , on_data_available_lambda_(DEFAULT_ON_DATA_AVAILABLE_CALLBACK)
@@ -126,6 +127,48 @@ utils::ReturnCode BaseReader::take(
     }
 }
 
+utils::ReturnCode BaseReader::take_batch(
+        std::vector<std::unique_ptr<core::IRoutingData>>& data,
+        std::size_t max_samples) noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+
+    if (enabled_.load())
+    {
+        return take_batch_nts_(data, max_samples);
+    }
+    else
+    {
+        logDevError(DDSPIPE_BASEREADER,
+                "Attempt to take data from disabled Reader in Participant " << participant_id_);
+        return utils::ReturnCode::RETCODE_NOT_ENABLED;
+    }
+}
+
+utils::ReturnCode BaseReader::take_batch_nts_(
+        std::vector<std::unique_ptr<core::IRoutingData>>& data,
+        std::size_t max_samples) noexcept
+{
+    std::size_t taken = 0;
+
+    while (taken < max_samples)
+    {
+        std::unique_ptr<core::IRoutingData> sample;
+        auto ret = take_nts_(sample);
+
+        if (ret != utils::ReturnCode::RETCODE_OK)
+        {
+            // If some data has already been taken, return it and let the next take report this status
+            return taken > 0 ? utils::ReturnCode::RETCODE_OK : ret;
+        }
+
+        data.push_back(std::move(sample));
+        ++taken;
+    }
+
+    return utils::ReturnCode::RETCODE_OK;
+}
+
 core::types::ParticipantId BaseReader::participant_id() const noexcept
 {
     return participant_id_;
@@ -44,6 +44,13 @@ utils::ReturnCode BlankReader::take(
     return utils::ReturnCode::RETCODE_NO_DATA;
 }
 
+utils::ReturnCode BlankReader::take_batch(
+        std::vector<std::unique_ptr<core::IRoutingData>>& /* data */,
+        std::size_t /* max_samples */) noexcept
+{
+    return utils::ReturnCode::RETCODE_NO_DATA;
+}
+
 core::types::Guid BlankReader::guid() const
 {
     throw utils::UnsupportedException("guid method not allowed for non RTPS readers.");
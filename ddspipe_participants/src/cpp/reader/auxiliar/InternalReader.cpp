@@ -49,11 +49,14 @@ void InternalReader::enable_nts_() noexcept
 void InternalReader::simulate_data_reception(
         std::unique_ptr<IRoutingData>&& data) noexcept
 {
-    std::lock_guard<DataReceivedType> lock(data_to_send_);
+    {
+        std::lock_guard<DataReceivedType> lock(data_to_send_);
 
-    // Even if disabled, the data will be stored
-    data_to_send_.push(std::move(data));
+        // Even if disabled, the data will be stored
+        data_to_send_.push(std::move(data));
+    }
 
+    // The queue must not be locked while notifying, as the data may be taken within the callback
     if (enabled_)
     {
         // Call on data available callback
@@ -82,6 +85,30 @@ utils::ReturnCode InternalReader::take_nts_(
     return utils::ReturnCode::RETCODE_OK;
 }
 
+utils::ReturnCode InternalReader::take_batch_nts_(
+        std::vector<std::unique_ptr<IRoutingData>>& data,
+        std::size_t max_samples) noexcept
+{
+    std::lock_guard<DataReceivedType> lock(data_to_send_);
+
+    // Enable check is done in BaseReader
+
+    // There is no data pending sent
+    if (data_to_send_.empty())
+    {
+        return utils::ReturnCode::RETCODE_NO_DATA;
+    }
+
+    // Move the first data in queue to input, keeping their order
+    for (std::size_t taken = 0; taken < max_samples && !data_to_send_.empty(); ++taken)
+    {
+        data.push_back(std::move(data_to_send_.front()));
+        data_to_send_.pop();
+    }
+
+    return utils::ReturnCode::RETCODE_OK;
+}
+
 void InternalReader::update_partitions(
         const std::set<std::string>& partitions_set)
 {
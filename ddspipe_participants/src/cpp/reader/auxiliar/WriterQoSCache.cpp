@@ -0,0 +1,127 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_participants/reader/auxiliar/WriterQoSCache.hpp>
+#include <utils/utils.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+using namespace eprosima::ddspipe::core::types;
+
+WriterQoSCache::WriterQoSCache(
+        const std::shared_ptr<core::DiscoveryDatabase>& discovery_database)
+    : discovery_database_(discovery_database)
+{
+    discovered_callback_id_ = discovery_database_->add_endpoint_discovered_callback(
+        std::bind(&WriterQoSCache::update_, this, std::placeholders::_1));
+
+    updated_callback_id_ = discovery_database_->add_endpoint_updated_callback(
+        std::bind(&WriterQoSCache::update_, this, std::placeholders::_1));
+
+    erased_callback_id_ = discovery_database_->add_endpoint_erased_callback(
+        std::bind(&WriterQoSCache::erase_, this, std::placeholders::_1));
+}
+
+WriterQoSCache::~WriterQoSCache()
+{
+    discovery_database_->remove_callback(discovered_callback_id_);
+    discovery_database_->remove_callback(updated_callback_id_);
+    discovery_database_->remove_callback(erased_callback_id_);
+}
+
+std::shared_ptr<const SpecificEndpointQoS> WriterQoSCache::get(
+        const Guid& writer_guid) const noexcept
+{
+    uint64_t version;
+
+    {
+        std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+
+        auto it = cache_.find(writer_guid);
+
+        if (it != cache_.end())
+        {
+            return it->second;
+        }
+
+        version = version_;
+    }
+
+    // Look the writer up without the mutex, so the other readers are not blocked meanwhile
+    SpecificEndpointQoS specific_qos;
+
+    if (!detail::try_specific_qos_of_writer_(*discovery_database_, writer_guid, specific_qos))
+    {
+        // Do not cache a writer not found, as it may be discovered later
+        return nullptr;
+    }
+
+    auto qos = std::make_shared<const SpecificEndpointQoS>(std::move(specific_qos));
+
+    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+
+    // Another reader may have cached the writer meanwhile
+    auto it = cache_.find(writer_guid);
+
+    if (it != cache_.end())
+    {
+        return it->second;
+    }
+
+    // An endpoint changed meanwhile, so the value looked up may be outdated. Use it, but look it up again next time.
+    if (version != version_)
+    {
+        return qos;
+    }
+
+    logDebug(DDSPIPE_WRITER_QOS_CACHE, "Caching QoS " << *qos << " of writer " << writer_guid << ".");
+
+    cache_.emplace(writer_guid, qos);
+
+    return qos;
+}
+
+void WriterQoSCache::update_(
+        const Endpoint& endpoint) noexcept
+{
+    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+
+    ++version_;
+
+    // Only writers already looked up are cached
+    auto it = cache_.find(endpoint.guid);
+
+    if (it != cache_.end())
+    {
+        it->second = std::make_shared<const SpecificEndpointQoS>(endpoint.specific_qos);
+    }
+}
+
+void WriterQoSCache::erase_(
+        const Endpoint& endpoint) noexcept
+{
+    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+
+    ++version_;
+
+    cache_.erase(endpoint.guid);
+}
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
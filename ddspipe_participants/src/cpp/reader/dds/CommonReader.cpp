@@ -12,6 +12,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <limits>
+
 #include <cpp_utils/exception/InitializationException.hpp>
 #include <cpp_utils/Log.hpp>
 #include <cpp_utils/math/math_extension.hpp>
@@ -24,6 +27,8 @@
 #include <ddspipe_participants/reader/dds/CommonReader.hpp>
 #include <ddspipe_participants/types/dds/TopicDataType.hpp>
 
+#include <fastdds/dds/core/LoanableSequence.hpp>
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
 #include <fastdds/dds/xtypes/dynamic_types/DynamicType.hpp>
 
 #include <utils/utils.hpp>
@@ -157,7 +162,7 @@ void CommonReader::on_data_available(
     // An on_data_available event can be received with more than one message, but figuring out the number of messages
     // received is not possible with the current API. Thus, the Monitor will be notified once for each on_data_available
     // and the number of messages received will be slightly inaccurate.
-    monitor_msg_rx(topic_, participant_id_);
+    monitor_counters_msg_rx(monitor_counters_);
 
     if (enabled_)
     {
@@ -172,7 +177,7 @@ void CommonReader::on_sample_lost(
     EPROSIMA_LOG_WARNING(DDSPIPE_DDS_READER,
             "SAMPLE_LOST | On reader " << *this << " a data sample was lost and will not be received");
 
-    monitor_msg_lost(topic_, participant_id_);
+    monitor_counters_msg_lost(monitor_counters_);
 }
 
 void CommonReader::on_requested_incompatible_qos(
@@ -215,6 +220,7 @@ CommonReader::CommonReader(
     , topic_(topic)
     , dds_subscriber_(nullptr)
     , reader_(nullptr)
+    , monitor_counters_(monitor_counters(topic, participant_id))
 {
     // Do nothing
 }
@@ -227,6 +233,93 @@ utils::ReturnCode CommonReader::take_nts_(
 
     EPROSIMA_LOG_INFO(DDSPIPE_DDS_READER, "Taking data in " << participant_id_ << " for topic " << topic_ << ".");
 
+    auto ret = take_next_sample_nts_(data);
+
+    if (ret == utils::ReturnCode::RETCODE_OK)
+    {
+        EPROSIMA_LOG_INFO(DDSPIPE_DDS_READER, "Data taken in " << participant_id_ << " for topic " << topic_ << ".");
+    }
+
+    return ret;
+}
+
+utils::ReturnCode CommonReader::take_batch_nts_(
+        std::vector<std::unique_ptr<core::IRoutingData>>& data,
+        std::size_t max_samples) noexcept
+{
+    EPROSIMA_LOG_INFO(DDSPIPE_DDS_READER,
+            "Taking up to " << max_samples << " data in " << participant_id_ << " for topic " << topic_ << ".");
+
+    std::size_t taken = 0;
+    utils::ReturnCode ret = utils::ReturnCode::RETCODE_OK;
+
+    // Rejected samples do not count, so take again until the batch is full or there is no more data
+    while (taken < max_samples)
+    {
+        fastdds::dds::LoanableSequence<RtpsPayloadData> loaned_data;
+        fastdds::dds::SampleInfoSeq infos;
+
+        // Loan every sample available at once instead of taking them one by one
+        auto take_ret = reader_->take(
+            loaned_data,
+            infos,
+            static_cast<int32_t>(std::min<std::size_t>(max_samples - taken, std::numeric_limits<int32_t>::max())));
+
+        if (take_ret != fastdds::dds::RETCODE_OK)
+        {
+            ret = take_ret;
+            break;
+        }
+
+        for (fastdds::dds::LoanableCollection::size_type i = 0; i < loaned_data.length(); ++i)
+        {
+            auto& loaned_sample = loaned_data[i];
+            const auto& info = infos[i];
+
+            if (should_accept_sample_(info))
+            {
+                std::unique_ptr<RtpsPayloadData> rtps_data(new RtpsPayloadData());
+
+                // Reference the payload of the loaned sample, without copying it
+                if (info.valid_data && loaned_sample.payload.length > 0)
+                {
+                    payload_pool_->get_payload(loaned_sample.payload, rtps_data->payload);
+                }
+
+                // If the payload owner is not set, rtps_data won't release the payload on destruction
+                rtps_data->payload_owner = payload_pool_.get();
+
+                fill_received_data_(info, *rtps_data);
+
+                data.push_back(std::move(rtps_data));
+                ++taken;
+            }
+
+            // Release the reference of the loaned sample, as the reader reuses it for the next samples
+            if (info.valid_data && loaned_sample.payload.length > 0)
+            {
+                payload_pool_->release_payload(loaned_sample.payload);
+            }
+        }
+
+        reader_->return_loan(loaned_data, infos);
+    }
+
+    if (taken == 0)
+    {
+        return ret;
+    }
+
+    EPROSIMA_LOG_INFO(DDSPIPE_DDS_READER,
+            taken << " data taken in " << participant_id_ << " for topic " << topic_ << ".");
+
+    // Return the data already taken and let the next take report any error
+    return utils::ReturnCode::RETCODE_OK;
+}
+
+utils::ReturnCode CommonReader::take_next_sample_nts_(
+        std::unique_ptr<core::IRoutingData>& data) noexcept
+{
     std::unique_ptr<RtpsPayloadData> rtps_data;
     fastdds::dds::SampleInfo info;
 
@@ -247,8 +340,6 @@ utils::ReturnCode CommonReader::take_nts_(
     }
     while (!should_accept_sample_(info));
 
-    EPROSIMA_LOG_INFO(DDSPIPE_DDS_READER, "Data taken in " << participant_id_ << " for topic " << topic_ << ".");
-
     // Verify that the rtps_data object is valid
     if (!rtps_data)
     {
@@ -426,7 +517,7 @@ void CommonReader::fill_received_data_(
     // Get source timestamp
     data_to_fill.source_timestamp = info.source_timestamp;
     // Get Participant receiver
-    data_to_fill.participant_receiver = participant_id_;
+    data_to_fill.participant_receiver = participant_handle_;
 
     // Set Instance Handle to data_to_fill
     if (topic_.topic_qos.keyed)
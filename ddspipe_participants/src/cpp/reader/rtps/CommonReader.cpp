@@ -75,6 +75,7 @@ CommonReader::CommonReader(
     , reader_attributes_(reader_attributes)
     , topic_description_(topic_description)
     , reader_qos_(reader_qos)
+    , monitor_counters_(monitor_counters(topic, participant_id))
 {
     // Do nothing.
 }
@@ -206,6 +207,49 @@ utils::ReturnCode CommonReader::take_nts_(
         return utils::ReturnCode::RETCODE_NO_DATA;
     }
 
+    return take_next_change_nts_(data);
+}
+
+utils::ReturnCode CommonReader::take_batch_nts_(
+        std::vector<std::unique_ptr<core::IRoutingData>>& data,
+        std::size_t max_samples) noexcept
+{
+    // Lock the RTPS Reader once for the whole batch (it is recursive, so internal calls do not block)
+    std::lock_guard<eprosima::fastdds::RecursiveTimedMutex> lock(get_rtps_mutex());
+
+    // Check how much data is available only once
+    uint64_t unread_count = rtps_reader_->get_unread_count();
+    if (!(unread_count > 0))
+    {
+        return utils::ReturnCode::RETCODE_NO_DATA;
+    }
+
+    std::size_t taken = 0;
+    utils::ReturnCode ret = utils::ReturnCode::RETCODE_OK;
+
+    for (; unread_count > 0 && taken < max_samples; --unread_count)
+    {
+        std::unique_ptr<core::IRoutingData> sample;
+        ret = take_next_change_nts_(sample);
+
+        if (ret == utils::ReturnCode::RETCODE_OK)
+        {
+            data.push_back(std::move(sample));
+            ++taken;
+        }
+        else if (ret == utils::ReturnCode::RETCODE_NO_DATA)
+        {
+            break;
+        }
+        // Erroneous changes have already been removed from the History, continue with the next one
+    }
+
+    return taken > 0 ? utils::ReturnCode::RETCODE_OK : ret;
+}
+
+utils::ReturnCode CommonReader::take_next_change_nts_(
+        std::unique_ptr<core::IRoutingData>& data) noexcept
+{
     // Read first change of the history
     auto received_change = rtps_reader_->next_untaken_cache();
     if (!received_change)
@@ -227,10 +271,6 @@ utils::ReturnCode CommonReader::take_nts_(
     auto data_ptr = create_data_(*received_change);
     fill_received_data_(*received_change, *data_ptr);
 
-    std::ostringstream guid_ss;
-    guid_ss << data_ptr->source_guid;
-    std::string source_guid_str = guid_ss.str();
-
     data.reset(data_ptr);
 
     // Remove the change in the History and release it in the reader
@@ -269,7 +309,7 @@ void CommonReader::fill_received_data_(
     // Get source timestamp
     data_to_fill.source_timestamp = received_change.sourceTimestamp;
     // Get Participant receiver
-    data_to_fill.participant_receiver = participant_id_;
+    data_to_fill.participant_receiver = participant_handle_;
 
     // Store it in DdsPipe PayloadPool if size is bigger than 0
     // NOTE: in case of keyed topics an empty payload is possible
@@ -497,7 +537,7 @@ void CommonReader::on_new_cache_change_added(
         fastdds::rtps::RTPSReader* reader,
         const fastdds::rtps::CacheChange_t* const change) noexcept
 {
-    monitor_msg_rx(topic_, participant_id_);
+    monitor_counters_msg_rx(monitor_counters_);
 
     if (should_accept_change_(change))
     {
@@ -578,7 +618,7 @@ void CommonReader::on_sample_lost(
     EPROSIMA_LOG_WARNING(DDSPIPE_RTPS_COMMONREADER_LISTENER,
             "SAMPLE_LOST | On reader " << *this << " a data sample was lost and will not be received");
 
-    monitor_msg_lost(topic_, participant_id_);
+    monitor_counters_msg_lost(monitor_counters_);
 }
 
 void CommonReader::on_sample_rejected(
@@ -19,7 +19,6 @@
 #include <cpp_utils/Log.hpp>
 
 #include <ddspipe_participants/reader/rtps/SpecificQoSReader.hpp>
-#include <utils/utils.hpp>
 
 namespace eprosima {
 namespace ddspipe {
@@ -31,14 +30,14 @@ SpecificQoSReader::SpecificQoSReader(
         const core::types::DdsTopic& topic,
         const std::shared_ptr<core::PayloadPool>& payload_pool,
         fastdds::rtps::RTPSParticipant* rtps_participant,
-        const std::shared_ptr<core::DiscoveryDatabase>& discovery_database)
+        const std::shared_ptr<WriterQoSCache>& writer_qos_cache)
     : CommonReader(
         participant_id, topic, payload_pool, rtps_participant,
         reckon_history_attributes_(topic),
         reckon_reader_attributes_(topic),
         reckon_topic_description_(topic),
         reckon_reader_qos_(topic))
-    , discovery_database_(discovery_database)
+    , writer_qos_cache_(writer_qos_cache)
 {
 }
 
@@ -58,11 +57,15 @@ void SpecificQoSReader::fill_received_data_(
     }
 
     // During teardown it is expected that late samples can outlive writer discovery data
-    if (detail::try_specific_qos_of_writer_(*discovery_database_, data_to_fill.source_guid, data_to_fill.writer_qos))
+    const auto writer_qos = writer_qos_cache_->get(data_to_fill.source_guid);
+
+    if (writer_qos)
     {
+        data_to_fill.writer_qos = writer_qos;
+
         logDebug(
             DDSPIPE_SpecificQoSReader,
-            "Set QoS " << data_to_fill.writer_qos << " for data from " << data_to_fill.source_guid << ".");
+            "Set QoS " << *writer_qos << " for data from " << data_to_fill.source_guid << ".");
     }
     else
     {
@@ -174,6 +174,24 @@ utils::ReturnCode MockWriter::write_nts_(
 {
     auto data_cast = dynamic_cast<MockRoutingData&>(data);
 
+    {
+        // Wait while writes are held
+        std::unique_lock<std::mutex> lock(hold_mutex_);
+
+        if (hold_)
+        {
+            ++held_writes_;
+            hold_cv_.notify_all();
+            hold_cv_.wait(
+                lock,
+                [this]()
+                {
+                    return !hold_;
+                });
+            --held_writes_;
+        }
+    }
+
     {
         // Lock access to queue
         std::lock_guard<utils::Atomicable<std::queue<MockRoutingData>>> _(data_queue_);
@@ -214,6 +232,33 @@ std::size_t MockWriter::n_to_send_data()
     return data_queue_.size();
 }
 
+void MockWriter::hold_writes()
+{
+    std::lock_guard<std::mutex> lock(hold_mutex_);
+    hold_ = true;
+}
+
+void MockWriter::wait_held_write()
+{
+    std::unique_lock<std::mutex> lock(hold_mutex_);
+    hold_cv_.wait(
+        lock,
+        [this]()
+        {
+            return held_writes_ > 0;
+        });
+}
+
+void MockWriter::release_writes()
+{
+    {
+        std::lock_guard<std::mutex> lock(hold_mutex_);
+        hold_ = false;
+    }
+
+    hold_cv_.notify_all();
+}
+
 core::types::TopicInternalTypeDiscriminator MockTopic::internal_type_discriminator() const noexcept
 {
     return INTERNAL_TOPIC_TYPE_MOCK_TEST;
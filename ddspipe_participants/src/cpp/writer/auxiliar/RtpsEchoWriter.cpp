@@ -41,13 +41,14 @@ utils::ReturnCode RtpsEchoWriter::write(
         core::IRoutingData& data) noexcept
 {
     auto& rtps_data = dynamic_cast<core::types::RtpsPayloadData&>(data);
+    const auto& participant_receiver = core::types::interned_participant_id(rtps_data.participant_receiver);
 
     // TODO: Add Participant receiver Id when added to DataReceived
     if (!verbose_)
     {
         logUser(
             DDSPIPE_ECHO_DATA,
-            "Received data in Participant: " << rtps_data.participant_receiver
+            "Received data in Participant: " << participant_receiver
                                              << " in topic: " << topic_.topic_name()
                                              << ".");
     }
@@ -56,10 +57,10 @@ utils::ReturnCode RtpsEchoWriter::write(
         logUser(
             DDSPIPE_ECHO_DATA,
             "In Endpoint: " << rtps_data.source_guid
-                            << " from Participant: " << rtps_data.participant_receiver
+                            << " from Participant: " << participant_receiver
                             << " in topic: " << topic_.topic_name()
                             << " payload received: " << rtps_data.payload
-                            << " with specific qos: " << rtps_data.writer_qos
+                            << " with specific qos: " << rtps_data.writer_specific_qos()
                             << ".");
     }
 
@@ -91,14 +91,48 @@ bool MultiWriter::exist_partition_(
     return writers_map_.find(data_qos) != writers_map_.end();
 }
 
+utils::ReturnCode MultiWriter::write(
+        core::IRoutingData& data) noexcept
+{
+    if (!enabled_.load())
+    {
+        logDevError(DDSPIPE_MULTIWRITER,
+                "Attempt to write data from disabled Writer in topic in Participant " << participant_id_);
+        return utils::ReturnCode::RETCODE_NOT_ENABLED;
+    }
+
+    // The timestamp of the last sample is only required with a max transmission rate
+    if (max_tx_rate_ > 0)
+    {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+
+        if (!should_send_sample_())
+        {
+            return utils::ReturnCode::RETCODE_OK;
+        }
+    }
+
+    return write_nts_(data);
+}
+
 QoSSpecificWriter* MultiWriter::get_writer_or_create_(
         const core::types::SpecificEndpointQoS& data_qos)
 {
-    // NOTE: it uses unique lock because it may change the database, and there is no way
-    // to do so if taking share and unique must be done.
+    // Get if it exists, without blocking other writes
+    {
+        std::shared_lock<WritersMapType> lock(writers_map_);
+
+        auto it = writers_map_.find(data_qos);
+        if (it != writers_map_.end())
+        {
+            return it->second;
+        }
+    }
+
+    // NOTE: it uses unique lock because it changes the map. Another thread could have created the writer
+    // between releasing the shared lock and taking the unique one, so look for it again.
     std::unique_lock<WritersMapType> lock(writers_map_);
 
-    // Get if it exists
     auto it = writers_map_.find(data_qos);
     if (it != writers_map_.end())
     {
@@ -147,11 +181,11 @@ utils::ReturnCode MultiWriter::write_nts_(
 
     logDebug(
         DDSPIPE_MULTIWRITER,
-        "Writing in Partitions Writer " << *this << " a data with qos " << rtps_data.writer_qos << " from "
-                                        << rtps_data.source_guid);
+        "Writing in Partitions Writer " << *this << " a data with qos " << rtps_data.writer_specific_qos()
+                                        << " from " << rtps_data.source_guid);
 
     // Take Writer
-    auto this_qos_writer = get_writer_or_create_(rtps_data.writer_qos);
+    auto this_qos_writer = get_writer_or_create_(rtps_data.writer_specific_qos());
 
     logDebug(
         DDSPIPE_MULTIWRITER,
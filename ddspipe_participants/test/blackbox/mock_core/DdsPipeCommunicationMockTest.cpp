@@ -12,6 +12,14 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include <cpp_utils/testing/gtest_aux.hpp>
 #include <gtest/gtest.h>
 
@@ -35,6 +43,12 @@ constexpr const unsigned int N_THREADS = 2;
 constexpr const unsigned int N_MESSAGES = 5;
 constexpr const unsigned int N_PARTICIPANTS = 3;
 constexpr const unsigned int N_TOPICS = 2;
+constexpr const unsigned int N_BATCH_MESSAGES = 100;
+constexpr const unsigned int TRANSMISSION_QUANTUM_SAMPLES = 7;
+constexpr const unsigned int WRITER_QUEUE_SIZE = 10;
+
+//! Threads so the Track of the first participant still runs while a write of every other participant is held
+constexpr const unsigned int N_HELD_WRITES_THREADS = N_PARTICIPANTS;
 
 participants::testing::MockRoutingData new_data(
         const core::types::ParticipantId& id,
@@ -45,6 +59,139 @@ participants::testing::MockRoutingData new_data(
     return new_data;
 }
 
+/**
+ * Create \c N_PARTICIPANTS mock participants and a disabled DDS Pipe whose only builtin topic is \c topic .
+ *
+ * @param topic: Topic to communicate
+ * @param participants: Filled with the participants created
+ * @param n_threads: Threads of the pool of the DDS Pipe
+ */
+std::unique_ptr<core::DdsPipe> create_disabled_pipe(
+        const participants::testing::MockTopic& topic,
+        std::vector<std::shared_ptr<participants::testing::MockParticipant>>& participants,
+        unsigned int n_threads = N_THREADS)
+{
+    // Create Participants
+    auto part_db = std::make_shared<core::ParticipantsDatabase>();
+    for (unsigned int i = 0; i < N_PARTICIPANTS; i++)
+    {
+        core::types::ParticipantId part_id("Participant_" + std::to_string(i));
+        auto part = std::make_shared<participants::testing::MockParticipant>(part_id);
+        participants.push_back(part);
+        part_db->add_participant(part_id, part);
+    }
+
+    // Create DDS Pipe
+    core::DdsPipeConfiguration ddspipe_configuration;
+    ddspipe_configuration.builtin_topics.insert(
+        eprosima::utils::Heritable<participants::testing::MockTopic>::make_heritable(topic));
+    ddspipe_configuration.init_enabled = false;
+
+    return std::make_unique<core::DdsPipe>(
+        ddspipe_configuration,
+        std::make_shared<core::DiscoveryDatabase>(),
+        std::make_shared<core::FastPayloadPool>(),
+        part_db,
+        std::make_shared<eprosima::utils::SlotThreadPool>(n_threads));
+}
+
+//! Simulate the reception of \c N_BATCH_MESSAGES in the reader of the first participant
+void simulate_batch_reception(
+        const participants::testing::MockTopic& topic,
+        const std::vector<std::shared_ptr<participants::testing::MockParticipant>>& participants)
+{
+    auto reader_0 = participants[0]->get_reader(topic);
+    ASSERT_NE(reader_0, nullptr);
+
+    for (unsigned int i = 0; i < N_BATCH_MESSAGES; i++)
+    {
+        reader_0->simulate_data_reception(new_data(participants[0]->id(), i));
+    }
+}
+
+//! Index of a data created with \c new_data
+unsigned int index_of(
+        const participants::testing::MockRoutingData& data)
+{
+    return std::stoul(data.data.substr(data.data.rfind("::") + 2));
+}
+
+//! Writer of every participant but the first, indexed by Participant id
+void other_writers(
+        const participants::testing::MockTopic& topic,
+        const std::vector<std::shared_ptr<participants::testing::MockParticipant>>& participants,
+        std::map<core::types::ParticipantId, std::shared_ptr<participants::testing::MockWriter>>& writers)
+{
+    for (unsigned int p = 1; p < N_PARTICIPANTS; p++)
+    {
+        auto writer = participants[p]->get_writer(topic);
+        ASSERT_NE(writer, nullptr);
+        writers[participants[p]->id()] = writer;
+    }
+}
+
+//! Metrics of the writer queues of the Track of the first participant, indexed by Participant id
+std::map<core::types::ParticipantId, core::WriterQueueMetrics> writer_queues_metrics(
+        core::DdsPipe& ddspipe,
+        const std::vector<std::shared_ptr<participants::testing::MockParticipant>>& participants)
+{
+    for (const auto& bridge_metrics : ddspipe.bridges_metrics())
+    {
+        const auto& writer_queues = bridge_metrics.second.writer_queues;
+        const auto track_it = writer_queues.find(participants[0]->id());
+
+        if (track_it != writer_queues.end())
+        {
+            return track_it->second;
+        }
+    }
+
+    return {};
+}
+
+//! Wait until the queue of the writer of every other participant fulfills \c predicate
+void wait_writer_queues(
+        core::DdsPipe& ddspipe,
+        const std::vector<std::shared_ptr<participants::testing::MockParticipant>>& participants,
+        const std::function<bool(const core::WriterQueueMetrics&)>& predicate)
+{
+    while (true)
+    {
+        const auto metrics = writer_queues_metrics(ddspipe, participants);
+
+        bool fulfilled = metrics.size() == N_PARTICIPANTS - 1;
+        for (const auto& queue : metrics)
+        {
+            fulfilled = fulfilled && predicate(queue.second);
+        }
+
+        if (fulfilled)
+        {
+            return;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+//! Wait for the \c N_BATCH_MESSAGES in the writer of every other participant, in the same order they were sent
+void wait_batch(
+        const participants::testing::MockTopic& topic,
+        const std::vector<std::shared_ptr<participants::testing::MockParticipant>>& participants)
+{
+    for (unsigned int p = 1; p < N_PARTICIPANTS; p++)
+    {
+        auto writer = participants[p]->get_writer(topic);
+        ASSERT_NE(writer, nullptr);
+
+        for (unsigned int i = 0; i < N_BATCH_MESSAGES; i++)
+        {
+            auto received_data = writer->wait_data();
+            ASSERT_EQ(received_data, new_data(participants[0]->id(), i));
+        }
+    }
+}
+
 } // test
 
 /**
@@ -463,6 +610,374 @@ TEST(DdsPipeCommunicationMockTest, mock_communication_multiple_participant_topic
     }
 }
 
+/**
+ * Test a DDS Pipe execution with mock participants when the data waiting in the reader exceeds a single take batch.
+ *
+ * STEPS:
+ * - Create entities (disable)
+ * - Send N messages, being N bigger than the Track take batch
+ * - Enable
+ * - Wait for N messages in every writer, in the same order they were sent
+ */
+TEST(DdsPipeCommunicationMockTest, mock_communication_batch)
+{
+    // Topic to send data
+    participants::testing::MockTopic topic_1;
+    topic_1.m_topic_name = "topic1";
+
+    // Create Participants and DDS Pipe
+    std::vector<std::shared_ptr<participants::testing::MockParticipant>> participants;
+    auto ddspipe = test::create_disabled_pipe(topic_1, participants);
+
+    // Send every message before enabling, so they are all waiting in the reader
+    ASSERT_NO_FATAL_FAILURE(test::simulate_batch_reception(topic_1, participants));
+
+    ddspipe->enable();
+
+    // Every other participant must receive every message in order
+    ASSERT_NO_FATAL_FAILURE(test::wait_batch(topic_1, participants));
+}
+
+/**
+ * Test communication when the Track must yield its thread several times to transmit every message.
+ *
+ * STEPS:
+ * - Create entities (disable) with a topic whose transmission quantum is smaller than the messages sent
+ * - Send N messages
+ * - Enable
+ * - Wait for N messages in every writer, in the same order they were sent
+ * - Check that the Track has yielded its thread
+ */
+TEST(DdsPipeCommunicationMockTest, mock_communication_transmission_quantum)
+{
+    // Topic to send data
+    participants::testing::MockTopic topic_1;
+    topic_1.m_topic_name = "topic1";
+    topic_1.topic_qos.transmission_quantum_samples.set_value(test::TRANSMISSION_QUANTUM_SAMPLES);
+
+    // Create Participants and DDS Pipe
+    std::vector<std::shared_ptr<participants::testing::MockParticipant>> participants;
+    auto ddspipe = test::create_disabled_pipe(topic_1, participants);
+
+    // Send every message before enabling, so the Track runs out of its quantum
+    ASSERT_NO_FATAL_FAILURE(test::simulate_batch_reception(topic_1, participants));
+
+    ddspipe->enable();
+
+    // Every other participant must receive every message in order
+    ASSERT_NO_FATAL_FAILURE(test::wait_batch(topic_1, participants));
+
+    // The Track cannot send N messages in a single quantum, so it must have yielded at least once
+    const auto metrics = ddspipe->bridges_metrics();
+    ASSERT_EQ(metrics.size(), 1u);
+    ASSERT_GT(metrics.begin()->second.yield_count, 0u);
+}
+
+/**
+ * Test communication when every writer has its own queue and the Track waits for room in them.
+ *
+ * STEPS:
+ * - Create entities (disable) with a topic whose writers have a blocking queue smaller than the messages sent
+ * - Hold the writes of every writer
+ * - Send N messages
+ * - Enable
+ * - Check that every queue gets full without dropping any message
+ * - Release the writes
+ * - Wait for N messages in every writer, in the same order they were sent
+ * - Check that every queue is empty and has not dropped any message
+ */
+TEST(DdsPipeCommunicationMockTest, mock_communication_writer_queues)
+{
+    // Topic to send data
+    participants::testing::MockTopic topic_1;
+    topic_1.m_topic_name = "topic1";
+    topic_1.topic_qos.writer_queue_size.set_value(test::WRITER_QUEUE_SIZE);
+    topic_1.topic_qos.writer_queue_overflow_policy.set_value(core::types::WriterQueueOverflowPolicy::block);
+
+    // Create Participants and DDS Pipe
+    std::vector<std::shared_ptr<participants::testing::MockParticipant>> participants;
+    auto ddspipe = test::create_disabled_pipe(topic_1, participants, test::N_HELD_WRITES_THREADS);
+
+    std::map<core::types::ParticipantId, std::shared_ptr<participants::testing::MockWriter>> writers;
+    ASSERT_NO_FATAL_FAILURE(test::other_writers(topic_1, participants, writers));
+
+    // Hold the writes and send every message before enabling, so the writer queues get full
+    for (auto& writer : writers)
+    {
+        writer.second->hold_writes();
+    }
+
+    ASSERT_NO_FATAL_FAILURE(test::simulate_batch_reception(topic_1, participants));
+
+    ddspipe->enable();
+
+    // Each writer holds the first message while the Track fills its queue and waits for room
+    for (auto& writer : writers)
+    {
+        writer.second->wait_held_write();
+    }
+
+    test::wait_writer_queues(
+        *ddspipe,
+        participants,
+        [](const core::WriterQueueMetrics& queue)
+        {
+            return queue.depth == test::WRITER_QUEUE_SIZE;
+        });
+
+    for (const auto& queue : test::writer_queues_metrics(*ddspipe, participants))
+    {
+        ASSERT_EQ(queue.second.dropped, 0u);
+    }
+
+    for (auto& writer : writers)
+    {
+        writer.second->release_writes();
+    }
+
+    // Every other participant must receive every message in order
+    ASSERT_NO_FATAL_FAILURE(test::wait_batch(topic_1, participants));
+
+    for (const auto& queue : test::writer_queues_metrics(*ddspipe, participants))
+    {
+        ASSERT_EQ(queue.second.depth, 0u);
+        ASSERT_EQ(queue.second.max_depth, test::WRITER_QUEUE_SIZE);
+        ASSERT_EQ(queue.second.dropped, 0u);
+    }
+}
+
+/**
+ * Test communication when every writer has its own queue that drops the oldest messages when it is full.
+ *
+ * STEPS:
+ * - Create entities (disable) with a topic whose writers have a drop_oldest queue smaller than the messages sent
+ * - Hold the writes of every writer
+ * - Send N messages
+ * - Enable
+ * - Wait till every message has been queued or dropped
+ * - Release the writes
+ * - Check that every writer receives the last messages sent, in order
+ */
+TEST(DdsPipeCommunicationMockTest, mock_communication_writer_queues_drop_oldest)
+{
+    // Topic to send data
+    participants::testing::MockTopic topic_1;
+    topic_1.m_topic_name = "topic1";
+    topic_1.topic_qos.writer_queue_size.set_value(test::WRITER_QUEUE_SIZE);
+    topic_1.topic_qos.writer_queue_overflow_policy.set_value(core::types::WriterQueueOverflowPolicy::drop_oldest);
+
+    // Create Participants and DDS Pipe
+    std::vector<std::shared_ptr<participants::testing::MockParticipant>> participants;
+    auto ddspipe = test::create_disabled_pipe(topic_1, participants, test::N_HELD_WRITES_THREADS);
+
+    std::map<core::types::ParticipantId, std::shared_ptr<participants::testing::MockWriter>> writers;
+    ASSERT_NO_FATAL_FAILURE(test::other_writers(topic_1, participants, writers));
+
+    // Hold the writes and send every message before enabling, so the writer queues overflow
+    for (auto& writer : writers)
+    {
+        writer.second->hold_writes();
+    }
+
+    ASSERT_NO_FATAL_FAILURE(test::simulate_batch_reception(topic_1, participants));
+
+    ddspipe->enable();
+
+    // Each writer holds a message while every other message is queued or dropped
+    for (auto& writer : writers)
+    {
+        writer.second->wait_held_write();
+    }
+
+    test::wait_writer_queues(
+        *ddspipe,
+        participants,
+        [](const core::WriterQueueMetrics& queue)
+        {
+            return queue.dropped + queue.depth == test::N_BATCH_MESSAGES - 1;
+        });
+
+    const auto metrics = test::writer_queues_metrics(*ddspipe, participants);
+
+    for (const auto& queue : metrics)
+    {
+        ASSERT_EQ(queue.second.max_depth, test::WRITER_QUEUE_SIZE);
+        ASSERT_GT(queue.second.dropped, 0u);
+    }
+
+    for (auto& writer : writers)
+    {
+        writer.second->release_writes();
+    }
+
+    // The queue keeps the last messages, received after the message held if it was taken before the queue overflowed
+    for (auto& writer : writers)
+    {
+        const auto n_received = test::N_BATCH_MESSAGES - metrics.at(writer.first).dropped;
+        ASSERT_GE(n_received, test::WRITER_QUEUE_SIZE);
+        ASSERT_LE(n_received, test::WRITER_QUEUE_SIZE + 1u);
+
+        if (n_received > test::WRITER_QUEUE_SIZE)
+        {
+            auto held_data = writer.second->wait_data();
+            ASSERT_LT(test::index_of(held_data), test::N_BATCH_MESSAGES - test::WRITER_QUEUE_SIZE);
+        }
+
+        for (unsigned int i = test::N_BATCH_MESSAGES - test::WRITER_QUEUE_SIZE; i < test::N_BATCH_MESSAGES; i++)
+        {
+            auto received_data = writer.second->wait_data();
+            ASSERT_EQ(received_data, test::new_data(participants[0]->id(), i));
+        }
+    }
+
+    for (const auto& queue : test::writer_queues_metrics(*ddspipe, participants))
+    {
+        ASSERT_EQ(queue.second.depth, 0u);
+    }
+}
+
+/**
+ * Test communication when every writer has its own queue that drops the newest messages when it is full.
+ *
+ * STEPS:
+ * - Create entities (disable) with a topic whose writers have a drop_newest queue smaller than the messages sent
+ * - Hold the writes of every writer
+ * - Send N messages
+ * - Enable
+ * - Wait till every message has been queued or dropped
+ * - Release the writes
+ * - Check that every writer receives the first messages sent, in order
+ */
+TEST(DdsPipeCommunicationMockTest, mock_communication_writer_queues_drop_newest)
+{
+    // Topic to send data
+    participants::testing::MockTopic topic_1;
+    topic_1.m_topic_name = "topic1";
+    topic_1.topic_qos.writer_queue_size.set_value(test::WRITER_QUEUE_SIZE);
+    topic_1.topic_qos.writer_queue_overflow_policy.set_value(core::types::WriterQueueOverflowPolicy::drop_newest);
+
+    // Create Participants and DDS Pipe
+    std::vector<std::shared_ptr<participants::testing::MockParticipant>> participants;
+    auto ddspipe = test::create_disabled_pipe(topic_1, participants, test::N_HELD_WRITES_THREADS);
+
+    std::map<core::types::ParticipantId, std::shared_ptr<participants::testing::MockWriter>> writers;
+    ASSERT_NO_FATAL_FAILURE(test::other_writers(topic_1, participants, writers));
+
+    // Hold the writes and send every message before enabling, so the writer queues overflow
+    for (auto& writer : writers)
+    {
+        writer.second->hold_writes();
+    }
+
+    ASSERT_NO_FATAL_FAILURE(test::simulate_batch_reception(topic_1, participants));
+
+    ddspipe->enable();
+
+    // Each writer holds the first message while every other message is queued or dropped
+    for (auto& writer : writers)
+    {
+        writer.second->wait_held_write();
+    }
+
+    test::wait_writer_queues(
+        *ddspipe,
+        participants,
+        [](const core::WriterQueueMetrics& queue)
+        {
+            return queue.dropped + queue.depth == test::N_BATCH_MESSAGES - 1;
+        });
+
+    const auto metrics = test::writer_queues_metrics(*ddspipe, participants);
+
+    for (const auto& queue : metrics)
+    {
+        ASSERT_EQ(queue.second.max_depth, test::WRITER_QUEUE_SIZE);
+        ASSERT_GT(queue.second.dropped, 0u);
+    }
+
+    for (auto& writer : writers)
+    {
+        writer.second->release_writes();
+    }
+
+    // The queue has dropped every message once it was full, so the first ones are received in order
+    for (auto& writer : writers)
+    {
+        const auto n_received = test::N_BATCH_MESSAGES - metrics.at(writer.first).dropped;
+        ASSERT_GE(n_received, test::WRITER_QUEUE_SIZE);
+        ASSERT_LE(n_received, test::WRITER_QUEUE_SIZE + 1u);
+
+        for (unsigned int i = 0; i < n_received; i++)
+        {
+            auto received_data = writer.second->wait_data();
+            ASSERT_EQ(received_data, test::new_data(participants[0]->id(), i));
+        }
+    }
+
+    for (const auto& queue : test::writer_queues_metrics(*ddspipe, participants))
+    {
+        ASSERT_EQ(queue.second.depth, 0u);
+    }
+}
+
+/**
+ * Test communication when the Track transmits inline, in the thread that notifies the data.
+ *
+ * STEPS:
+ * - Create entities with a topic with inline transmission
+ * - Send N messages one by one
+ * - Check that each message has already been written when the reception returns
+ */
+TEST(DdsPipeCommunicationMockTest, mock_communication_inline_transmission)
+{
+    // Topic to send data
+    participants::testing::MockTopic topic_1;
+    topic_1.m_topic_name = "topic1";
+    topic_1.topic_qos.inline_transmission.set_value(true);
+    eprosima::utils::Heritable<core::types::DistributedTopic> htopic_1 =
+            eprosima::utils::Heritable<participants::testing::MockTopic>::make_heritable(topic_1);
+
+    // Create Participants
+    core::types::ParticipantId part_1_id("Participant_1");
+    auto part_1 = std::make_shared<participants::testing::MockParticipant>(part_1_id);
+
+    core::types::ParticipantId part_2_id("Participant_2");
+    auto part_2 = std::make_shared<participants::testing::MockParticipant>(part_2_id);
+
+    auto part_db = std::make_shared<core::ParticipantsDatabase>();
+    part_db->add_participant(part_1_id, part_1);
+    part_db->add_participant(part_2_id, part_2);
+
+    // Create DDS Pipe
+    core::DdsPipeConfiguration ddspipe_configuration;
+    ddspipe_configuration.builtin_topics.insert(htopic_1);
+    ddspipe_configuration.init_enabled = true;
+
+    core::DdsPipe ddspipe(
+        ddspipe_configuration,
+        std::make_shared<core::DiscoveryDatabase>(),
+        std::make_shared<core::FastPayloadPool>(),
+        part_db,
+        std::make_shared<eprosima::utils::SlotThreadPool>(test::N_THREADS)
+        );
+
+    // Look for the reader in participant 1 and writer in participant 2
+    auto reader_1 = part_1->get_reader(topic_1);
+    auto writer_2 = part_2->get_writer(topic_1);
+    ASSERT_NE(reader_1, nullptr);
+    ASSERT_NE(writer_2, nullptr);
+
+    // Simulate N messages, each of them must be written before the reception returns
+    for (unsigned int i = 0; i < test::N_MESSAGES; i++)
+    {
+        reader_1->simulate_data_reception(test::new_data(part_1_id, i));
+
+        ASSERT_EQ(writer_2->n_to_send_data(), 1u);
+        auto received_data = writer_2->wait_data();
+        ASSERT_EQ(received_data, test::new_data(part_1_id, i));
+    }
+}
+
 int main(
         int argc,
         char** argv)
@@ -0,0 +1,141 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <memory>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <cpp_utils/time/time_utils.hpp>
+
+#include <ddspipe_core/dynamic/DiscoveryDatabase.hpp>
+#include <ddspipe_core/testing/random_values.hpp>
+
+#include <ddspipe_participants/reader/auxiliar/WriterQoSCache.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddspipe;
+using namespace eprosima::ddspipe::core::testing;
+
+namespace test {
+
+constexpr uint32_t WAIT_TIME_MS = 50;
+
+//! Create a started database with a writer with the given ownership strength
+std::shared_ptr<core::DiscoveryDatabase> database_with_writer(
+        core::types::Endpoint& writer,
+        uint32_t ownership_strength)
+{
+    auto discovery_database = std::make_shared<core::DiscoveryDatabase>();
+    discovery_database->start();
+
+    writer = random_endpoint(1);
+    writer.kind = core::types::EndpointKind::writer;
+    writer.active = true;
+    writer.specific_qos.ownership_strength.value = ownership_strength;
+
+    discovery_database->add_endpoint(writer);
+    utils::sleep_for(WAIT_TIME_MS);
+
+    return discovery_database;
+}
+
+} // namespace test
+
+/**
+ * Test that the QoS of a writer is got from the database, and a writer not in the database is not found
+ */
+TEST(WriterQoSCacheTest, get_from_database)
+{
+    core::types::Endpoint writer;
+    auto discovery_database = test::database_with_writer(writer, 7);
+
+    participants::WriterQoSCache cache(discovery_database);
+
+    // Looked up in the database
+    auto qos = cache.get(writer.guid);
+    ASSERT_NE(qos, nullptr);
+    EXPECT_EQ(*qos, writer.specific_qos);
+
+    // Got from the cache, without copying it
+    ASSERT_EQ(cache.get(writer.guid), qos);
+
+    // Unknown writer
+    EXPECT_EQ(cache.get(random_guid(2)), nullptr);
+
+    discovery_database->stop();
+}
+
+/**
+ * Test that a cached writer updated in the database is updated in the cache
+ */
+TEST(WriterQoSCacheTest, update_from_database)
+{
+    core::types::Endpoint writer;
+    auto discovery_database = test::database_with_writer(writer, 7);
+
+    participants::WriterQoSCache cache(discovery_database);
+
+    auto qos = cache.get(writer.guid);
+    ASSERT_NE(qos, nullptr);
+    EXPECT_EQ(qos->ownership_strength.value, 7u);
+
+    writer.specific_qos.ownership_strength.value = 11;
+    discovery_database->update_endpoint(writer);
+    utils::sleep_for(test::WAIT_TIME_MS);
+
+    auto updated_qos = cache.get(writer.guid);
+    ASSERT_NE(updated_qos, nullptr);
+    EXPECT_EQ(updated_qos->ownership_strength.value, 11u);
+
+    // The QoS got before the update does not change
+    EXPECT_EQ(qos->ownership_strength.value, 7u);
+
+    discovery_database->stop();
+}
+
+/**
+ * Test that a cached writer erased from the database is not found anymore, and that a destroyed cache is not called
+ */
+TEST(WriterQoSCacheTest, erase_from_database)
+{
+    core::types::Endpoint writer;
+    auto discovery_database = test::database_with_writer(writer, 7);
+
+    {
+        participants::WriterQoSCache cache(discovery_database);
+
+        ASSERT_NE(cache.get(writer.guid), nullptr);
+
+        discovery_database->erase_endpoint(writer);
+        utils::sleep_for(test::WAIT_TIME_MS);
+
+        EXPECT_EQ(cache.get(writer.guid), nullptr);
+    }
+
+    // The callbacks of the destroyed cache must not be called
+    discovery_database->add_endpoint(writer);
+    utils::sleep_for(test::WAIT_TIME_MS);
+
+    discovery_database->stop();
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
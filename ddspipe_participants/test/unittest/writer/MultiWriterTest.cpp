@@ -0,0 +1,242 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/dynamic/DiscoveryDatabase.hpp>
+#include <ddspipe_core/efficiency/payload/FastPayloadPool.hpp>
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+
+#include <ddspipe_participants/participant/rtps/SimpleParticipant.hpp>
+#include <ddspipe_participants/writer/rtps/MultiWriter.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddspipe;
+
+namespace test {
+
+//! Number of threads writing at the same time, as Tracks of different readers would do
+constexpr const unsigned int N_TRACKS = 8;
+
+//! Number of samples written by each thread
+constexpr const unsigned int N_SAMPLES = 1000;
+
+//! Number of different partitions the samples are written with
+constexpr const unsigned int N_PARTITIONS = 4;
+
+class SimpleParticipantTest : public participants::rtps::SimpleParticipant
+{
+public:
+
+    using participants::rtps::SimpleParticipant::SimpleParticipant;
+
+    fastdds::rtps::RTPSParticipant* rtps_participant() const
+    {
+        return rtps_participant_;
+    }
+
+};
+
+class MultiWriterTest : public participants::rtps::MultiWriter
+{
+public:
+
+    using participants::rtps::MultiWriter::MultiWriter;
+
+    std::size_t writers_count()
+    {
+        std::shared_lock<WritersMapType> lock(writers_map_);
+        return writers_map_.size();
+    }
+
+};
+
+//! Environment with a participant and a MultiWriter with partitions
+struct Environment
+{
+    Environment()
+        : payload_pool(new core::FastPayloadPool())
+        , discovery_database(new core::DiscoveryDatabase())
+    {
+        std::shared_ptr<participants::SimpleParticipantConfiguration> conf(
+            new participants::SimpleParticipantConfiguration());
+        conf->id = core::types::ParticipantId("testPart");
+
+        participant = std::make_unique<SimpleParticipantTest>(conf, payload_pool, discovery_database);
+        participant->init();
+
+        core::types::DdsTopic topic;
+        topic.m_topic_name = "MultiWriterTestTopic";
+        topic.type_name = "MultiWriterTestType";
+        topic.topic_qos.use_partitions = true;
+
+        writer = std::make_unique<MultiWriterTest>(
+            conf->id,
+            topic,
+            payload_pool,
+            participant->rtps_participant());
+        writer->enable();
+    }
+
+    ~Environment()
+    {
+        writer.reset();
+        participant.reset();
+    }
+
+    std::shared_ptr<core::PayloadPool> payload_pool;
+    std::shared_ptr<core::DiscoveryDatabase> discovery_database;
+    std::unique_ptr<SimpleParticipantTest> participant;
+    std::unique_ptr<MultiWriterTest> writer;
+};
+
+//! Qos of a data in partition \c index
+std::shared_ptr<const core::types::SpecificEndpointQoS> partition_qos(
+        unsigned int index,
+        uint32_t ownership_strength = 0)
+{
+    auto qos = std::make_shared<core::types::SpecificEndpointQoS>();
+    qos->partitions.push_back(("partition_" + std::to_string(index)).c_str());
+    qos->ownership_strength.value = ownership_strength;
+    return qos;
+}
+
+//! Write \c N_SAMPLES through \c writer from \c N_TRACKS threads at the same time, and return the time elapsed
+std::chrono::microseconds concurrent_write(
+        MultiWriterTest& writer,
+        std::atomic<unsigned int>& errors)
+{
+    std::vector<std::shared_ptr<const core::types::SpecificEndpointQoS>> qos;
+    for (unsigned int i = 0; i < N_PARTITIONS; ++i)
+    {
+        qos.push_back(partition_qos(i));
+    }
+
+    std::vector<std::thread> threads;
+    auto start = std::chrono::steady_clock::now();
+
+    for (unsigned int i = 0; i < N_TRACKS; ++i)
+    {
+        threads.emplace_back(
+            [&writer, &errors, &qos, i]()
+            {
+                for (unsigned int j = 0; j < N_SAMPLES; ++j)
+                {
+                    core::types::RtpsPayloadData data;
+                    data.writer_qos = qos[(i + j) % N_PARTITIONS];
+
+                    if (writer.write(data) != utils::ReturnCode::RETCODE_OK)
+                    {
+                        ++errors;
+                    }
+                }
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+}
+
+} // test
+
+/**
+ * Test that the MultiWriter creates a single writer for each different QoS
+ *
+ * STEPS:
+ * - write data with the same partition twice
+ * - write data with another partition
+ * - write data with the first partition and another ownership strength
+ */
+TEST(MultiWriterTest, writer_per_qos)
+{
+    test::Environment environment;
+
+    core::types::RtpsPayloadData data;
+    data.writer_qos = test::partition_qos(0);
+
+    ASSERT_EQ(environment.writer->write(data), utils::ReturnCode::RETCODE_OK);
+    ASSERT_EQ(environment.writer->writers_count(), 1u);
+
+    ASSERT_EQ(environment.writer->write(data), utils::ReturnCode::RETCODE_OK);
+    ASSERT_EQ(environment.writer->writers_count(), 1u);
+
+    data.writer_qos = test::partition_qos(1);
+    ASSERT_EQ(environment.writer->write(data), utils::ReturnCode::RETCODE_OK);
+    ASSERT_EQ(environment.writer->writers_count(), 2u);
+
+    data.writer_qos = test::partition_qos(0, 10);
+    ASSERT_EQ(environment.writer->write(data), utils::ReturnCode::RETCODE_OK);
+    ASSERT_EQ(environment.writer->writers_count(), 3u);
+}
+
+/**
+ * Test that several threads writing through the same MultiWriter at the same time create a single writer per QoS
+ */
+TEST(MultiWriterTest, concurrent_write)
+{
+    test::Environment environment;
+    std::atomic<unsigned int> errors{0};
+
+    test::concurrent_write(*environment.writer, errors);
+
+    ASSERT_EQ(errors.load(), 0u);
+    ASSERT_EQ(environment.writer->writers_count(), test::N_PARTITIONS);
+}
+
+/**
+ * Measure the time to write through the same MultiWriter from several threads once every writer exists
+ *
+ * The time is recorded as a test property, as it depends on the machine. The writes measured must succeed and find
+ * the writers already created.
+ */
+TEST(MultiWriterTest, benchmark_concurrent_write)
+{
+    test::Environment environment;
+    std::atomic<unsigned int> errors{0};
+
+    // Create every writer first so only the lookup is measured
+    test::concurrent_write(*environment.writer, errors);
+    ASSERT_EQ(errors.load(), 0u);
+    ASSERT_EQ(environment.writer->writers_count(), test::N_PARTITIONS);
+
+    auto elapsed = test::concurrent_write(*environment.writer, errors);
+
+    ASSERT_EQ(errors.load(), 0u);
+    ASSERT_EQ(environment.writer->writers_count(), test::N_PARTITIONS);
+
+    ::testing::Test::RecordProperty("tracks", std::to_string(test::N_TRACKS));
+    ::testing::Test::RecordProperty("samples", std::to_string(test::N_TRACKS * test::N_SAMPLES));
+    ::testing::Test::RecordProperty("elapsed_us", std::to_string(elapsed.count()));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -52,6 +52,7 @@ constexpr const char* MONITOR_DOMAIN_TAG("domain"); //! Domain Id of the monitor
 
 constexpr const char* MONITOR_STATUS_TAG("status"); //! Monitor topics configuration
 constexpr const char* MONITOR_TOPICS_TAG("topics"); //! Monitor topics configuration
+constexpr const char* MONITOR_SERVICES_TAG("services"); //! Monitor services configuration
 constexpr const char* MONITOR_ENABLE_TAG("enable"); //! Enable monitoring topics
 constexpr const char* MONITOR_PERIOD_TAG("period"); //! Period to publish the topics' monitoring data at
 constexpr const char* MONITOR_TOPIC_NAME_TAG("topic-name"); //! Topic name to publish the topics' monitoring data
@@ -66,6 +67,16 @@ constexpr const char* QOS_KEYED_TAG("keyed"); //! Kind of a topic (with or witho
 constexpr const char* QOS_MAX_TX_RATE_TAG("max-tx-rate"); //! Topic specific max transmission rate
 constexpr const char* QOS_MAX_RX_RATE_TAG("max-rx-rate"); //! Topic specific max reception rate
 constexpr const char* QOS_DOWNSAMPLING_TAG("downsampling"); //! Topic specific downsampling factor
+constexpr const char* QOS_TRANSMISSION_QUANTUM_SAMPLES_TAG("transmission-quantum-samples"); //! Topic specific samples quantum
+constexpr const char* QOS_TRANSMISSION_QUANTUM_TIME_TAG("transmission-quantum-time"); //! Topic specific time quantum [us]
+constexpr const char* QOS_WRITER_QUEUE_SIZE_TAG("writer-queue-size"); //! Size of the queue of each writer (0 = no queue)
+constexpr const char* QOS_WRITER_QUEUE_OVERFLOW_POLICY_TAG("writer-queue-overflow-policy"); //! Policy when a writer queue is full
+constexpr const char* WRITER_QUEUE_OVERFLOW_DROP_OLDEST_TAG("drop-oldest"); //! Discard the oldest data in the queue
+constexpr const char* WRITER_QUEUE_OVERFLOW_DROP_NEWEST_TAG("drop-newest"); //! Discard the new data
+constexpr const char* WRITER_QUEUE_OVERFLOW_BLOCK_TAG("block"); //! Stop taking data until the queue has room
+constexpr const char* QOS_INLINE_TRANSMISSION_TAG("inline-transmission"); //! Transmit data in the thread that receives it
+constexpr const char* QOS_CONFLATION_THRESHOLD_TAG("conflation-threshold"); //! Backlog from which only the latest sample of each instance is forwarded
+constexpr const char* QOS_MAX_FORWARD_LATENCY_TAG("max-forward-latency"); //! Max time since a sample was published until it is forwarded [ms]
 
 // Participant related tags
 constexpr const char* PARTICIPANT_KIND_TAG("kind");   //! Participant Kind
@@ -170,6 +181,12 @@ constexpr const char* LOG_CONFIGURATION_TAG("logging"); //! Configure Logging se
 // Logging tags
 constexpr const char* LOG_PUBLISH_TAG("publish"); //! TODO
 constexpr const char* LOG_STDOUT_TAG("stdout"); //! TODO
+constexpr const char* LOG_PUBLISH_QUEUE_SIZE_TAG("publish-queue-size"); //! Max log entries waiting to be published (0 = publish synchronously)
+constexpr const char* LOG_PUBLISH_QUEUE_OVERFLOW_POLICY_TAG("publish-queue-overflow-policy"); //! Policy when the log publishing queue is full
+constexpr const char* LOG_PUBLISH_BATCH_SIZE_TAG("publish-batch-size"); //! Log entries queued that trigger their publication
+constexpr const char* LOG_PUBLISH_BATCH_PERIOD_TAG("publish-batch-period"); //! Max time in ms a log entry waits to be published
+constexpr const char* LOG_THROTTLE_MAX_OCCURRENCES_TAG("throttle-max-occurrences"); //! Times a throttled message is logged per window (0 = never throttle)
+constexpr const char* LOG_THROTTLE_WINDOW_TAG("throttle-window"); //! Length in ms of the window of the throttled messages
 constexpr const char* LOG_VERBOSITY_TAG("verbosity"); //! Set logging verbosity
 constexpr const char* LOG_VERBOSITY_INFO_TAG("info"); //! Set logging verbosity to info
 constexpr const char* LOG_VERBOSITY_WARNING_TAG("warning"); //! Set logging verbosity to warning
@@ -20,6 +20,7 @@
 #include <ddspipe_core/configuration/MonitorProducerConfiguration.hpp>
 #include <ddspipe_core/configuration/RoutesConfiguration.hpp>
 #include <ddspipe_core/configuration/TopicRoutesConfiguration.hpp>
+#include <ddspipe_core/monitoring/producers/ServicesMonitorProducer.hpp>
 #include <ddspipe_core/monitoring/producers/StatusMonitorProducer.hpp>
 #include <ddspipe_core/monitoring/producers/TopicsMonitorProducer.hpp>
 #include <ddspipe_core/types/dds/DomainId.hpp>
@@ -259,6 +260,15 @@ void YamlReader::fill(
         YamlReader::fill<core::DdsPublishingConfiguration>(object.consumers[core::TOPICS_MONITOR_PRODUCER_ID],
                 get_value_in_tag(yml, MONITOR_TOPICS_TAG), version);
     }
+
+    /////
+    // Get optional monitor services tag (only logged, so it has no DDS publishing configuration)
+    if (YamlReader::is_tag_present(yml, MONITOR_SERVICES_TAG))
+    {
+        object.producers[core::SERVICES_MONITOR_PRODUCER_ID] = YamlReader::get<core::MonitorProducerConfiguration>(yml,
+                        MONITOR_SERVICES_TAG,
+                        version);
+    }
 }
 
 template<>
@@ -87,6 +87,21 @@ TransportDescriptors YamlReader::get<TransportDescriptors>(
         });
 }
 
+template<>
+DDSPIPE_YAML_DllAPI
+WriterQueueOverflowPolicy YamlReader::get<WriterQueueOverflowPolicy>(
+        const Yaml& yml,
+        const YamlReaderVersion /* version */)
+{
+    return get_enumeration<WriterQueueOverflowPolicy>(
+        yml,
+        {
+            {WRITER_QUEUE_OVERFLOW_DROP_OLDEST_TAG, WriterQueueOverflowPolicy::drop_oldest},
+            {WRITER_QUEUE_OVERFLOW_DROP_NEWEST_TAG, WriterQueueOverflowPolicy::drop_newest},
+            {WRITER_QUEUE_OVERFLOW_BLOCK_TAG, WriterQueueOverflowPolicy::block}
+        });
+}
+
 template<>
 DDSPIPE_YAML_DllAPI
 IgnoreParticipantFlags YamlReader::get<IgnoreParticipantFlags>(
@@ -451,6 +466,49 @@ void YamlReader::fill(
         object.downsampling.set_value(get_positive_int(yml, QOS_DOWNSAMPLING_TAG));
     }
 
+    // Transmission Quantum in samples optional
+    if (is_tag_present(yml, QOS_TRANSMISSION_QUANTUM_SAMPLES_TAG))
+    {
+        object.transmission_quantum_samples.set_value(get_nonnegative_int(yml, QOS_TRANSMISSION_QUANTUM_SAMPLES_TAG));
+    }
+
+    // Transmission Quantum in time optional
+    if (is_tag_present(yml, QOS_TRANSMISSION_QUANTUM_TIME_TAG))
+    {
+        object.transmission_quantum_time.set_value(get_nonnegative_int(yml, QOS_TRANSMISSION_QUANTUM_TIME_TAG));
+    }
+
+    // Writer Queue size optional
+    if (is_tag_present(yml, QOS_WRITER_QUEUE_SIZE_TAG))
+    {
+        object.writer_queue_size.set_value(get_nonnegative_int(yml, QOS_WRITER_QUEUE_SIZE_TAG));
+    }
+
+    // Writer Queue overflow policy optional
+    if (is_tag_present(yml, QOS_WRITER_QUEUE_OVERFLOW_POLICY_TAG))
+    {
+        object.writer_queue_overflow_policy.set_value(
+            get<WriterQueueOverflowPolicy>(yml, QOS_WRITER_QUEUE_OVERFLOW_POLICY_TAG, version));
+    }
+
+    // Inline Transmission optional
+    if (is_tag_present(yml, QOS_INLINE_TRANSMISSION_TAG))
+    {
+        object.inline_transmission.set_value(get<bool>(yml, QOS_INLINE_TRANSMISSION_TAG, version));
+    }
+
+    // Conflation threshold optional
+    if (is_tag_present(yml, QOS_CONFLATION_THRESHOLD_TAG))
+    {
+        object.conflation_threshold.set_value(get_nonnegative_int(yml, QOS_CONFLATION_THRESHOLD_TAG));
+    }
+
+    // Max forward latency optional
+    if (is_tag_present(yml, QOS_MAX_FORWARD_LATENCY_TAG))
+    {
+        object.max_forward_latency.set_value(get_nonnegative_int(yml, QOS_MAX_FORWARD_LATENCY_TAG));
+    }
+
     // Endpoint profile name optional
     if (is_tag_present(yml, ENDPOINT_PROFILE_NAME_TAG))
     {
@@ -515,6 +573,48 @@ void YamlReader::fill(
         object.stdout_enable = get<bool>(yml, LOG_STDOUT_TAG, version);
     }
 
+    // Optional publish queue size
+    if (is_tag_present(yml, LOG_PUBLISH_QUEUE_SIZE_TAG))
+    {
+        object.publish_queue_size = get_nonnegative_int(yml, LOG_PUBLISH_QUEUE_SIZE_TAG);
+    }
+
+    // Optional publish queue overflow policy
+    if (is_tag_present(yml, LOG_PUBLISH_QUEUE_OVERFLOW_POLICY_TAG))
+    {
+        object.publish_queue_overflow_policy = get_enumeration<core::LogQueueOverflowPolicy>(
+            yml,
+            LOG_PUBLISH_QUEUE_OVERFLOW_POLICY_TAG,
+            {
+                {WRITER_QUEUE_OVERFLOW_DROP_OLDEST_TAG, core::LogQueueOverflowPolicy::drop_oldest},
+                {WRITER_QUEUE_OVERFLOW_DROP_NEWEST_TAG, core::LogQueueOverflowPolicy::drop_newest}
+            });
+    }
+
+    // Optional publish batch size
+    if (is_tag_present(yml, LOG_PUBLISH_BATCH_SIZE_TAG))
+    {
+        object.publish_batch_size = get_positive_int(yml, LOG_PUBLISH_BATCH_SIZE_TAG);
+    }
+
+    // Optional publish batch period
+    if (is_tag_present(yml, LOG_PUBLISH_BATCH_PERIOD_TAG))
+    {
+        object.publish_batch_period = get_positive_int(yml, LOG_PUBLISH_BATCH_PERIOD_TAG);
+    }
+
+    // Optional throttle max occurrences
+    if (is_tag_present(yml, LOG_THROTTLE_MAX_OCCURRENCES_TAG))
+    {
+        object.throttle_max_occurrences = get_nonnegative_int(yml, LOG_THROTTLE_MAX_OCCURRENCES_TAG);
+    }
+
+    // Optional throttle window
+    if (is_tag_present(yml, LOG_THROTTLE_WINDOW_TAG))
+    {
+        object.throttle_window = get_positive_int(yml, LOG_THROTTLE_WINDOW_TAG);
+    }
+
     // Verbosity optional
     if (is_tag_present(yml, LOG_VERBOSITY_TAG))
     {
@@ -188,6 +188,113 @@ TEST(YamlReaderLogConfiguration, invalid_topic_name)
     ASSERT_EQ(error_msg.to_string(), "Empty topic name.");
 }
 
+/**
+ * Check the get function for LogConfiguration when parsing from YAML the tags of the publishing queue.
+ *
+ * CASES:
+ *  Checks:
+ *  - If the publishing queue and its batches are configured correctly.
+ *  - If the publishing queue can be disabled.
+ */
+TEST(YamlReaderLogConfiguration, publish_queue)
+{
+    {
+        const char* yml_str =
+                R"(
+                publish-queue-size: 128
+                publish-queue-overflow-policy: drop-oldest
+                publish-batch-size: 16
+                publish-batch-period: 50
+            )";
+
+        Yaml yml = YAML::Load(yml_str);
+
+        // Load configuration from YAML
+        const auto conf = ddspipe::yaml::YamlReader::get<ddspipe::core::DdsPipeLogConfiguration>(yml,
+                        ddspipe::yaml::YamlReaderVersion::LATEST);
+
+        // Verify that the configuration is valid
+        utils::Formatter error_msg;
+        ASSERT_TRUE(conf.is_valid(error_msg));
+
+        ASSERT_EQ(conf.publish_queue_size, 128u);
+        ASSERT_EQ(conf.publish_queue_overflow_policy, ddspipe::core::LogQueueOverflowPolicy::drop_oldest);
+        ASSERT_EQ(conf.publish_batch_size, 16u);
+        ASSERT_EQ(conf.publish_batch_period, 50u);
+    }
+
+    {
+        const char* yml_str =
+                R"(
+                publish-queue-size: 0
+            )";
+
+        Yaml yml = YAML::Load(yml_str);
+
+        // Load configuration from YAML
+        const auto conf = ddspipe::yaml::YamlReader::get<ddspipe::core::DdsPipeLogConfiguration>(yml,
+                        ddspipe::yaml::YamlReaderVersion::LATEST);
+
+        // Verify that the configuration is valid
+        utils::Formatter error_msg;
+        ASSERT_TRUE(conf.is_valid(error_msg));
+
+        ASSERT_EQ(conf.publish_queue_size, 0u);
+        ASSERT_EQ(conf.publish_queue_overflow_policy, ddspipe::core::LogQueueOverflowPolicy::drop_newest);
+    }
+}
+
+/**
+ * Check the get function for LogConfiguration when parsing from YAML the tags of the log throttling.
+ *
+ * CASES:
+ *  Checks:
+ *  - If the throttling is configured correctly.
+ *  - If the throttling can be disabled.
+ */
+TEST(YamlReaderLogConfiguration, throttle)
+{
+    {
+        const char* yml_str =
+                R"(
+                throttle-max-occurrences: 5
+                throttle-window: 200
+            )";
+
+        Yaml yml = YAML::Load(yml_str);
+
+        // Load configuration from YAML
+        const auto conf = ddspipe::yaml::YamlReader::get<ddspipe::core::DdsPipeLogConfiguration>(yml,
+                        ddspipe::yaml::YamlReaderVersion::LATEST);
+
+        // Verify that the configuration is valid
+        utils::Formatter error_msg;
+        ASSERT_TRUE(conf.is_valid(error_msg));
+
+        ASSERT_EQ(conf.throttle_max_occurrences, 5u);
+        ASSERT_EQ(conf.throttle_window, 200u);
+    }
+
+    {
+        const char* yml_str =
+                R"(
+                throttle-max-occurrences: 0
+            )";
+
+        Yaml yml = YAML::Load(yml_str);
+
+        // Load configuration from YAML
+        const auto conf = ddspipe::yaml::YamlReader::get<ddspipe::core::DdsPipeLogConfiguration>(yml,
+                        ddspipe::yaml::YamlReaderVersion::LATEST);
+
+        // Verify that the configuration is valid
+        utils::Formatter error_msg;
+        ASSERT_TRUE(conf.is_valid(error_msg));
+
+        ASSERT_EQ(conf.throttle_max_occurrences, 0u);
+    }
+}
+
 int main(
         int argc,
         char** argv)
@@ -24,6 +24,7 @@
 
 #include <ddspipe_core/configuration/MonitorConfiguration.hpp>
 #include <ddspipe_core/configuration/MonitorConsumerConfiguration.hpp>
+#include <ddspipe_core/monitoring/producers/ServicesMonitorProducer.hpp>
 #include <ddspipe_core/monitoring/producers/StatusMonitorProducer.hpp>
 #include <ddspipe_core/monitoring/producers/TopicsMonitorProducer.hpp>
 
@@ -134,6 +135,34 @@ TEST(YamlReaderMonitorTest, is_valid_conf_with_status_and_topics)
     ASSERT_EQ(conf.consumers[ddspipe::core::TOPICS_MONITOR_PRODUCER_ID].topic_name, "DdsPipeTopics");
 }
 
+/**
+ * Check the get function for the MonitorConfiguration.
+ *
+ * CASES:
+ *  Verify that the services configuration is parsed correctly, without a DDS consumer.
+ */
+TEST(YamlReaderMonitorTest, is_valid_conf_with_services)
+{
+    const char* yml_str =
+            R"(
+            domain: 10
+            services:
+              enable: true
+              period: 4000
+        )";
+
+    Yaml yml = YAML::Load(yml_str);
+
+    core::MonitorConfiguration conf = YamlReader::get<core::MonitorConfiguration>(yml, YamlReaderVersion::LATEST);
+
+    utils::Formatter error_msg;
+    ASSERT_TRUE(conf.is_valid(error_msg));
+
+    ASSERT_TRUE(conf.producers[ddspipe::core::SERVICES_MONITOR_PRODUCER_ID].enabled);
+    ASSERT_EQ(conf.producers[ddspipe::core::SERVICES_MONITOR_PRODUCER_ID].period, 4000);
+    ASSERT_EQ(conf.consumers.count(ddspipe::core::SERVICES_MONITOR_PRODUCER_ID), 0u);
+}
+
 int main(
         int argc,
         char** argv)